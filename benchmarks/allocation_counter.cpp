@@ -0,0 +1,79 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>   // atomic
+#include <cstdlib>  // malloc, aligned_alloc, free
+#include <new>      // align_val_t, bad_alloc
+
+namespace {
+
+  std::atomic<std::size_t> allocation_count{0};
+
+}  // namespace
+
+namespace benchmarks {
+
+  std::size_t AllocationCount() {
+    return allocation_count.load(std::memory_order_relaxed);
+  }
+
+}  // namespace benchmarks
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+// варианты с выравниванием (используются в том числе std::pmr::new_delete_resource)
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  const auto align = static_cast<std::size_t>(alignment);
+  const std::size_t rounded = (size == 0 ? align : (size + align - 1) / align * align);
+  if (void* ptr = std::aligned_alloc(align, rounded)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return operator new(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
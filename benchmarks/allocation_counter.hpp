@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>  // size_t
+
+namespace benchmarks {
+
+  /**
+   * Возвращает кол-во вызовов глобального operator new с момента запуска программы.
+   *
+   * Глобальные operator new/delete заменяются в allocation_counter.cpp (только для бенчмарков).
+   */
+  std::size_t AllocationCount();
+
+}  // namespace benchmarks
@@ -0,0 +1,83 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>         // cout
+#include <memory_resource>  // memory_resource, new_delete_resource
+
+#include "allocation_counter.hpp"  // AllocationCount
+
+#include "assignment/arena.hpp"          // MonotonicArena
+#include "assignment/array_stack.hpp"    // ArrayStack
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+
+using assignment::ArrayStack;
+using assignment::DynamicArray;
+using assignment::MonotonicArena;
+
+namespace {
+
+  constexpr int kRequests = 10'000;  // кол-во обрабатываемых "запросов"
+  constexpr int kContainers = 16;    // кол-во контейнеров каждого типа на один запрос
+  constexpr int kElements = 64;      // кол-во элементов в каждом контейнере
+
+  // Обработка одного запроса: набор короткоживущих контейнеров, уничтожаемых в конце запроса.
+  int HandleRequest(std::pmr::memory_resource* resource) {
+    int total = 0;
+    for (int c = 0; c < kContainers; c++) {
+      auto array = DynamicArray(4, resource);
+      auto stack = ArrayStack(4, resource);
+      for (int k = 0; k < kElements; k++) {
+        array.Add(k);
+        stack.Push(k);
+      }
+      total += array.size() + stack.size();
+    }
+    return total;
+  }
+
+  int HandleRequestsOnHeap() {
+    int total = 0;
+    for (int r = 0; r < kRequests; r++) {
+      total += HandleRequest(std::pmr::new_delete_resource());
+    }
+    return total;
+  }
+
+  int HandleRequestsOnArena(MonotonicArena& arena) {
+    int total = 0;
+    for (int r = 0; r < kRequests; r++) {
+      total += HandleRequest(&arena);
+      arena.Reset();
+    }
+    return total;
+  }
+
+}  // namespace
+
+// Контейнеры в рамках одного запроса: глобальная куча против арены, сбрасываемой в конце запроса.
+TEST_CASE("MonotonicArena request-scoped containers", "[benchmark][arena]") {
+
+  auto arena = MonotonicArena();
+  HandleRequestsOnArena(arena);  // прогрев: арена сходится к одному блоку
+
+  std::size_t before = benchmarks::AllocationCount();
+  HandleRequestsOnHeap();
+  const std::size_t heap_allocations = benchmarks::AllocationCount() - before;
+
+  before = benchmarks::AllocationCount();
+  HandleRequestsOnArena(arena);
+  const std::size_t arena_allocations = benchmarks::AllocationCount() - before;
+
+  std::cout << "heap allocations for " << kRequests << " requests:\n"
+            << "  global heap:    " << heap_allocations << '\n'
+            << "  MonotonicArena: " << arena_allocations << '\n';
+
+  CHECK(arena_allocations == 0);
+
+  BENCHMARK("global heap") {
+    return HandleRequestsOnHeap();
+  };
+
+  BENCHMARK("MonotonicArena") {
+    return HandleRequestsOnArena(arena);
+  };
+}
@@ -0,0 +1,38 @@
+#include <catch2/catch.hpp>
+
+#include <string>  // to_string
+
+#include "assignment/array_stack.hpp"  // ArrayStack
+
+using assignment::ArrayStack;
+using assignment::GrowthPolicy;
+
+namespace {
+
+  int FillStack(int size, const GrowthPolicy& policy) {
+    auto stack = ArrayStack(ArrayStack::kInitCapacity, policy);
+    for (int i = 0; i < size; i++) {
+      stack.Push(i);
+    }
+    return stack.capacity();
+  }
+
+}  // namespace
+
+// Амортизированная стоимость Push (см. DynamicArray::Add growth policies).
+TEST_CASE("ArrayStack::Push growth policies", "[benchmark][array_stack]") {
+
+  BENCHMARK("additive, N = 100'000") {
+    return FillStack(100'000, GrowthPolicy::Additive());
+  };
+
+  for (int size : {100'000, 1'000'000, 10'000'000}) {
+    BENCHMARK("geometric x1.5, N = " + std::to_string(size)) {
+      return FillStack(size, GrowthPolicy::Geometric15());
+    };
+
+    BENCHMARK("geometric x2, N = " + std::to_string(size)) {
+      return FillStack(size, GrowthPolicy::Geometric2());
+    };
+  }
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch.hpp>
+
+#include <string>  // string
+
+#include "assignment/basic_dynamic_array.hpp"  // BasicDynamicArray
+#include "assignment/dynamic_array.hpp"        // DynamicArray
+
+using assignment::BasicDynamicArray;
+using assignment::DynamicArray;
+using assignment::GrowthPolicy;
+
+// Добавление элементов с расширением массива: memcpy для int, перемещение для std::string.
+TEST_CASE("BasicDynamicArray::EmplaceBack", "[benchmark][basic_dynamic_array]") {
+  constexpr int kSize = 1'000'000;
+
+  BENCHMARK("DynamicArray::Add, int") {
+    auto array = DynamicArray(1, GrowthPolicy::Geometric2());
+    for (int i = 0; i < kSize; i++) {
+      array.Add(i);
+    }
+    return array.size();
+  };
+
+  BENCHMARK("BasicDynamicArray<int>::EmplaceBack") {
+    auto array = BasicDynamicArray<int>(1, GrowthPolicy::Geometric2());
+    for (int i = 0; i < kSize; i++) {
+      array.EmplaceBack(i);
+    }
+    return array.size();
+  };
+
+  BENCHMARK("BasicDynamicArray<std::string>::EmplaceBack") {
+    auto array = BasicDynamicArray<std::string>(1, GrowthPolicy::Geometric2());
+    for (int i = 0; i < kSize; i++) {
+      array.EmplaceBack(32, 'x');  // строка вне SSO - копирование при расширении стоило бы аллокации
+    }
+    return array.size();
+  };
+}
@@ -0,0 +1,124 @@
+#include <catch2/catch.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <unistd.h>  // lseek, ftruncate
+
+#include <algorithm>  // max
+#include <chrono>     // steady_clock, duration
+#include <cstdio>     // tmpfile, fclose, fileno, fwrite, fflush, rewind
+#include <iomanip>    // setw, setprecision
+#include <iostream>   // cout
+#include <string>     // string
+
+#include "assignment/array_stack.hpp"    // ArrayStack
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/linked_list.hpp"    // LinkedList
+#include "assignment/linked_queue.hpp"   // LinkedQueue
+
+using assignment::ArrayStack;
+using assignment::DynamicArray;
+using assignment::LinkedList;
+using assignment::LinkedQueue;
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  constexpr int kRepetitions = 5;
+
+  // временный файл, удаляемый при закрытии
+  struct TempFile {
+    std::FILE* file{std::tmpfile()};
+    int fd{::fileno(file)};
+
+    ~TempFile() {
+      std::fclose(file);
+    }
+
+    void Reset() const {
+      ::lseek(fd, 0, SEEK_SET);
+      ::ftruncate(fd, 0);
+    }
+
+    void Rewind() const {
+      ::lseek(fd, 0, SEEK_SET);
+    }
+  };
+
+  // лучшая пропускная способность (ГБ/с) из kRepetitions запусков
+  template <typename Prepare, typename Run>
+  double Throughput(int count, Prepare prepare, Run run) {
+    double best = 0.0;
+    for (int i = 0; i < kRepetitions; i++) {
+      prepare();
+      const auto start = Clock::now();
+      run();
+      const std::chrono::duration<double> elapsed = Clock::now() - start;
+      const double bytes = static_cast<double>(count) * sizeof(int);
+      best = std::max(best, bytes / elapsed.count() / 1e9);
+    }
+    return best;
+  }
+
+  void Report(const std::string& name, double save, double load = -1.0) {
+    std::cout << "  " << std::setw(32) << std::left << name << std::right << std::fixed << std::setprecision(2)
+              << " save " << std::setw(6) << save << " GB/s";
+    if (load >= 0.0) {
+      std::cout << "  load " << std::setw(6) << load << " GB/s";
+    }
+    std::cout << "\n";
+  }
+
+  // сохранение и загрузка контейнера через временный файл (кэш страниц прогрет)
+  template <typename Container>
+  void Measure(const std::string& name, const Container& container, int count) {
+    const TempFile file;
+    const double save = Throughput(count, [&] { file.Reset(); }, [&] { container.Save(file.fd); });
+
+    Container loaded;
+    const double load = Throughput(count, [&] { file.Rewind(); loaded = Container(); }, [&] { loaded.Load(file.fd); });
+    REQUIRE(loaded.size() == count);
+
+    Report(name, save, load);
+  }
+
+}  // namespace
+
+// Пропускная способность Save/Load. Для сравнения - прежний способ: toVector и запись по одному элементу.
+TEST_CASE("Save/Load throughput", "[benchmark][binary_format]") {
+
+  for (int count : {1 << 16, 1 << 24}) {
+    auto array = DynamicArray(count);
+    auto stack = ArrayStack(count);
+    auto list = LinkedList();
+    auto queue = LinkedQueue();
+    for (int i = 0; i < count; i++) {
+      array.Add(i);
+      stack.Push(i);
+      list.Add(i);
+      queue.Enqueue(i);
+    }
+
+    std::cout << "\nSave/Load throughput, N = " << count << " (" << (count * sizeof(int) >> 20) << " MB):\n";
+
+    {
+      const TempFile file;
+      const double save = Throughput(count, [&] { file.Reset(); std::rewind(file.file); }, [&] {
+        const auto values = array.toVector(count);
+        for (int value : values) {
+          std::fwrite(&value, sizeof(value), 1, file.file);
+        }
+        std::fflush(file.file);
+      });
+      Report("toVector + fwrite per element", save);
+    }
+
+    Measure("DynamicArray (mmap)", array, count);
+    Measure("ArrayStack (mmap)", stack, count);
+    Measure("LinkedList (node block)", list, count);
+    Measure("LinkedQueue (node block)", queue, count);
+  }
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
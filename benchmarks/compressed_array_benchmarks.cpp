@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include <iomanip>   // setw, setprecision
+#include <iostream>  // cout
+#include <random>    // mt19937, uniform_int_distribution
+#include <string>    // string, to_string
+#include <vector>    // vector
+
+#include "assignment/compressed_array.hpp"  // CompressedArray
+#include "assignment/dynamic_array.hpp"     // DynamicArray
+
+using assignment::CompressedArray;
+using assignment::DynamicArray;
+
+namespace {
+
+  constexpr int kSize = 1 << 24;  // 64 МБ значений int
+
+  std::vector<int> RandomValues(int count, int lo, int hi) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(lo, hi);
+    std::vector<int> values(static_cast<std::size_t>(count));
+    for (int& value : values) {
+      value = distribution(engine);
+    }
+    return values;
+  }
+
+}  // namespace
+
+// Память и последовательный проход: значения малого диапазона (счетчики, идентификаторы внутри шарда).
+TEST_CASE("CompressedArray scans", "[benchmark][compressed_array]") {
+
+  for (int range : {1 << 8, 1 << 12, 1 << 20}) {
+    const auto values = RandomValues(kSize, 1'000'000, 1'000'000 + range - 1);
+
+    auto plain = DynamicArray(kSize);
+    plain.AddRange(values.data(), kSize);
+
+    auto compressed = CompressedArray();
+    compressed.AddRange(values.data(), kSize);
+    compressed.ShrinkToFit();
+
+    const double ratio = static_cast<double>(plain.capacity()) * sizeof(int) /
+                         static_cast<double>(compressed.memory_usage());
+    std::cout << "\nrange " << range << ": DynamicArray " << (static_cast<std::size_t>(plain.capacity()) * sizeof(int) >> 20)
+              << " MB, CompressedArray " << (compressed.memory_usage() >> 20) << " MB (x" << std::fixed
+              << std::setprecision(1) << ratio << ")\n";
+
+    const std::string suffix = ", range " + std::to_string(range);
+    const int value = 1'000'000 + range / 2;  // присутствует в каждом блоке диапазона
+    const int missing = 1'000'000 + range;    // вне диапазона значений
+
+    BENCHMARK("DynamicArray Count" + suffix) {
+      return plain.Count(value);
+    };
+
+    BENCHMARK("CompressedArray Count" + suffix) {
+      return compressed.Count(value);
+    };
+
+    BENCHMARK("DynamicArray Contains (missing)" + suffix) {
+      return plain.Contains(missing);
+    };
+
+    BENCHMARK("CompressedArray Contains (missing, blocks skipped)" + suffix) {
+      return compressed.Contains(missing);
+    };
+
+    std::vector<int> out(static_cast<std::size_t>(kSize));
+
+    BENCHMARK("CompressedArray Decode" + suffix) {
+      return compressed.Decode(0, kSize, out.data());
+    };
+  }
+}
+
+// Добавление: упаковка блока при заполнении против записи в массив.
+TEST_CASE("CompressedArray::Add", "[benchmark][compressed_array]") {
+
+  const auto values = RandomValues(1'000'000, 0, 4095);
+
+  BENCHMARK("DynamicArray Add, N = 1000000") {
+    auto array = DynamicArray();
+    array.set_growth_policy(assignment::GrowthPolicy::Geometric2());
+    for (int value : values) {
+      array.Add(value);
+    }
+    return array.size();
+  };
+
+  BENCHMARK("CompressedArray Add, N = 1000000") {
+    auto array = CompressedArray();
+    for (int value : values) {
+      array.Add(value);
+    }
+    return array.size();
+  };
+}
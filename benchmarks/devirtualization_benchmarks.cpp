@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+
+#include <string>  // string, to_string
+
+#include "assignment/array_stack.hpp"           // ArrayStack
+#include "assignment/dynamic_array.hpp"         // DynamicArray
+#include "assignment/static_array_stack.hpp"    // StaticArrayStack
+#include "assignment/static_dynamic_array.hpp"  // StaticDynamicArray
+#include "assignment/virtual_adapters.hpp"      // ListAdapter, StackAdapter
+
+using assignment::ArrayStack;
+using assignment::DynamicArray;
+using assignment::List;
+using assignment::ListAdapter;
+using assignment::Stack;
+using assignment::StackAdapter;
+using assignment::StaticArrayStack;
+using assignment::StaticDynamicArray;
+
+namespace {
+
+  constexpr int kOperations = 1'000'000;
+
+  // Скрывает от компилятора динамический тип объекта (иначе вызовы через базовый класс девиртуализируются).
+  template <typename T>
+  T& Opaque(T& object) {
+    T* pointer = &object;
+    asm volatile("" : "+r"(pointer));
+    return *pointer;
+  }
+
+  // Push + Peek + Pop на горячем пути (емкость зарезервирована, память не выделяется).
+  template <typename StackType>
+  long long PushPeekPop(StackType& stack) {
+    long long sum = 0;
+    for (int i = 0; i < kOperations; i++) {
+      stack.Push(i);
+      sum += *stack.Peek();
+      stack.Pop();
+    }
+    return sum;
+  }
+
+  template <typename ListType>
+  long long SumByGet(const ListType& list) {
+    long long sum = 0;
+    for (int i = 0; i < list.size(); i++) {
+      sum += *list.Get(i);
+    }
+    return sum;
+  }
+
+}  // namespace
+
+// Стоимость виртуальной диспетчеризации и вызовов из библиотеки для тривиальных операций.
+TEST_CASE("Virtual vs static dispatch", "[benchmark][devirtualization]") {
+  const std::string suffix = ", " + std::to_string(kOperations) + " ops";
+
+  auto array_stack = ArrayStack(16);
+  auto static_stack = StaticArrayStack(16);
+  auto stack_adapter = StackAdapter<StaticArrayStack>(16);
+
+  BENCHMARK("ArrayStack via Stack&" + suffix) {
+    return PushPeekPop(Opaque<Stack>(array_stack));
+  };
+
+  BENCHMARK("StackAdapter<StaticArrayStack> via Stack&" + suffix) {
+    return PushPeekPop(Opaque<Stack>(stack_adapter));
+  };
+
+  BENCHMARK("StaticArrayStack" + suffix) {
+    return PushPeekPop(Opaque(static_stack));
+  };
+
+  auto dynamic_array = DynamicArray(kOperations);
+  auto static_array = StaticDynamicArray(kOperations);
+  auto list_adapter = ListAdapter<StaticDynamicArray>(kOperations);
+  for (int i = 0; i < kOperations; i++) {
+    dynamic_array.Add(i);
+    static_array.Add(i);
+    list_adapter.Add(i);
+  }
+
+  BENCHMARK("DynamicArray Get via List&" + suffix) {
+    return SumByGet(Opaque<List>(dynamic_array));
+  };
+
+  BENCHMARK("ListAdapter<StaticDynamicArray> Get via List&" + suffix) {
+    return SumByGet(Opaque<List>(list_adapter));
+  };
+
+  BENCHMARK("StaticDynamicArray Get" + suffix) {
+    return SumByGet(Opaque(static_array));
+  };
+}
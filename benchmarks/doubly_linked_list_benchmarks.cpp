@@ -0,0 +1,134 @@
+#include <catch2/catch.hpp>
+
+#include <random>         // mt19937, uniform_int_distribution
+#include <string>         // to_string
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "assignment/doubly_linked_list.hpp"  // DoublyLinkedList
+#include "assignment/linked_list.hpp"         // LinkedList
+#include "assignment/node.hpp"                // DoubleNode
+
+using assignment::DoubleNode;
+using assignment::DoublyLinkedList;
+using assignment::LinkedList;
+
+namespace {
+
+  constexpr int kOperations = 10'000;  // кол-во операций в одном замере
+
+  template <typename List>
+  List MakeList(int size) {
+    auto list = List();
+    for (int i = 0; i < size; i++) {
+      list.Add(i);
+    }
+    return list;
+  }
+
+  // очередь в обратном направлении: добавление в начало, удаление с конца
+  int PushFrontPopBack(LinkedList& list) {
+    for (int i = 0; i < kOperations; i++) {
+      list.Insert(0, i);
+      list.Remove(list.size() - 1);
+    }
+    return list.size();
+  }
+
+  int PushFrontPopBack(DoublyLinkedList& list) {
+    for (int i = 0; i < kOperations; i++) {
+      list.AddFront(i);
+      list.RemoveBack();
+    }
+    return list.size();
+  }
+
+  // обращения к ключам кэша: примерно половина ключей помещается в кэш
+  std::vector<int> MakeKeys(int capacity) {
+    auto engine = std::mt19937(42);
+    auto key = std::uniform_int_distribution<>(0, 2 * capacity - 1);
+    std::vector<int> keys(kOperations);
+    for (int& k : keys) {
+      k = key(engine);
+    }
+    return keys;
+  }
+
+  // LRU-кэш на LinkedList: поиск ключа просмотром, перенос в начало - удаление и вставка по индексу
+  int LruLinkedList(const std::vector<int>& keys, int capacity) {
+    auto cache = LinkedList();
+    int hits = 0;
+    for (int key : keys) {
+      const auto index = cache.IndexOf(key);
+      if (index.has_value()) {
+        hits++;
+        cache.Remove(*index);
+      } else if (cache.size() == capacity) {
+        cache.Remove(cache.size() - 1);
+      }
+      cache.Insert(0, key);
+    }
+    return hits;
+  }
+
+  // LRU-кэш на DoublyLinkedList: узел ключа из хеш-таблицы, перенос в начало и вытеснение с конца ~ O(1)
+  int LruDoublyLinkedList(const std::vector<int>& keys, int capacity) {
+    auto cache = DoublyLinkedList();
+    auto nodes = std::unordered_map<int, DoubleNode*>();
+    nodes.reserve(static_cast<std::size_t>(capacity));
+    int hits = 0;
+    for (int key : keys) {
+      const auto found = nodes.find(key);
+      if (found != nodes.end()) {
+        hits++;
+        cache.MoveToFront(found->second);
+        continue;
+      }
+      if (cache.size() == capacity) {
+        nodes.erase(cache.back_node()->value);
+        cache.RemoveBack();
+      }
+      cache.AddFront(key);
+      nodes[key] = cache.front_node();
+    }
+    return hits;
+  }
+
+}  // namespace
+
+// Дек: добавление в начало и удаление с конца. У LinkedList удаление с конца ищет предпоследний узел.
+TEST_CASE("DoublyLinkedList deque access", "[benchmark][doubly_linked_list]") {
+
+  for (int size : {100, 10'000}) {
+    auto linked = MakeList<LinkedList>(size);
+    auto doubly = MakeList<DoublyLinkedList>(size);
+    const std::string suffix = " x " + std::to_string(kOperations) + ", N = " + std::to_string(size);
+
+    BENCHMARK("LinkedList Insert(0) + Remove(size - 1)" + suffix) {
+      return PushFrontPopBack(linked);
+    };
+
+    BENCHMARK("DoublyLinkedList AddFront + RemoveBack" + suffix) {
+      return PushFrontPopBack(doubly);
+    };
+  }
+}
+
+// LRU-кэш: перенос найденного ключа в начало, вытеснение самого старого ключа с конца.
+TEST_CASE("DoublyLinkedList LRU cache", "[benchmark][doubly_linked_list]") {
+
+  for (int capacity : {100, 1'000}) {
+    const auto keys = MakeKeys(capacity);
+    const std::string suffix = " x " + std::to_string(kOperations) + ", capacity = " + std::to_string(capacity);
+
+    REQUIRE(LruLinkedList(keys, capacity) == LruDoublyLinkedList(keys, capacity));
+
+    BENCHMARK("LinkedList (IndexOf, Remove, Insert)" + suffix) {
+      return LruLinkedList(keys, capacity);
+    };
+
+    BENCHMARK("DoublyLinkedList (hash map of nodes, MoveToFront)" + suffix) {
+      return LruDoublyLinkedList(keys, capacity);
+    };
+  }
+}
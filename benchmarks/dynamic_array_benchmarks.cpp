@@ -0,0 +1,80 @@
+#include <catch2/catch.hpp>
+
+#include <string>  // to_string
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+
+using assignment::DynamicArray;
+using assignment::GrowthPolicy;
+
+namespace {
+
+  int FillArray(int size, const GrowthPolicy& policy) {
+    auto array = DynamicArray(DynamicArray::kInitCapacity, policy);
+    for (int i = 0; i < size; i++) {
+      array.Add(i);
+    }
+    return array.capacity();
+  }
+
+}  // namespace
+
+// Амортизированная стоимость Add: время серии из N добавлений должно расти линейно по N
+// для геометрических политик и квадратично - для аддитивной.
+TEST_CASE("DynamicArray::Add growth policies", "[benchmark][dynamic_array]") {
+
+  BENCHMARK("additive, N = 10'000") {
+    return FillArray(10'000, GrowthPolicy::Additive());
+  };
+
+  BENCHMARK("additive, N = 100'000") {
+    return FillArray(100'000, GrowthPolicy::Additive());
+  };
+
+  for (int size : {100'000, 1'000'000, 10'000'000}) {
+    BENCHMARK("geometric x1.5, N = " + std::to_string(size)) {
+      return FillArray(size, GrowthPolicy::Geometric15());
+    };
+
+    BENCHMARK("geometric x2, N = " + std::to_string(size)) {
+      return FillArray(size, GrowthPolicy::Geometric2());
+    };
+
+    BENCHMARK("custom x4, N = " + std::to_string(size)) {
+      return FillArray(size, GrowthPolicy::Custom([](int capacity) { return capacity * 4; }));
+    };
+  }
+}
+
+// Вставка блока из K элементов: K вызовов Insert (K сдвигов хвоста) против одного InsertRange.
+TEST_CASE("DynamicArray::InsertRange vs Insert", "[benchmark][dynamic_array]") {
+  constexpr int kSize = 100'000;
+
+  for (int count : {10, 1'000, 10'000}) {
+    auto block = DynamicArray(count);
+    for (int i = 0; i < count; i++) {
+      block.Add(i);
+    }
+    const auto values = block.toVector(count);
+
+    BENCHMARK_ADVANCED("Insert x " + std::to_string(count))(Catch::Benchmark::Chronometer meter) {
+      auto array = DynamicArray(kSize + count, GrowthPolicy::Geometric2());
+      array.Assign(kSize, 0);
+      meter.measure([&] {
+        for (int i = 0; i < count; i++) {
+          array.Insert(kSize / 2 + i, values[static_cast<std::size_t>(i)]);
+        }
+        return array.size();
+      });
+    };
+
+    BENCHMARK_ADVANCED("InsertRange x " + std::to_string(count))(Catch::Benchmark::Chronometer meter) {
+      auto array = DynamicArray(kSize + count, GrowthPolicy::Geometric2());
+      array.Assign(kSize, 0);
+      meter.measure([&] {
+        array.InsertRange(kSize / 2, values.data(), count);
+        return array.size();
+      });
+    };
+  }
+}
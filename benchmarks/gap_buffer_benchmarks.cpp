@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // max, min
+#include <memory>     // make_unique, unique_ptr
+#include <random>     // mt19937, uniform_int_distribution
+#include <string>     // string, to_string
+#include <vector>     // vector
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/gap_buffer.hpp"     // GapBuffer
+
+using assignment::DynamicArray;
+using assignment::GapBuffer;
+
+namespace {
+
+  constexpr int kEdits = 100'000;  // кол-во правок в трассе
+
+  // правка документа: вставка или удаление в позиции курсора
+  struct Edit {
+    int index;
+    bool insert;
+  };
+
+  // Трасса редактора: курсор блуждает на несколько позиций, изредка перескакивает в случайное место,
+  // вставки преобладают над удалениями (набор текста с исправлениями).
+  std::vector<Edit> MakeTrace(int document_size) {
+    auto engine = std::mt19937(42);
+    auto trace = std::vector<Edit>();
+    trace.reserve(kEdits);
+
+    int size = document_size;
+    int cursor = size / 2;
+    for (int i = 0; i < kEdits; i++) {
+      if (engine() % 1000 == 0) {
+        cursor = std::uniform_int_distribution<>(0, size)(engine);
+      } else {
+        cursor = std::uniform_int_distribution<>(std::max(0, cursor - 4), std::min(size, cursor + 4))(engine);
+      }
+
+      const bool insert = (size == 0)||(cursor == size)||(engine() % 4 != 0);
+      trace.push_back({cursor, insert});
+      size += insert ? 1 : -1;
+      cursor += insert ? 1 : 0;
+    }
+    return trace;
+  }
+
+  template <typename Document>
+  int Replay(Document& document, const std::vector<Edit>& trace) {
+    for (const Edit& edit : trace) {
+      if (edit.insert) {
+        document.Insert(edit.index, edit.index);
+      } else {
+        document.Remove(edit.index);
+      }
+    }
+    return document.size();
+  }
+
+}  // namespace
+
+// Воспроизведение трассы правок вокруг курсора в документах разного размера.
+TEST_CASE("GapBuffer cursor-edit trace", "[benchmark][gap_buffer]") {
+
+  for (int document_size : {1'000, 100'000, 1'000'000}) {
+    const auto trace = MakeTrace(document_size);
+    const std::string suffix = ", document = " + std::to_string(document_size);
+
+    // документы создаются заранее, каждое измерение воспроизводит трассу на своем документе
+    BENCHMARK_ADVANCED("DynamicArray" + suffix)(Catch::Benchmark::Chronometer meter) {
+      std::vector<std::unique_ptr<DynamicArray>> documents;
+      for (int run = 0; run < meter.runs(); run++) {
+        documents.push_back(std::make_unique<DynamicArray>(document_size + kEdits));
+        documents.back()->Assign(document_size, 0);
+      }
+      meter.measure([&](int run) { return Replay(*documents[static_cast<std::size_t>(run)], trace); });
+    };
+
+    BENCHMARK_ADVANCED("GapBuffer" + suffix)(Catch::Benchmark::Chronometer meter) {
+      std::vector<std::unique_ptr<GapBuffer>> documents;
+      for (int run = 0; run < meter.runs(); run++) {
+        documents.push_back(std::make_unique<GapBuffer>(document_size + kEdits));
+        for (int i = 0; i < document_size; i++) {
+          documents.back()->Add(0);
+        }
+      }
+      meter.measure([&](int run) { return Replay(*documents[static_cast<std::size_t>(run)], trace); });
+    };
+  }
+}
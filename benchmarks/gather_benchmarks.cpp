@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+
+#include <random>  // mt19937, uniform_int_distribution
+#include <string>  // string, to_string
+#include <vector>  // vector
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/linked_list.hpp"    // LinkedList
+#include "assignment/simd.hpp"           // Gather, Isa
+
+using assignment::DynamicArray;
+using assignment::LinkedList;
+using assignment::List;
+
+namespace {
+
+  constexpr int kBatch = 4096;  // кол-во индексов в одном запросе
+
+  std::vector<int> RandomValues(int count, int lo, int hi) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(lo, hi);
+    std::vector<int> values(static_cast<std::size_t>(count));
+    for (int& value : values) {
+      value = distribution(engine);
+    }
+    return values;
+  }
+
+}  // namespace
+
+// Выборка случайных индексов: Get по одному элементу против GetMany.
+TEST_CASE("DynamicArray::GetMany", "[benchmark][gather]") {
+
+  for (int size : {1'000'000, 64'000'000}) {
+    auto array = DynamicArray(size);
+    array.Assign(size, 1);
+    const DynamicArray& const_array = array;
+    const List& list = array;
+
+    const auto indices = RandomValues(kBatch, 0, size - 1);
+    std::vector<int> out(kBatch);
+
+    const std::string suffix = ", " + std::to_string(kBatch) + " of " + std::to_string(size);
+
+    BENCHMARK("Get via List&" + suffix) {
+      long long sum = 0;
+      for (int index : indices) {
+        sum += *list.Get(index);
+      }
+      return sum;
+    };
+
+    BENCHMARK("GetMany" + suffix) {
+      return const_array.GetMany(indices.data(), kBatch, out.data());
+    };
+
+    BENCHMARK("GetMany (scalar kernel)" + suffix) {
+      assignment::simd::Gather(assignment::simd::Isa::kScalar, const_array.span().data(), indices.data(), kBatch, out.data());
+      return out[0];
+    };
+
+    const auto values = RandomValues(kBatch, 0, 100);
+
+    BENCHMARK("Set" + suffix) {
+      bool ok = true;
+      for (int i = 0; i < kBatch; i++) {
+        ok &= array.Set(indices[static_cast<std::size_t>(i)], values[static_cast<std::size_t>(i)]);
+      }
+      return ok;
+    };
+
+    BENCHMARK("SetMany" + suffix) {
+      return array.SetMany(indices.data(), values.data(), kBatch);
+    };
+  }
+}
+
+// Выборка случайных индексов из связного списка: проход от начала для каждого индекса против одного прохода.
+TEST_CASE("LinkedList::GetMany", "[benchmark][gather]") {
+  const int size = 100'000;
+  const auto list = LinkedList(RandomValues(size, 0, 100));
+
+  for (int count : {16, 256}) {
+    const auto indices = RandomValues(count, 0, size - 1);
+    std::vector<int> out(static_cast<std::size_t>(count));
+
+    const std::string suffix = ", " + std::to_string(count) + " of " + std::to_string(size);
+
+    BENCHMARK("Get" + suffix) {
+      long long sum = 0;
+      for (int index : indices) {
+        sum += *list.Get(index);
+      }
+      return sum;
+    };
+
+    BENCHMARK("GetMany" + suffix) {
+      return list.GetMany(indices.data(), count, out.data());
+    };
+  }
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+
+#include <chrono>    // steady_clock, duration
+#include <iomanip>   // setw, setprecision
+#include <iostream>  // cout
+#include <string>    // to_string
+#include <vector>    // vector
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+
+using assignment::DynamicArray;
+using assignment::GrowthPolicy;
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  // значения с повторами: примерно половина различных
+  std::vector<int> MakeValues(int count) {
+    std::vector<int> values(static_cast<std::size_t>(count));
+    unsigned state = 12345;
+    for (int& value : values) {
+      state = state * 1103515245u + 12345u;
+      value = static_cast<int>((state >> 8) % static_cast<unsigned>(count / 2 + 1));
+    }
+    return values;
+  }
+
+  // удаление повторов: Contains + Add для каждого значения
+  int Deduplicate(const std::vector<int>& values, bool indexed) {
+    auto unique = DynamicArray(DynamicArray::kInitCapacity, GrowthPolicy::Geometric2());
+    if (indexed) {
+      unique.EnableHashIndex();
+    }
+    for (int value : values) {
+      if (!unique.Contains(value)) {
+        unique.Add(value);
+      }
+    }
+    return unique.size();
+  }
+
+  // среднее время одного поиска (нс) по массиву из size различных значений
+  double LookupTime(const DynamicArray& array, int size) {
+    constexpr int kLookups = 1 << 16;
+    int found = 0;
+    const auto start = Clock::now();
+    for (int i = 0; i < kLookups; i++) {
+      // равномерно по позициям: в среднем просматривается половина массива
+      found += array.Contains(static_cast<int>((static_cast<unsigned>(i) * 2654435761u) % static_cast<unsigned>(size)));
+    }
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    REQUIRE(found == kLookups);
+    return elapsed.count() / kLookups;
+  }
+
+}  // namespace
+
+// Стоимость поиска по значению: просмотр массива (SIMD) против хеш-индекса, накладные расходы памяти.
+// Точка окупаемости - размер, начиная с которого поиск по индексу быстрее просмотра.
+TEST_CASE("DynamicArray hash index lookup crossover", "[benchmark][hash_index]") {
+  std::cout << "\nContains, ns per lookup (distinct values):\n"
+            << std::setw(10) << "size" << std::setw(12) << "scan" << std::setw(12) << "hash index"
+            << std::setw(18) << "index bytes/elem" << "\n";
+
+  for (int size = 4; size <= (1 << 20); size *= 4) {
+    auto array = DynamicArray(size);
+    for (int i = 0; i < size; i++) {
+      array.Add(i);
+    }
+    const double scan = LookupTime(array, size);
+    array.EnableHashIndex();
+    const double indexed = LookupTime(array, size);
+
+    std::cout << std::setw(10) << size << std::fixed << std::setprecision(1) << std::setw(12) << scan
+              << std::setw(12) << indexed << std::setw(18)
+              << static_cast<double>(array.hash_index_memory_usage()) / size << "\n";
+  }
+}
+
+// Удаление повторов вызовами Contains + Add: O(n^2) просмотром, O(n) с хеш-индексом.
+TEST_CASE("DynamicArray hash index deduplication", "[benchmark][hash_index]") {
+
+  for (int count : {1'000, 10'000, 100'000}) {
+    const auto values = MakeValues(count);
+
+    BENCHMARK("scan, N = " + std::to_string(count)) {
+      return Deduplicate(values, false);
+    };
+
+    BENCHMARK("hash index, N = " + std::to_string(count)) {
+      return Deduplicate(values, true);
+    };
+  }
+}
+
+// Стоимость поддержки индекса при изменениях массива.
+// Set, перезаписывающий первое вхождение значения, ищет следующее вхождение просмотром.
+TEST_CASE("DynamicArray hash index maintenance", "[benchmark][hash_index]") {
+  constexpr int kSize = 100'000;
+  const auto values = MakeValues(kSize);
+
+  for (bool indexed : {false, true}) {
+    const std::string suffix = indexed ? " (hash index)" : "";
+
+    BENCHMARK("Add x " + std::to_string(kSize) + suffix) {
+      auto array = DynamicArray(DynamicArray::kInitCapacity, GrowthPolicy::Geometric2());
+      if (indexed) {
+        array.EnableHashIndex();
+      }
+      for (int value : values) {
+        array.Add(value);
+      }
+      return array.size();
+    };
+
+    BENCHMARK_ADVANCED("Set x " + std::to_string(kSize) + suffix)(Catch::Benchmark::Chronometer meter) {
+      auto array = DynamicArray(kSize);
+      array.AddRange(values.data(), kSize);
+      if (indexed) {
+        array.EnableHashIndex();
+      }
+      meter.measure([&] {
+        for (int i = 0; i < kSize; i++) {
+          array.Set(i, values[static_cast<std::size_t>(kSize - 1 - i)]);
+        }
+        return array.size();
+      });
+    };
+  }
+}
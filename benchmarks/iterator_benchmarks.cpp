@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include <numeric>  // accumulate
+#include <string>   // string, to_string
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/linked_list.hpp"    // LinkedList
+
+using assignment::DynamicArray;
+using assignment::LinkedList;
+
+// Сумма элементов: виртуальный Get(i) с optional против итераторов и непрерывного представления.
+TEST_CASE("Iterators vs Get", "[benchmark][iterator]") {
+
+  for (int size : {1'000, 1'000'000}) {
+    auto array = DynamicArray(size);
+    for (int i = 0; i < size; i++) {
+      array.Add(i % 100);
+    }
+    const DynamicArray& const_array = array;
+    const assignment::List& list = array;
+
+    const std::string suffix = ", N = " + std::to_string(size);
+
+    BENCHMARK("DynamicArray Get (virtual)" + suffix) {
+      long long sum = 0;
+      for (int i = 0; i < list.size(); i++) {
+        sum += *list.Get(i);
+      }
+      return sum;
+    };
+
+    BENCHMARK("DynamicArray iterators" + suffix) {
+      long long sum = 0;
+      for (int value : const_array) {
+        sum += value;
+      }
+      return sum;
+    };
+
+    BENCHMARK("DynamicArray span + accumulate" + suffix) {
+      const auto span = const_array.span();
+      return std::accumulate(span.begin(), span.end(), 0LL);
+    };
+  }
+
+  // последовательный Get(i) продолжает поиск от предыдущего узла (палец): O(n) на весь проход
+  for (int size : {1'000, 10'000, 1'000'000}) {
+    auto list = LinkedList();
+    for (int i = 0; i < size; i++) {
+      list.Add(i % 100);
+    }
+    const LinkedList& const_list = list;
+
+    const std::string suffix = ", N = " + std::to_string(size);
+
+    BENCHMARK("LinkedList Get" + suffix) {
+      long long sum = 0;
+      for (int i = 0; i < const_list.size(); i++) {
+        sum += *const_list.Get(i);
+      }
+      return sum;
+    };
+
+    BENCHMARK("LinkedList iterators" + suffix) {
+      long long sum = 0;
+      for (int value : const_list) {
+        sum += value;
+      }
+      return sum;
+    };
+  }
+}
+
+// Вставка после каждого элемента: курсор против Insert по индексу (поиск от пальца).
+TEST_CASE("LinkedList cursor vs Insert", "[benchmark][iterator]") {
+
+  for (int size : {1'000, 100'000}) {
+    const std::string suffix = ", N = " + std::to_string(size);
+
+    BENCHMARK("LinkedList Insert(2 * i + 1)" + suffix) {
+      auto list = LinkedList();
+      for (int i = 0; i < size; i++) {
+        list.Add(i);
+      }
+      for (int i = 0; i < size; i++) {
+        list.Insert(2 * i + 1, -i);
+      }
+      return list.size();
+    };
+
+    BENCHMARK("LinkedList Cursor::InsertAfter" + suffix) {
+      auto list = LinkedList();
+      for (int i = 0; i < size; i++) {
+        list.Add(i);
+      }
+      for (auto cursor = list.cursor(); !cursor.IsEnd(); cursor.Next()) {
+        cursor.InsertAfter(-cursor.index());
+        cursor.Next();
+      }
+      return list.size();
+    };
+  }
+}
@@ -0,0 +1,55 @@
+#include <catch2/catch.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <filesystem>  // temp_directory_path, remove
+#include <string>      // string
+
+#include "assignment/dynamic_array.hpp"         // DynamicArray
+#include "assignment/mapped_dynamic_array.hpp"  // MappedDynamicArray
+
+using assignment::DynamicArray;
+using assignment::GrowthPolicy;
+using assignment::MappedDynamicArray;
+
+namespace {
+
+  constexpr int kElements = 10'000'000;  // ~40 МБ данных
+
+}  // namespace
+
+// Запуск сервиса: восстановление массива через Add против повторного открытия файла.
+TEST_CASE("MappedDynamicArray startup", "[benchmark][mapped_dynamic_array]") {
+
+  const std::string path = (std::filesystem::temp_directory_path() / "mapped_dynamic_array_benchmark.bin").string();
+  std::filesystem::remove(path);
+  {
+    auto array = MappedDynamicArray(path, kElements);
+    for (int i = 0; i < kElements; i++) {
+      array.Add(i);
+    }
+    array.Sync();
+  }
+
+  BENCHMARK("DynamicArray, rebuild through Add") {
+    auto array = DynamicArray(1, GrowthPolicy::Geometric2());
+    for (int i = 0; i < kElements; i++) {
+      array.Add(i);
+    }
+    return array.Get(kElements - 1);
+  };
+
+  BENCHMARK("MappedDynamicArray, reopen") {
+    const auto array = MappedDynamicArray(path);
+    return array.Get(kElements - 1);
+  };
+
+  BENCHMARK("MappedDynamicArray, reopen + full scan") {
+    const auto array = MappedDynamicArray(path);
+    return array.Contains(-1);
+  };
+
+  std::filesystem::remove(path);
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
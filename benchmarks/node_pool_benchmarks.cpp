@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>  // cout
+#include <string>    // to_string
+
+#include "allocation_counter.hpp"  // AllocationCount
+
+#include "assignment/linked_list.hpp"          // LinkedList
+#include "assignment/linked_queue.hpp"         // LinkedQueue
+#include "assignment/static_linked_queue.hpp"  // StaticLinkedQueue
+
+using assignment::LinkedList;
+using assignment::LinkedQueue;
+using assignment::StaticLinkedQueue;
+
+namespace {
+
+  constexpr int kBacklog = 1'000;         // кол-во элементов в очереди в устойчивом состоянии
+  constexpr int kOperations = 1'000'000;  // кол-во пар Enqueue/Dequeue
+
+  // устойчивая нагрузка: очередь постоянной длины, на каждое добавление - одно удаление
+  template <typename Queue>
+  long long SteadyState(Queue& queue) {
+    long long total = 0;
+    for (int i = 0; i < kOperations; i++) {
+      queue.Enqueue(i);
+      total += *queue.front();
+      queue.Dequeue();
+    }
+    return total;
+  }
+
+  template <typename Queue>
+  void Fill(Queue& queue) {
+    for (int i = 0; i < kBacklog; i++) {
+      queue.Enqueue(i);
+    }
+  }
+
+}  // namespace
+
+// Очередь постоянной длины: узел на каждую операцию из кучи (new/delete) против пула узлов.
+TEST_CASE("LinkedQueue node pool steady state", "[benchmark][node_pool]") {
+  auto heap_queue = StaticLinkedQueue();
+  auto pooled_queue = LinkedQueue();
+  Fill(heap_queue);
+  Fill(pooled_queue);
+
+  std::size_t before = benchmarks::AllocationCount();
+  SteadyState(heap_queue);
+  const std::size_t heap_allocations = benchmarks::AllocationCount() - before;
+
+  before = benchmarks::AllocationCount();
+  SteadyState(pooled_queue);
+  const std::size_t pool_allocations = benchmarks::AllocationCount() - before;
+
+  std::cout << "heap allocations for " << kOperations << " Enqueue/Dequeue pairs:\n"
+            << "  new/delete per node: " << heap_allocations << '\n'
+            << "  NodePool:            " << pool_allocations << '\n';
+
+  CHECK(pool_allocations == 0);
+
+  BENCHMARK("new/delete per node") {
+    return SteadyState(heap_queue);
+  };
+
+  BENCHMARK("NodePool") {
+    return SteadyState(pooled_queue);
+  };
+}
+
+// Заполнение и очистка списка: после первой очистки пул сохраняет наибольший блок.
+TEST_CASE("LinkedList node pool fill and clear", "[benchmark][node_pool]") {
+
+  for (int count : {1'000, 100'000}) {
+    auto list = LinkedList();
+
+    BENCHMARK("Add x " + std::to_string(count) + " + Clear") {
+      for (int i = 0; i < count; i++) {
+        list.Add(i);
+      }
+      const int size = list.size();
+      list.Clear();
+      return size;
+    };
+  }
+}
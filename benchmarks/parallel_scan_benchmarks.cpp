@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // max
+#include <string>     // string, to_string
+#include <vector>     // vector
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/thread_pool.hpp"    // ThreadPool
+
+using assignment::DynamicArray;
+using assignment::ThreadPool;
+
+namespace {
+
+  constexpr int kElements = 64'000'000;  // ~256 МБ, заведомо больше кэша последнего уровня
+
+  // 1, 2, 4, ... и кол-во аппаратных потоков
+  std::vector<int> ThreadCounts() {
+    std::vector<int> counts;
+    for (int threads = 1; threads < ThreadPool::DefaultThreads(); threads *= 2) {
+      counts.push_back(threads);
+    }
+    counts.push_back(ThreadPool::DefaultThreads());
+    return counts;
+  }
+
+}  // namespace
+
+// Масштабирование полного прохода (отсутствующее значение) и подсчета по кол-ву потоков.
+TEST_CASE("DynamicArray parallel scan", "[benchmark][parallel_scan]") {
+
+  auto array = DynamicArray(kElements);
+  array.Assign(kElements, 1);
+
+  BENCHMARK("IndexOf, sequential") {
+    return array.IndexOf(-1);
+  };
+
+  for (int threads : ThreadCounts()) {
+    auto pool = ThreadPool(threads);
+    array.set_thread_pool(&pool, 0);
+
+    const std::string suffix = ", threads = " + std::to_string(threads);
+
+    BENCHMARK("IndexOf" + suffix) {
+      return array.IndexOf(-1);
+    };
+
+    BENCHMARK("IndexOf, match in the first chunk" + suffix) {
+      return array.IndexOf(1);
+    };
+
+    BENCHMARK("Count" + suffix) {
+      return array.Count(1);
+    };
+
+    array.set_thread_pool(nullptr);
+  }
+}
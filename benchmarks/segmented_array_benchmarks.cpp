@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // nth_element, max_element
+#include <chrono>     // steady_clock, duration_cast
+#include <iomanip>    // setw
+#include <iostream>   // cout
+#include <string>     // string, to_string
+#include <vector>     // vector
+
+#include "assignment/dynamic_array.hpp"    // DynamicArray
+#include "assignment/segmented_array.hpp"  // SegmentedArray
+
+using assignment::DynamicArray;
+using assignment::GrowthPolicy;
+using assignment::SegmentedArray;
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  // Измерение времени каждого вызова Add в наносекундах.
+  template <typename Array>
+  std::vector<long long> AddLatencies(Array& array, int count) {
+    std::vector<long long> latencies(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; i++) {
+      const auto start = Clock::now();
+      array.Add(i);
+      const auto stop = Clock::now();
+      latencies[static_cast<std::size_t>(i)] =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    }
+    return latencies;
+  }
+
+  long long Percentile(std::vector<long long>& latencies, double fraction) {
+    const auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(fraction * static_cast<double>(latencies.size() - 1));
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return *nth;
+  }
+
+  void Report(const std::string& name, std::vector<long long> latencies) {
+    const long long p50 = Percentile(latencies, 0.5);
+    const long long p99 = Percentile(latencies, 0.99);
+    const long long p999 = Percentile(latencies, 0.999);
+    const long long max = *std::max_element(latencies.begin(), latencies.end());
+
+    std::cout << "  " << std::setw(24) << std::left << name << std::right
+              << " p50 " << std::setw(6) << p50 << " ns"
+              << "  p99 " << std::setw(6) << p99 << " ns"
+              << "  p999 " << std::setw(6) << p999 << " ns"
+              << "  max " << std::setw(10) << max << " ns\n";
+  }
+
+}  // namespace
+
+// Хвостовые задержки Add: удвоение емкости копирует все элементы, новый блок - только 4 КБ.
+TEST_CASE("SegmentedArray::Add tail latency", "[benchmark][segmented_array]") {
+
+  for (int size : {100'000, 10'000'000}) {
+    auto dynamic = DynamicArray(1, GrowthPolicy::Geometric2());
+    auto segmented = SegmentedArray();
+
+    std::cout << "\nAdd latency, N = " << size << ":\n";
+    Report("DynamicArray (x2)", AddLatencies(dynamic, size));
+    Report("SegmentedArray", AddLatencies(segmented, size));
+  }
+
+  for (int size : {1'000, 1'000'000}) {
+    const std::string suffix = ", N = " + std::to_string(size);
+
+    BENCHMARK("DynamicArray (x2) Add" + suffix) {
+      auto array = DynamicArray(1, GrowthPolicy::Geometric2());
+      for (int i = 0; i < size; i++) {
+        array.Add(i);
+      }
+      return array.size();
+    };
+
+    BENCHMARK("SegmentedArray Add" + suffix) {
+      auto array = SegmentedArray();
+      for (int i = 0; i < size; i++) {
+        array.Add(i);
+      }
+      return array.size();
+    };
+
+    auto dynamic = DynamicArray(size);
+    auto segmented = SegmentedArray();
+    for (int i = 0; i < size; i++) {
+      dynamic.Add(i);
+      segmented.Add(i);
+    }
+
+    BENCHMARK("DynamicArray Get (sequential)" + suffix) {
+      long long sum = 0;
+      for (int i = 0; i < size; i++) {
+        sum += *dynamic.Get(i);
+      }
+      return sum;
+    };
+
+    BENCHMARK("SegmentedArray Get (sequential)" + suffix) {
+      long long sum = 0;
+      for (int i = 0; i < size; i++) {
+        sum += *segmented.Get(i);
+      }
+      return sum;
+    };
+  }
+}
@@ -0,0 +1,29 @@
+#include <catch2/catch.hpp>
+
+#include <numeric>  // iota
+#include <string>   // string, to_string
+#include <vector>   // vector
+
+#include "assignment/simd.hpp"  // FindFirst, Isa
+
+using assignment::simd::FindFirst;
+using assignment::simd::Isa;
+
+// Поиск отсутствующего значения (полный проход) для каждого поддерживаемого набора инструкций.
+TEST_CASE("simd::FindFirst kernels", "[benchmark][simd]") {
+
+  for (int size : {1'000, 64'000, 1'000'000, 16'000'000}) {
+    auto data = std::vector<int>(static_cast<std::size_t>(size));
+    std::iota(data.begin(), data.end(), 0);
+
+    for (Isa isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+      if (!assignment::simd::IsSupported(isa)) {
+        continue;
+      }
+
+      BENCHMARK(std::string(assignment::simd::ToString(isa)) + ", N = " + std::to_string(size)) {
+        return FindFirst(isa, data.data(), size, -1);
+      };
+    }
+  }
+}
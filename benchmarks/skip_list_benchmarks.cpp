@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+
+#include <string>  // to_string
+
+#include "assignment/linked_list.hpp"  // LinkedList
+#include "assignment/skip_list.hpp"    // SkipList
+
+using assignment::LinkedList;
+using assignment::SkipList;
+
+namespace {
+
+  constexpr int kOperations = 20;  // кол-во операций по индексу в одном замере
+
+  template <typename List>
+  List MakeList(int size) {
+    auto list = List();
+    for (int i = 0; i < size; i++) {
+      list.Add(i);
+    }
+    return list;
+  }
+
+  // псевдослучайная позиция в [0, size)
+  int Position(int i, int size) {
+    return static_cast<int>((static_cast<unsigned>(i) * 2654435761u) % static_cast<unsigned>(size));
+  }
+
+  template <typename List>
+  long long RandomGet(const List& list) {
+    long long total = 0;
+    for (int i = 0; i < kOperations; i++) {
+      total += *list.Get(Position(i, list.size()));
+    }
+    return total;
+  }
+
+  // вставка и удаление в случайных позициях (размер списка не меняется)
+  template <typename List>
+  int RandomInsertRemove(List& list) {
+    for (int i = 0; i < kOperations; i++) {
+      list.Insert(Position(i, list.size()), -i);
+      list.Remove(Position(i + 1, list.size()));
+    }
+    return list.size();
+  }
+
+}  // namespace
+
+// Операции по индексу: проход от начала LinkedList ~ O(n) против спуска по уровням SkipList ~ O(log n).
+TEST_CASE("SkipList positional access", "[benchmark][skip_list]") {
+
+  for (int size : {1'000, 100'000, 1'000'000}) {
+    auto linked = MakeList<LinkedList>(size);
+    auto skip = MakeList<SkipList>(size);
+    const std::string suffix = " x " + std::to_string(kOperations) + ", N = " + std::to_string(size);
+
+    BENCHMARK("LinkedList::Get" + suffix) {
+      return RandomGet(linked);
+    };
+
+    BENCHMARK("SkipList::Get" + suffix) {
+      return RandomGet(skip);
+    };
+
+    BENCHMARK("LinkedList::Insert + Remove" + suffix) {
+      return RandomInsertRemove(linked);
+    };
+
+    BENCHMARK("SkipList::Insert + Remove" + suffix) {
+      return RandomInsertRemove(skip);
+    };
+  }
+}
+
+// Добавление в конец: без поиска у обоих списков.
+TEST_CASE("SkipList append", "[benchmark][skip_list]") {
+  constexpr int kSize = 100'000;
+
+  BENCHMARK("LinkedList::Add x " + std::to_string(kSize)) {
+    return MakeList<LinkedList>(kSize).size();
+  };
+
+  BENCHMARK("SkipList::Add x " + std::to_string(kSize)) {
+    return MakeList<SkipList>(kSize).size();
+  };
+}
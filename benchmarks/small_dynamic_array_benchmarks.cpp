@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+
+#include <iostream>  // cout
+
+#include "allocation_counter.hpp"  // AllocationCount
+
+#include "assignment/dynamic_array.hpp"        // DynamicArray
+#include "assignment/small_dynamic_array.hpp"  // SmallDynamicArray
+
+using assignment::DynamicArray;
+using assignment::SmallDynamicArray;
+
+namespace {
+
+  constexpr int kArrays = 1'000'000;  // кол-во создаваемых массивов
+  constexpr int kElements = 8;        // кол-во элементов в каждом массиве
+
+  template <typename Array>
+  int BuildArrays() {
+    int total = 0;
+    for (int i = 0; i < kArrays; i++) {
+      Array array;
+      for (int k = 0; k < kElements; k++) {
+        array.Add(k);
+      }
+      total += array.size();
+    }
+    return total;
+  }
+
+  template <typename Array>
+  std::size_t CountAllocations() {
+    const std::size_t before = benchmarks::AllocationCount();
+    BuildArrays<Array>();
+    return benchmarks::AllocationCount() - before;
+  }
+
+}  // namespace
+
+// Создание миллиона маленьких массивов: кол-во выделений памяти в куче и время создания.
+TEST_CASE("SmallDynamicArray construction", "[benchmark][small_dynamic_array]") {
+
+  const std::size_t dynamic_allocations = CountAllocations<DynamicArray>();
+  const std::size_t small_allocations = CountAllocations<SmallDynamicArray<16>>();
+
+  std::cout << "heap allocations for " << kArrays << " arrays of " << kElements << " elements:\n"
+            << "  DynamicArray:          " << dynamic_allocations << '\n'
+            << "  SmallDynamicArray<16>: " << small_allocations << '\n';
+
+  CHECK(small_allocations == 0);
+
+  BENCHMARK("DynamicArray, construct + 8 x Add") {
+    return BuildArrays<DynamicArray>();
+  };
+
+  BENCHMARK("SmallDynamicArray<16>, construct + 8 x Add") {
+    return BuildArrays<SmallDynamicArray<16>>();
+  };
+
+  BENCHMARK("DynamicArray, construct only") {
+    int total = 0;
+    for (int i = 0; i < kArrays; i++) {
+      DynamicArray array;
+      total += array.capacity();
+    }
+    return total;
+  };
+
+  BENCHMARK("SmallDynamicArray<16>, construct only") {
+    int total = 0;
+    for (int i = 0; i < kArrays; i++) {
+      SmallDynamicArray<16> array;
+      total += array.capacity();
+    }
+    return total;
+  };
+}
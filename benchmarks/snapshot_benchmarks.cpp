@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>        // max
+#include <iostream>         // cout
+#include <memory_resource>  // memory_resource, new_delete_resource
+#include <string>           // string, to_string
+#include <vector>           // vector
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+
+using assignment::DynamicArray;
+
+namespace {
+
+  constexpr int kSnapshots = 32;  // кол-во одновременно удерживаемых снимков
+
+  // ресурс, считающий текущий и пиковый объем выделенной памяти
+  struct MeteredResource : std::pmr::memory_resource {
+    std::size_t in_use{0};
+    std::size_t peak{0};
+
+   protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+      in_use += bytes;
+      peak = std::max(peak, in_use);
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+      in_use -= bytes;
+      std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+  };
+
+  // Отчетный цикл: снимок выдается после каждой пачки изменений, снимки удерживаются до конца цикла.
+  template <typename TakeSnapshot>
+  std::size_t PeakBytes(int size, TakeSnapshot take_snapshot) {
+    MeteredResource resource;
+    {
+      auto array = DynamicArray(size, &resource);
+      array.Assign(size, 1);
+
+      std::vector<DynamicArray> reports;
+      reports.reserve(kSnapshots);
+      for (int i = 0; i < kSnapshots; i++) {
+        reports.push_back(take_snapshot(array));
+        if (i % 8 == 7) {
+          array.Set(i, -1);  // изредка изменяемый массив
+        }
+      }
+    }
+    return resource.peak;
+  }
+
+}  // namespace
+
+// Выдача копий массива для отчетов: полная копия против снимка с копированием при записи.
+TEST_CASE("DynamicArray::Snapshot", "[benchmark][snapshot]") {
+
+  for (int size : {1'000, 1'000'000, 10'000'000}) {
+    auto array = DynamicArray(size);
+    array.Assign(size, 1);
+
+    const std::string suffix = ", N = " + std::to_string(size);
+
+    BENCHMARK("copy" + suffix) {
+      return DynamicArray(array).size();
+    };
+
+    BENCHMARK("Snapshot" + suffix) {
+      return array.Snapshot().size();
+    };
+
+    // снимок удерживается отчетом, первое изменение оригинала копирует буфер
+    BENCHMARK_ADVANCED("Snapshot + first write" + suffix)(Catch::Benchmark::Chronometer meter) {
+      meter.measure([&] {
+        const auto snapshot = array.Snapshot();
+        array.Set(0, 2);
+        return snapshot.size();
+      });
+    };
+
+    // снимок уже уничтожен к моменту изменения - копирования нет
+    BENCHMARK("Snapshot, dropped + write" + suffix) {
+      array.Snapshot();
+      return array.Set(0, 3);
+    };
+  }
+
+  const int size = 1'000'000;
+  const std::size_t copy_peak = PeakBytes(size, [](const DynamicArray& array) { return DynamicArray(array); });
+  const std::size_t snapshot_peak = PeakBytes(size, [](const DynamicArray& array) { return array.Snapshot(); });
+
+  std::cout << "\npeak memory with " << kSnapshots << " reports of " << size << " elements (4 writes):\n"
+            << "  copy:     " << copy_peak / 1024 << " KiB\n"
+            << "  Snapshot: " << snapshot_peak / 1024 << " KiB\n";
+
+  CHECK(snapshot_peak < copy_peak);
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // lower_bound
+#include <random>     // mt19937, uniform_int_distribution
+#include <string>     // string, to_string
+#include <vector>     // vector
+
+#include "assignment/simd.hpp"                  // FindFirst
+#include "assignment/sorted_dynamic_array.hpp"  // SortedDynamicArray
+
+using assignment::SortedDynamicArray;
+
+namespace {
+
+  constexpr int kQueries = 1024;  // кол-во заранее сгенерированных искомых значений
+
+  // Поиск случайных (присутствующих и отсутствующих) значений:
+  // линейный проход (DynamicArray::IndexOf), std::lower_bound и двоичный поиск без ветвлений.
+  void RunSearchBenchmarks(int size) {
+    auto array = SortedDynamicArray(size);
+    {
+      auto values = std::vector<int>(static_cast<std::size_t>(size));
+      for (int i = 0; i < size; i++) {
+        values[static_cast<std::size_t>(i)] = 2 * i;  // четные значения, нечетные отсутствуют
+      }
+      array.InsertSorted(values.data(), size);
+    }
+
+    auto engine = std::mt19937(42);
+    auto dist = std::uniform_int_distribution<>(0, 2 * size - 1);
+
+    auto keys = std::vector<int>(kQueries);
+    for (int& key : keys) {
+      key = dist(engine);
+    }
+
+    const std::string suffix = ", N = " + std::to_string(size);
+    const int* data = array.data();
+    std::size_t next = 0;
+
+    BENCHMARK("linear scan (simd)" + suffix) {
+      return assignment::simd::FindFirst(data, size, keys[next++ % kQueries]);
+    };
+
+    BENCHMARK("std::lower_bound" + suffix) {
+      return std::lower_bound(data, data + size, keys[next++ % kQueries]) - data;
+    };
+
+    BENCHMARK("SortedDynamicArray::IndexOf" + suffix) {
+      return array.IndexOf(keys[next++ % kQueries]);
+    };
+  }
+
+}  // namespace
+
+TEST_CASE("SortedDynamicArray::IndexOf", "[benchmark][sorted_dynamic_array]") {
+
+  for (int size : {1'000, 1'000'000}) {
+    RunSearchBenchmarks(size);
+  }
+}
+
+// 100M элементов (~400 МБ), запускается явно: run_benchmarks "[sorted_dynamic_array][large]"
+TEST_CASE("SortedDynamicArray::IndexOf (100M)", "[.][benchmark][sorted_dynamic_array][large]") {
+  RunSearchBenchmarks(100'000'000);
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch.hpp>
+
+#include <random>  // mt19937, uniform_int_distribution
+#include <string>  // string, to_string
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/tiered_vector.hpp"  // TieredVector
+
+using assignment::DynamicArray;
+using assignment::TieredVector;
+
+namespace {
+
+  // Вставка и удаление в случайной позиции (размер последовательности не меняется).
+  template <typename Array>
+  void BenchmarkEdits(const std::string& name, Array& array, int size) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> position(0, size - 1);
+
+    BENCHMARK(name + " Insert + Remove (random index), N = " + std::to_string(size)) {
+      const int index = position(engine);
+      array.Insert(index, index);
+      return array.Remove(index);
+    };
+
+    BENCHMARK(name + " Get (random index), N = " + std::to_string(size)) {
+      return array.Get(position(engine));
+    };
+  }
+
+  void BenchmarkSize(int size) {
+    auto tiered = TieredVector();
+    for (int i = 0; i < size; i++) {
+      tiered.Add(i);
+    }
+    BenchmarkEdits("TieredVector", tiered, size);
+    tiered.Clear();
+
+    auto dynamic = DynamicArray(size + 1);
+    for (int i = 0; i < size; i++) {
+      dynamic.Add(i);
+    }
+    BenchmarkEdits("DynamicArray", dynamic, size);
+  }
+
+}  // namespace
+
+// Редактирование середины больших последовательностей: O(√n) против O(n).
+TEST_CASE("TieredVector mid-sequence edits", "[benchmark][tiered_vector]") {
+  for (int size : {1'000'000, 10'000'000}) {
+    BenchmarkSize(size);
+  }
+}
+
+TEST_CASE("TieredVector mid-sequence edits (100M)", "[.][benchmark][tiered_vector][large]") {
+  BenchmarkSize(100'000'000);
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <iomanip>   // setw, setprecision
+#include <iostream>  // cout
+#include <string>    // to_string
+
+#include "assignment/linked_list.hpp"           // LinkedList
+#include "assignment/unrolled_linked_list.hpp"  // UnrolledLinkedList
+
+using assignment::LinkedList;
+using assignment::UnrolledLinkedList;
+
+namespace {
+
+  template <typename List>
+  List MakeList(int size) {
+    auto list = List();
+    for (int i = 0; i < size; i++) {
+      list.Add(i);
+    }
+    return list;
+  }
+
+  // вставка и удаление в середине списка (размер списка не меняется)
+  template <typename List>
+  int InsertRemoveMiddle(List& list, int count) {
+    for (int i = 0; i < count; i++) {
+      list.Insert(list.size() / 2, -i);
+      list.Remove(list.size() / 2 + 1);
+    }
+    return list.size();
+  }
+
+  // чтение по индексам с равномерным шагом по всему списку
+  template <typename List>
+  long long GetSpread(const List& list, int count) {
+    long long total = 0;
+    for (int i = 0; i < count; i++) {
+      total += *list.Get(static_cast<int>(static_cast<long long>(i) * list.size() / count));
+    }
+    return total;
+  }
+
+}  // namespace
+
+// Объем памяти на одно значение: узел LinkedList (значение и указатель) против узла на kNodeCapacity значений.
+TEST_CASE("UnrolledLinkedList memory footprint", "[benchmark][unrolled_linked_list]") {
+  std::cout << "\nbytes per value (pool slabs included):\n"
+            << std::setw(10) << "size" << std::setw(14) << "LinkedList" << std::setw(14) << "packed"
+            << std::setw(14) << "half-full" << "\n";
+
+  for (int size : {1'000, 100'000, 1'000'000}) {
+    const auto linked = MakeList<LinkedList>(size);
+    const auto packed = MakeList<UnrolledLinkedList>(size);
+
+    // вставки в начало: каждый узел, кроме первого, заполнен наполовину (наихудший случай после делений)
+    auto split = UnrolledLinkedList();
+    for (int i = 0; i < size; i++) {
+      split.Insert(0, i);
+    }
+
+    std::cout << std::setw(10) << size << std::fixed << std::setprecision(2)
+              << std::setw(14) << static_cast<double>(linked.pool().memory_usage()) / size
+              << std::setw(14) << static_cast<double>(packed.pool().memory_usage()) / size
+              << std::setw(14) << static_cast<double>(split.pool().memory_usage()) / size << "\n";
+  }
+}
+
+// Полный проход по списку: поиск отсутствующего значения.
+TEST_CASE("UnrolledLinkedList traversal", "[benchmark][unrolled_linked_list]") {
+
+  for (int size : {1'000, 100'000, 1'000'000}) {
+    const auto linked = MakeList<LinkedList>(size);
+    const auto unrolled = MakeList<UnrolledLinkedList>(size);
+
+    BENCHMARK("LinkedList::Contains (missing), N = " + std::to_string(size)) {
+      return linked.Contains(-1);
+    };
+
+    BENCHMARK("UnrolledLinkedList::Contains (missing), N = " + std::to_string(size)) {
+      return unrolled.Contains(-1);
+    };
+  }
+}
+
+// Доступ по индексу и вставка в середину: проход до позиции - по узлам, а не по значениям.
+TEST_CASE("UnrolledLinkedList indexed access and middle insert", "[benchmark][unrolled_linked_list]") {
+  constexpr int kOperations = 100;
+
+  for (int size : {1'000, 100'000}) {
+    auto linked = MakeList<LinkedList>(size);
+    auto unrolled = MakeList<UnrolledLinkedList>(size);
+
+    BENCHMARK("LinkedList::Get x " + std::to_string(kOperations) + ", N = " + std::to_string(size)) {
+      return GetSpread(linked, kOperations);
+    };
+
+    BENCHMARK("UnrolledLinkedList::Get x " + std::to_string(kOperations) + ", N = " + std::to_string(size)) {
+      return GetSpread(unrolled, kOperations);
+    };
+
+    BENCHMARK("LinkedList middle Insert + Remove x " + std::to_string(kOperations) + ", N = " + std::to_string(size)) {
+      return InsertRemoveMiddle(linked, kOperations);
+    };
+
+    BENCHMARK("UnrolledLinkedList middle Insert + Remove x " + std::to_string(kOperations) + ", N = " +
+              std::to_string(size)) {
+      return InsertRemoveMiddle(unrolled, kOperations);
+    };
+  }
+}
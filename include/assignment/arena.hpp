@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>          // size_t, max_align_t
+#include <memory_resource>  // memory_resource
+
+namespace assignment {
+
+  /**
+   * Арена памяти с выделением "сдвигом указателя" (bump-pointer).
+   *
+   * Совместима с std::pmr::memory_resource и может передаваться в DynamicArray и ArrayStack.
+   * Высвобождение отдельных блоков не выполняется, вся память арены высвобождается
+   * разом вызовом Release или деструктором - набор контейнеров в рамках одного запроса
+   * не требует ни одного вызова free.
+   *
+   * Память запрашивается у вышестоящего ресурса блоками, размер каждого следующего блока удваивается.
+   * Не является потокобезопасной.
+   */
+  struct MonotonicArena : std::pmr::memory_resource {
+   private:
+    // заголовок блока памяти, полученного от вышестоящего ресурса
+    struct Chunk {
+      Chunk* prev;       // предыдущий блок
+      std::size_t size;  // размер блока (вместе с заголовком)
+    };
+
+    // поля структуры
+    std::pmr::memory_resource* upstream_{nullptr};  // вышестоящий ресурс
+    Chunk* chunks_{nullptr};                        // последний полученный блок
+    char* current_{nullptr};                        // начало свободной памяти текущего блока
+    char* end_{nullptr};                            // конец текущего блока
+    std::size_t next_chunk_size_{kInitChunkSize};   // размер следующего блока
+    std::size_t bytes_allocated_{0};                // кол-во выделенных пользователям байт
+
+   public:
+    // константы структуры
+    static constexpr std::size_t kInitChunkSize = 4096;  // размер первого блока по умолчанию
+
+    /**
+     * Создание арены ~ O(1).
+     *
+     * Память у вышестоящего ресурса запрашивается при первом выделении.
+     *
+     * @param init_chunk_size - размер первого блока памяти (опционально)
+     * @param upstream - вышестоящий ресурс (опционально)
+     * @throws invalid_argument при нулевом размере блока или нулевом указателе на ресурс
+     */
+    explicit MonotonicArena(std::size_t init_chunk_size = kInitChunkSize,
+                            std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * Деструктор ~ O(кол-во блоков).
+     *
+     * Возвращает всю память вышестоящему ресурсу.
+     */
+    ~MonotonicArena() override;
+
+    /**
+     * Высвобождение всей памяти арены ~ O(кол-во блоков).
+     *
+     * Все выделенные ранее указатели становятся недействительными.
+     */
+    void Release();
+
+    /**
+     * Сброс арены для повторного использования ~ O(кол-во блоков).
+     *
+     * Все выделенные ранее указатели становятся недействительными.
+     * Последний (самый большой) блок сохраняется, остальные возвращаются вышестоящему ресурсу -
+     * при повторяющейся нагрузке арена сходится к одному блоку и перестает обращаться к вышестоящему ресурсу.
+     */
+    void Reset();
+
+    /**
+     * Возвращает кол-во байт, выделенных пользователям арены с момента последнего Release.
+     *
+     * @return кол-во выделенных байт (без учета выравнивания)
+     */
+    std::size_t bytes_allocated() const;
+
+   protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+  };
+
+}  // namespace assignment
@@ -1,11 +1,20 @@
 #pragma once
 
-#include <vector>  // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+#include <cstddef>  // size_t
+#include <memory_resource>  // memory_resource, get_default_resource
+#include <vector>   // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
 
+#include "assignment/growth_policy.hpp"   // GrowthPolicy
+#include "assignment/shrink_policy.hpp"   // ShrinkPolicy
+#include "assignment/span.hpp"            // Span
 #include "assignment//private/stack.hpp"  // Stack
 
 namespace assignment {
 
+  namespace binary {
+    struct Mapping;
+  }
+
   /**
    * Структура данных "стек" на базе "массива переменной длины".
    */
@@ -16,6 +25,13 @@ namespace assignment {
     int capacity_{0};     // емкость стека (кол-во ячеек в стеке)
     int* data_{nullptr};  // указатель на выделенный блок памяти
 
+    GrowthPolicy growth_policy_{GrowthPolicy::Default()};  // политика увеличения емкости
+    ShrinkPolicy shrink_policy_{ShrinkPolicy::None()};     // политика уменьшения емкости
+    std::size_t reclaimed_bytes_{0};                        // кол-во высвобожденных при уменьшении емкости байт
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};  // источник памяти для элементов
+    binary::Mapping* mapping_{nullptr};  // отображенная запись, хранящая буфер (nullptr - буфер из источника памяти)
+
    public:
     // константы структуры
     static constexpr int kInitCapacity = 10;              // начальная емкость стека
@@ -31,6 +47,58 @@ namespace assignment {
      */
     explicit ArrayStack(int capacity = kInitCapacity);
 
+    /**
+     * Создание стека с указанной емкостью и политикой увеличения емкости ~ O(n).
+     *
+     * @param capacity - начальная емкость стека
+     * @param growth_policy - политика увеличения емкости
+     * @throws invalid_argument при указании неположительной емкости стека
+     */
+    ArrayStack(int capacity, GrowthPolicy growth_policy);
+
+    /**
+     * Создание стека с указанной емкостью и источником памяти ~ O(n).
+     *
+     * Вся память под элементы стека выделяется и высвобождается через resource
+     * (например, MonotonicArena или std::pmr::monotonic_buffer_resource).
+     * Источник памяти должен существовать дольше стека.
+     *
+     * @param capacity - начальная емкость стека
+     * @param resource - источник памяти
+     * @throws invalid_argument при указании неположительной емкости стека или нулевого указателя на ресурс
+     */
+    ArrayStack(int capacity, std::pmr::memory_resource* resource);
+
+    /**
+     * Создание стека с указанной емкостью, политикой увеличения емкости и источником памяти ~ O(n).
+     *
+     * @param capacity - начальная емкость стека
+     * @param growth_policy - политика увеличения емкости
+     * @param resource - источник памяти
+     * @throws invalid_argument при указании неположительной емкости стека или нулевого указателя на ресурс
+     */
+    ArrayStack(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии стека ~ O(n).
+     *
+     * Копия получает собственный буфер той же емкости, политики и источник памяти оригинала.
+     *
+     * @param other - копируемый стек
+     */
+    ArrayStack(const ArrayStack& other);
+
+    /**
+     * Перемещение стека ~ O(1).
+     *
+     * @param other - перемещаемый стек, становится пустым (без выделенной памяти)
+     */
+    ArrayStack(ArrayStack&& other) noexcept;
+
+    ArrayStack& operator=(const ArrayStack& other);
+
+    ArrayStack& operator=(ArrayStack&& other) noexcept;
+
     /**
      * Деструктор ~ O(1).
      *
@@ -42,7 +110,8 @@ namespace assignment {
     /**
      * Добавление элемента на вершину стека ~ O(1) или O(n).
      *
-     * При недостаточной емкости стек расширяется с сохранением элементов.
+     * При недостаточной емкости стек расширяется согласно политике
+     * увеличения емкости с сохранением элементов (по умолчанию на kCapacityGrowthCoefficient).
      *
      * @param value - значение добавляемого элемента
      */
@@ -51,6 +120,8 @@ namespace assignment {
     /**
      * Удаление элемента с вершины стека ~ O(1).
      *
+     * При включенной политике уменьшения емкости стек может быть перенесен в меньший блок памяти ~ O(n).
+     *
      * @return true - операция успешна, false - операция невозможна (стек пустой)
      */
     bool Pop() override;
@@ -59,6 +130,7 @@ namespace assignment {
      * Очистка стека ~ O(1).
      *
      * Обнуляет размер массива.
+     * При включенной политике уменьшения емкости высвобождает память.
      */
     void Clear() override;
 
@@ -98,10 +170,141 @@ namespace assignment {
      */
     bool Resize(int new_capacity);
 
+    /**
+     * Возвращает политику увеличения емкости стека ~ O(1).
+     *
+     * @return политика увеличения емкости
+     */
+    const GrowthPolicy& growth_policy() const;
+
+    /**
+     * Установка политики увеличения емкости стека ~ O(1).
+     *
+     * @param growth_policy - новая политика увеличения емкости
+     */
+    void set_growth_policy(GrowthPolicy growth_policy);
+
+    /**
+     * Уменьшение емкости стека до его размера ~ O(n).
+     *
+     * Емкость стека остается положительной (не меньше 1).
+     *
+     * @return true - емкость уменьшена, false - емкость уже равна размеру
+     */
+    bool ShrinkToFit();
+
+    /**
+     * Возвращает политику уменьшения емкости стека ~ O(1).
+     *
+     * @return политика уменьшения емкости
+     */
+    const ShrinkPolicy& shrink_policy() const;
+
+    /**
+     * Установка политики уменьшения емкости стека ~ O(1) или O(n).
+     *
+     * Политика применяется сразу же к текущему размеру стека.
+     *
+     * @param shrink_policy - новая политика уменьшения емкости
+     */
+    void set_shrink_policy(ShrinkPolicy shrink_policy);
+
+    /**
+     * Возвращает кол-во байт, высвобожденных при уменьшении емкости стека ~ O(1).
+     *
+     * Учитываются ShrinkToFit и уменьшения по политике уменьшения емкости.
+     *
+     * @return суммарное кол-во высвобожденных байт
+     */
+    std::size_t reclaimed_bytes() const;
+
+    /**
+     * Возвращает источник памяти стека ~ O(1).
+     *
+     * @return указатель на источник памяти (по умолчанию std::pmr::get_default_resource())
+     */
+    std::pmr::memory_resource* resource() const;
+
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам стека от дна к вершине ~ O(1).
+     *
+     * Только для чтения: изменение стека выполняется через Push и Pop.
+     * Итераторы действительны до изменения емкости стека.
+     */
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    /**
+     * Непрерывное представление элементов стека от дна к вершине ~ O(1).
+     *
+     * @return представление для чтения элементов
+     */
+    Span<const int> span() const;
+
+    /**
+     * Сохранение элементов стека от дна к вершине в двоичном формате (binary_format.hpp) ~ O(n).
+     *
+     * @param fd - дескриптор, открытый на запись
+     * @throws system_error при ошибке записи
+     */
+    void Save(int fd) const;
+
+    /**
+     * Загрузка элементов стека, сохраненных методом Save ~ O(n).
+     *
+     * Запись в обычном файле отображается в память (MAP_PRIVATE) и становится буфером стека без копирования.
+     * Из каналов и сокетов значения читаются в новый буфер. При ошибке стек не изменяется.
+     *
+     * @param fd - дескриптор, открытый на чтение
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при неизвестном формате, другом типе контейнера, обрыве записи
+     *                       или несовпадении контрольной суммы
+     */
+    void Load(int fd);
+
     // ДЛЯ ТЕСТИРОВАНИЯ
     ArrayStack(const std::vector<int>& values, int capacity);
 
     std::vector<int> toVector(std::optional<int> size = std::nullopt) const;
+
+   private:
+    /**
+     * Выделение блока памяти под указанное кол-во ячеек через источник памяти ~ O(1).
+     *
+     * @param capacity - кол-во ячеек
+     * @return указатель на выделенный (неинициализированный) блок памяти
+     */
+    int* Allocate(int capacity);
+
+    /**
+     * Возврат блока памяти источнику памяти ~ O(1).
+     *
+     * Отображенный буфер загруженной записи вместо этого снимается с отображения.
+     *
+     * @param data - указатель на блок памяти (может быть нулевым)
+     * @param capacity - кол-во ячеек блока
+     */
+    void Deallocate(int* data, int capacity);
+
+    /**
+     * Перенос элементов в новый блок памяти указанной емкости ~ O(n).
+     *
+     * @param new_capacity - новая емкость стека, new_capacity >= size
+     */
+    void Reallocate(int new_capacity);
+
+    /**
+     * Уменьшение емкости стека согласно политике уменьшения емкости ~ O(1) или O(n).
+     */
+    void ShrinkIfNeeded();
+
+    /**
+     * Обмен содержимым двух стеков ~ O(1).
+     */
+    void Swap(ArrayStack& other) noexcept;
   };
 
 }  // namespace assignment
\ No newline at end of file
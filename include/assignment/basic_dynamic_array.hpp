@@ -0,0 +1,595 @@
+#pragma once
+
+#include <algorithm>    // move, rotate, find
+#include <cstring>      // memcpy
+#include <memory>       // allocator, allocator_traits, addressof
+#include <optional>     // optional
+#include <stdexcept>    // invalid_argument
+#include <type_traits>  // is_trivially_copyable, conditional, is_lvalue_reference
+#include <utility>      // move, move_if_noexcept, forward, swap
+
+#include "assignment/growth_policy.hpp"  // GrowthPolicy
+#include "assignment/span.hpp"           // Span
+
+namespace assignment {
+
+  /**
+   * Обобщенная структура данных "массив переменной длины" над типом элементов T.
+   *
+   * Элементы находятся последовательно в памяти (по соседним адресам).
+   * Память выделяется аллокатором Allocator, элементы создаются только в занятых ячейках
+   * (свободные ячейки массива не инициализируются).
+   *
+   * При расширении элементы перемещаются (move), а не копируются;
+   * для тривиально копируемых типов используется memcpy.
+   *
+   * В отличие от DynamicArray (массив int, реализация интерфейса List) не использует виртуальные функции
+   * и полностью определена в заголовочном файле.
+   *
+   * @tparam T - тип элементов массива
+   * @tparam Allocator - аллокатор элементов (std::allocator по умолчанию)
+   */
+  template <typename T, typename Allocator = std::allocator<T>>
+  struct BasicDynamicArray {
+   public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+   private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    // поля структуры
+    int size_{0};         // кол-во элементов в массиве
+    int capacity_{0};     // емкость массива (кол-во ячеек в массиве)
+    T* data_{nullptr};    // указатель на выделенный блок памяти
+    Allocator allocator_;  // аллокатор элементов
+
+    GrowthPolicy growth_policy_{GrowthPolicy::Default()};  // политика увеличения емкости
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = 10;  // начальная емкость массива
+
+    /**
+     * Создание массива с указанной емкостью ~ O(1).
+     *
+     * @param capacity - начальная емкость массива (опционально)
+     * @param allocator - аллокатор элементов (опционально)
+     * @throws invalid_argument при указании неположительной емкости массива
+     */
+    explicit BasicDynamicArray(int capacity = kInitCapacity, const Allocator& allocator = Allocator())
+        : allocator_{allocator} {
+      if (capacity <= 0) {
+        throw std::invalid_argument("capacity is not positive");
+      }
+      data_ = AllocTraits::allocate(allocator_, static_cast<std::size_t>(capacity));
+      capacity_ = capacity;
+    }
+
+    /**
+     * Создание массива с указанной емкостью и политикой увеличения емкости ~ O(1).
+     *
+     * @param capacity - начальная емкость массива
+     * @param growth_policy - политика увеличения емкости
+     * @param allocator - аллокатор элементов (опционально)
+     * @throws invalid_argument при указании неположительной емкости массива
+     */
+    BasicDynamicArray(int capacity, GrowthPolicy growth_policy, const Allocator& allocator = Allocator())
+        : BasicDynamicArray(capacity, allocator) {
+      growth_policy_ = std::move(growth_policy);
+    }
+
+    /**
+     * Создание копии массива ~ O(n).
+     *
+     * @param other - копируемый массив
+     */
+    BasicDynamicArray(const BasicDynamicArray& other)
+        : BasicDynamicArray(other, AllocTraits::select_on_container_copy_construction(other.allocator_)) {}
+
+    /**
+     * Создание копии массива с указанным аллокатором ~ O(n).
+     *
+     * @param other - копируемый массив
+     * @param allocator - аллокатор элементов копии
+     */
+    BasicDynamicArray(const BasicDynamicArray& other, const Allocator& allocator)
+        : allocator_{allocator}, growth_policy_{other.growth_policy_} {
+      ConstructFrom(other);
+    }
+
+    /**
+     * Перемещение массива ~ O(1).
+     *
+     * Перемещенный массив становится пустым и не владеет памятью.
+     *
+     * @param other - перемещаемый массив
+     */
+    BasicDynamicArray(BasicDynamicArray&& other) noexcept
+        : allocator_{std::move(other.allocator_)}, growth_policy_{other.growth_policy_} {
+      StealFrom(other);
+    }
+
+    /**
+     * Перемещение массива в память указанного аллокатора ~ O(1) или O(n).
+     *
+     * При равных аллокаторах блок памяти передается целиком, иначе элементы перемещаются поштучно
+     * (перемещенный массив сохраняет свой блок памяти с перемещенными элементами).
+     *
+     * @param other - перемещаемый массив
+     * @param allocator - аллокатор элементов массива
+     */
+    BasicDynamicArray(BasicDynamicArray&& other, const Allocator& allocator)
+        : allocator_{allocator}, growth_policy_{other.growth_policy_} {
+      if (allocator_ == other.allocator_) {
+        StealFrom(other);
+      } else {
+        ConstructFrom(std::move(other));
+      }
+    }
+
+    /**
+     * Копирующее присваивание ~ O(n).
+     *
+     * Аллокатор other передается массиву только при propagate_on_container_copy_assignment,
+     * иначе копия создается в памяти собственного аллокатора.
+     */
+    BasicDynamicArray& operator=(const BasicDynamicArray& other) {
+      if (this != &other) {
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+          BasicDynamicArray copy(other, other.allocator_);
+          SwapStorage(copy);
+          using std::swap;
+          swap(allocator_, copy.allocator_);
+        } else {
+          BasicDynamicArray copy(other, allocator_);
+          SwapStorage(copy);
+        }
+      }
+      return *this;
+    }
+
+    /**
+     * Перемещающее присваивание ~ O(1) или O(n).
+     *
+     * Без propagate_on_container_move_assignment блок памяти other перехватывается только при равных
+     * аллокаторах, иначе элементы перемещаются поштучно в память собственного аллокатора.
+     */
+    BasicDynamicArray& operator=(BasicDynamicArray&& other) noexcept(
+        AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value) {
+      if (this != &other) {
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+          BasicDynamicArray moved(std::move(other));
+          SwapStorage(moved);
+          using std::swap;
+          swap(allocator_, moved.allocator_);
+        } else {
+          BasicDynamicArray moved(std::move(other), allocator_);
+          SwapStorage(moved);
+        }
+      }
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(n).
+     *
+     * Разрушает элементы и высвобождает выделенную память.
+     */
+    ~BasicDynamicArray() {
+      Clear();
+      if (data_ != nullptr) {
+        AllocTraits::deallocate(allocator_, data_, static_cast<std::size_t>(capacity_));
+      }
+      capacity_ = 0;
+      data_ = nullptr;
+    }
+
+    /**
+     * Создание элемента в конце массива из аргументов конструктора T ~ O(1) или O(n).
+     *
+     * Элемент создается непосредственно в ячейке массива (без промежуточных копий).
+     * Аргументы могут ссылаться на элементы самого массива.
+     *
+     * @param args - аргументы конструктора T
+     * @return ссылка на созданный элемент
+     */
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+      if (size_ < capacity_) {
+        AllocTraits::construct(allocator_, data_ + size_, std::forward<Args>(args)...);
+        size_++;
+        return data_[size_ - 1];
+      }
+
+      // новый элемент создается до перемещения старых: аргументы могут ссылаться на элементы массива
+      const int new_capacity = growth_policy_.NextCapacity(capacity_, size_ + 1);
+      StorageGuard guard{allocator_, AllocTraits::allocate(allocator_, static_cast<std::size_t>(new_capacity)),
+                         new_capacity, size_, size_};
+      AllocTraits::construct(allocator_, guard.data + size_, std::forward<Args>(args)...);
+      guard.last = size_ + 1;
+      Relocate(guard);
+      size_++;
+      return data_[size_ - 1];
+    }
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) или O(n).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(const T& value) {
+      EmplaceBack(value);
+    }
+
+    /**
+     * Добавление элемента в конец массива перемещением ~ O(1) или O(n).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(T&& value) {
+      EmplaceBack(std::move(value));
+    }
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(n).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, T value) {
+      if ((index < 0)||(index > size_)) {
+        return false;
+      }
+      EmplaceBack(std::move(value));
+      std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+      return true;
+    }
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, T new_value) {
+      if ((index < 0)||(index >= size_)) {
+        return false;
+      }
+      data_[index] = std::move(new_value);
+      return true;
+    }
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<T> Remove(int index) {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      std::optional<T> removed{std::move(data_[index])};
+      std::move(data_ + index + 1, data_ + size_, data_ + index);
+      size_--;
+      AllocTraits::destroy(allocator_, data_ + size_);
+      return removed;
+    }
+
+    /**
+     * Очистка массива ~ O(n).
+     *
+     * Разрушает элементы, емкость массива не изменяется.
+     */
+    void Clear() {
+      if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (int i = 0; i < size_; i++) {
+          AllocTraits::destroy(allocator_, data_ + i);
+        }
+      }
+      size_ = 0;
+    }
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return копия значения элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<T> Get(int index) const {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      return data_[index];
+    }
+
+    /**
+     * Доступ к элементу массива по индексу без проверки границ ~ O(1).
+     *
+     * @param index - позиция элемента в массиве, 0 <= index < size
+     * @return ссылка на элемент
+     */
+    T& operator[](int index) {
+      return data_[index];
+    }
+
+    const T& operator[](int index) const {
+      return data_[index];
+    }
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(const T& value) const {
+      const T* found = std::find(data_, data_ + size_, value);
+      if (found == data_ + size_) {
+        return std::nullopt;
+      }
+      return static_cast<int>(found - data_);
+    }
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(const T& value) const {
+      return IndexOf(value).has_value();
+    }
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const {
+      return size_ == 0;
+    }
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const {
+      return size_;
+    }
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество выделенных ячеек массива
+     */
+    int capacity() const {
+      return capacity_;
+    }
+
+    /**
+     * Возвращает указатель на первый элемент массива ~ O(1).
+     *
+     * @return указатель на начало блока памяти массива
+     */
+    T* data() {
+      return data_;
+    }
+
+    const T* data() const {
+      return data_;
+    }
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива ~ O(1).
+     *
+     * Итераторы действительны до изменения емкости массива.
+     */
+    iterator begin() {
+      return data_;
+    }
+
+    iterator end() {
+      return data_ + size_;
+    }
+
+    const_iterator begin() const {
+      return data_;
+    }
+
+    const_iterator end() const {
+      return data_ + size_;
+    }
+
+    /**
+     * Непрерывное представление элементов массива [0, size) ~ O(1).
+     *
+     * @return представление для изменения (для константного массива - для чтения) элементов
+     */
+    Span<T> span() {
+      return {data_, size_};
+    }
+
+    Span<const T> span() const {
+      return {data_, size_};
+    }
+
+    /**
+     * Возвращает аллокатор массива ~ O(1).
+     *
+     * @return копия аллокатора
+     */
+    Allocator get_allocator() const {
+      return allocator_;
+    }
+
+    /**
+     * Увеличение емкости массива ~ O(n).
+     *
+     * Элементы перемещаются в новый блок памяти (memcpy для тривиально копируемых типов).
+     *
+     * @param new_capacity - новая емкость массива
+     * @return true - операция прошла успешно, false - новая емкость меньше или равна текущей
+     */
+    bool Resize(int new_capacity) {
+      if (new_capacity <= capacity_) {
+        return false;
+      }
+      StorageGuard guard{allocator_, AllocTraits::allocate(allocator_, static_cast<std::size_t>(new_capacity)),
+                         new_capacity, size_, size_};
+      Relocate(guard);
+      return true;
+    }
+
+    /**
+     * Обмен содержимым двух массивов ~ O(1) или O(n).
+     *
+     * Аллокаторы обмениваются только при propagate_on_container_swap. Иначе каждый массив сохраняет
+     * свой аллокатор: при равных аллокаторах обмениваются блоки памяти, при неравных элементы
+     * перемещаются поштучно в память аллокатора другого массива.
+     *
+     * @param other - массив для обмена
+     */
+    void Swap(BasicDynamicArray& other) noexcept(AllocTraits::propagate_on_container_swap::value ||
+                                                 AllocTraits::is_always_equal::value) {
+      if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        SwapStorage(other);
+        using std::swap;
+        swap(allocator_, other.allocator_);
+      } else {
+        if (allocator_ == other.allocator_) {
+          SwapStorage(other);
+        } else {
+          BasicDynamicArray to_this(std::move(other), allocator_);
+          BasicDynamicArray to_other(std::move(*this), other.allocator_);
+          SwapStorage(to_this);
+          other.SwapStorage(to_other);
+        }
+      }
+    }
+
+   private:
+    /**
+     * Защита нового блока памяти на время заполнения.
+     *
+     * Если заполнение не завершено (Release не вызван), деструктор разрушает созданные элементы
+     * [first, last) и высвобождает блок.
+     */
+    struct StorageGuard {
+      Allocator& allocator;  // аллокатор блока памяти
+      T* data;               // новый блок памяти
+      int capacity;          // емкость нового блока памяти
+      int first;             // начало созданных элементов
+      int last;              // конец созданных элементов (не включительно)
+      bool released{false};  // блок передан массиву
+
+      StorageGuard(Allocator& block_allocator, T* block, int block_capacity, int begin, int end)
+          : allocator{block_allocator}, data{block}, capacity{block_capacity}, first{begin}, last{end} {}
+
+      StorageGuard(const StorageGuard&) = delete;
+      StorageGuard& operator=(const StorageGuard&) = delete;
+
+      ~StorageGuard() {
+        if (released) {
+          return;
+        }
+        for (int i = first; i < last; i++) {
+          AllocTraits::destroy(allocator, data + i);
+        }
+        AllocTraits::deallocate(allocator, data, static_cast<std::size_t>(capacity));
+      }
+
+      void Release() {
+        released = true;
+      }
+    };
+
+    /**
+     * Создание элементов other в новом блоке памяти аллокатора массива ~ O(n).
+     *
+     * Элементы копируются (other - lvalue) или перемещаются (other - rvalue).
+     * Массив должен быть пустым и не владеть памятью.
+     */
+    template <typename Other>
+    void ConstructFrom(Other&& other) {
+      using Source = std::conditional_t<std::is_lvalue_reference_v<Other>, const T&, T&&>;
+      if (other.capacity_ == 0) {
+        return;
+      }
+      StorageGuard guard{allocator_, AllocTraits::allocate(allocator_, static_cast<std::size_t>(other.capacity_)),
+                         other.capacity_, 0, 0};
+      for (; guard.last < other.size_; guard.last++) {
+        AllocTraits::construct(allocator_, guard.data + guard.last, static_cast<Source>(other.data_[guard.last]));
+      }
+      guard.Release();
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      data_ = guard.data;
+    }
+
+    /**
+     * Перехват блока памяти other (аллокаторы равны) ~ O(1).
+     *
+     * Массив должен быть пустым и не владеть памятью, other становится пустым и не владеет памятью.
+     */
+    void StealFrom(BasicDynamicArray& other) noexcept {
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      data_ = other.data_;
+      other.size_ = 0;
+      other.capacity_ = 0;
+      other.data_ = nullptr;
+    }
+
+    /**
+     * Обмен блоками памяти и политиками увеличения емкости (без аллокаторов) ~ O(1).
+     */
+    void SwapStorage(BasicDynamicArray& other) noexcept {
+      using std::swap;
+      swap(size_, other.size_);
+      swap(capacity_, other.capacity_);
+      swap(data_, other.data_);
+      swap(growth_policy_, other.growth_policy_);
+    }
+
+    /**
+     * Перенос size элементов в новый блок памяти guard и освобождение старого ~ O(n).
+     *
+     * Элементы перемещаются с конца (move_if_noexcept), созданные ячейки нового блока - непрерывный
+     * отрезок [guard.first, guard.last). При исключении guard разрушает их и высвобождает новый блок,
+     * массив остается без изменений (строгая гарантия, если перемещение не бросает или T копируется).
+     *
+     * @param guard - новый блок памяти (ячейки [0, size) не инициализированы)
+     */
+    void Relocate(StorageGuard& guard) {
+      if constexpr (std::is_trivially_copyable_v<T>) {
+        if (size_ > 0) {
+          std::memcpy(static_cast<void*>(guard.data), static_cast<const void*>(data_),
+                      static_cast<std::size_t>(size_) * sizeof(T));
+        }
+      } else {
+        for (int i = size_ - 1; i >= 0; i--) {
+          AllocTraits::construct(allocator_, guard.data + i, std::move_if_noexcept(data_[i]));
+          guard.first = i;
+        }
+        for (int i = 0; i < size_; i++) {
+          AllocTraits::destroy(allocator_, data_ + i);
+        }
+      }
+      guard.Release();
+      if (data_ != nullptr) {
+        AllocTraits::deallocate(allocator_, data_, static_cast<std::size_t>(capacity_));
+      }
+      data_ = guard.data;
+      capacity_ = guard.capacity;
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // int64_t, uint16_t, uint32_t, uint64_t
+
+#include "assignment/node.hpp"       // Node
+#include "assignment/node_pool.hpp"  // NodePool
+
+namespace assignment::binary {
+
+  /**
+   * Двоичный формат сохранения контейнеров (Save/Load).
+   *
+   * Запись состоит из заголовка (сигнатура, версия формата, тип контейнера, размер int, кол-во элементов),
+   * значений элементов (count значений int подряд) и контрольной суммы значений (uint64).
+   * Контрольная сумма записывается после значений, поэтому связные контейнеры сохраняются за один проход.
+   *
+   * Порядок байт и размер int должны совпадать у сохранившей и загружающей запись программы.
+   * Операции ввода-вывода выполняются с текущей позиции дескриптора (файл, канал, сокет),
+   * после загрузки позиция указывает на конец записи - в один файл можно сохранить несколько контейнеров.
+   */
+
+  // тип сохраненного контейнера
+  enum class Kind : std::uint16_t {
+    kDynamicArray = 1,
+    kArrayStack = 2,
+    kLinkedList = 3,
+    kLinkedQueue = 4
+  };
+
+  // заголовок записи
+  struct Header {
+    std::uint32_t magic;         // сигнатура формата
+    std::uint16_t version;       // версия формата
+    std::uint16_t kind;          // тип контейнера (Kind)
+    std::uint32_t element_size;  // размер значения в байтах (sizeof(int))
+    std::uint32_t reserved;      // не используется (0)
+    std::int64_t count;          // кол-во элементов
+    std::int64_t padding;        // выравнивание значений на 32 байта (0)
+  };
+
+  // константы формата
+  constexpr std::uint32_t kMagic = 0x4E494241;  // сигнатура формата ("ABIN")
+  constexpr std::uint16_t kVersion = 1;         // текущая версия формата
+  constexpr int kChecksumBlock = 8;             // кол-во значений, обрабатываемых контрольной суммой за шаг
+  constexpr int kChunkSize = 4096;              // размер буфера для поэлементного сохранения и загрузки
+
+  static_assert(sizeof(Header) == 32, "header must not have implicit padding");
+  static_assert(kChunkSize % kChecksumBlock == 0, "chunks must consist of whole checksum blocks");
+
+  /**
+   * Потоковая контрольная сумма последовательности значений int (4 независимые 64-битные цепочки).
+   *
+   * Значения можно передавать частями: все части, кроме последней, должны быть кратны kChecksumBlock.
+   */
+  class Checksum {
+   public:
+    Checksum();
+
+    /**
+     * Добавление значений в контрольную сумму ~ O(count).
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во значений
+     */
+    void Update(const int* values, std::int64_t count);
+
+    /**
+     * Возвращает контрольную сумму добавленных значений ~ O(1).
+     *
+     * @return контрольная сумма
+     */
+    std::uint64_t Digest() const;
+
+   private:
+    std::uint64_t lanes_[4];  // независимые цепочки (по одному 64-битному слову из каждого блока)
+    std::uint64_t tail_;      // накопитель значений последнего неполного блока
+    std::int64_t count_{0};   // кол-во добавленных значений
+  };
+
+  /**
+   * Значения записи, отображенные в память (POSIX mmap, MAP_PRIVATE).
+   *
+   * Изменения значений не попадают в файл. Отображение снимается деструктором.
+   */
+  struct Mapping {
+    void* base{nullptr};     // начало отображенной области (выровнено на страницу)
+    std::size_t length{0};   // размер отображенной области в байтах
+    int* data{nullptr};      // первое значение записи
+
+    Mapping() = default;
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+    ~Mapping();
+  };
+
+  /**
+   * Запись контейнера в дескриптор.
+   *
+   * Порядок: конструктор (заголовок) -> Write (значения, по частям) -> Finish (контрольная сумма).
+   */
+  class Writer {
+   public:
+    /**
+     * Запись заголовка ~ O(1).
+     *
+     * @param fd - дескриптор, открытый на запись
+     * @param kind - тип контейнера
+     * @param count - кол-во сохраняемых значений
+     * @throws system_error при ошибке записи
+     */
+    Writer(int fd, Kind kind, std::int64_t count);
+
+    /**
+     * Запись очередной части значений ~ O(count).
+     *
+     * Все части, кроме последней, должны быть кратны kChecksumBlock.
+     *
+     * @param values - указатель на начало части
+     * @param count - кол-во значений части
+     * @throws logic_error при превышении заявленного в заголовке кол-ва значений
+     * @throws system_error при ошибке записи
+     */
+    void Write(const int* values, std::int64_t count);
+
+    /**
+     * Запись контрольной суммы ~ O(1).
+     *
+     * @throws logic_error если записаны не все заявленные значения
+     * @throws system_error при ошибке записи
+     */
+    void Finish();
+
+   private:
+    int fd_;                   // дескриптор
+    std::int64_t remaining_;   // кол-во еще не записанных значений
+    Checksum checksum_;        // контрольная сумма записанных значений
+  };
+
+  /**
+   * Чтение записи контейнера из дескриптора.
+   *
+   * Порядок: конструктор (заголовок) -> Map или Read (значения, по частям) -> Finish (контрольная сумма).
+   */
+  class Reader {
+   public:
+    /**
+     * Чтение и проверка заголовка ~ O(1).
+     *
+     * @param fd - дескриптор, открытый на чтение
+     * @param kind - ожидаемый тип контейнера
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при неизвестной сигнатуре, версии, размере int, другом типе контейнера,
+     *                       кол-ве элементов вне [0, INT_MAX] или обрыве записи
+     */
+    Reader(int fd, Kind kind);
+
+    /**
+     * Возвращает кол-во значений записи ~ O(1).
+     *
+     * @return кол-во значений в [0, INT_MAX]
+     */
+    int count() const;
+
+    /**
+     * Отображение значений записи в память без копирования ~ O(n) (проверка контрольной суммы).
+     *
+     * Выполняется только до чтения значений. При успехе позиция дескриптора переносится на конец записи
+     * (Finish не требуется). Отображение невозможно для пустой записи, дескрипторов без произвольного
+     * доступа (каналы, сокеты) и значений, не выровненных для int (смещение в файле не кратно alignof(int)) -
+     * в этом случае значения читаются через Read.
+     *
+     * @return отображение (владение передается вызывающему коду) или nullptr (отображение невозможно)
+     * @throws runtime_error при обрыве записи или несовпадении контрольной суммы
+     */
+    Mapping* Map();
+
+    /**
+     * Чтение очередной части значений ~ O(count).
+     *
+     * Все части, кроме последней, должны быть кратны kChecksumBlock.
+     *
+     * @param out - буфер для значений (не менее count ячеек)
+     * @param count - кол-во читаемых значений (не больше оставшегося)
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при обрыве записи
+     */
+    void Read(int* out, std::int64_t count);
+
+    /**
+     * Чтение и проверка контрольной суммы ~ O(1).
+     *
+     * @throws logic_error если прочитаны не все значения
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при обрыве записи или несовпадении контрольной суммы
+     */
+    void Finish();
+
+   private:
+    int fd_;                   // дескриптор
+    int count_;                // кол-во значений записи
+    std::int64_t remaining_;   // кол-во еще не прочитанных значений
+    Checksum checksum_;        // контрольная сумма прочитанных значений
+  };
+
+  /**
+   * Сохранение значений цепочки узлов (поэлементно, через буфер из kChunkSize значений) ~ O(n).
+   *
+   * @param fd - дескриптор, открытый на запись
+   * @param kind - тип контейнера
+   * @param front - первый узел цепочки
+   * @param count - кол-во сохраняемых узлов (не больше длины цепочки)
+   * @throws system_error при ошибке записи
+   */
+  void SaveNodes(int fd, Kind kind, const Node* front, int count);
+
+  /**
+   * Загрузка значений записи в один непрерывный блок узлов пула, связанных по порядку ~ O(n).
+   *
+   * Блок выделяется пулом целиком (NodePool::NewBlock), последний узел указывает на nullptr.
+   * При ошибке блок остается в пуле - загрузка выполняется в пул временного контейнера.
+   *
+   * @param reader - запись с прочитанным заголовком
+   * @param pool - пул, выделяющий блок узлов
+   * @return блок из reader.count() узлов или nullptr (пустая запись)
+   * @throws system_error при ошибке чтения
+   * @throws runtime_error при обрыве записи или несовпадении контрольной суммы
+   */
+  Node* LoadNodes(Reader& reader, NodePool<Node>& pool);
+
+}  // namespace assignment::binary
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>   // size_t
+#include <cstdint>   // uint32_t
+#include <optional>  // optional
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/basic_dynamic_array.hpp"     // BasicDynamicArray
+#include "assignment/simd.hpp"                    // kPackedBlockSize
+#include "assignment/private/read_only_list.hpp"  // ReadOnlyList
+
+namespace assignment {
+
+  /**
+   * Структура данных "сжатый массив переменной длины" (frame-of-reference + упаковка бит).
+   *
+   * Элементы хранятся блоками по kBlockSize значений: для каждого заполненного блока запоминаются
+   * минимум (опорное значение) и ширина разности max - min в битах, значения упаковываются
+   * по этой ширине (simd::Pack). Последний неполный блок хранится неупакованным и упаковывается
+   * при заполнении, поэтому добавление не трогает ранее упакованные блоки.
+   *
+   * Доступ по индексу - через каталог блоков ~ O(1). Поиск пропускает блоки, в диапазон которых
+   * значение не попадает, остальные сравнивает с искомым без распаковки (simd::CountPacked).
+   * Массив только дополняется, поэтому реализует интерфейс чтения списка.
+   */
+  struct CompressedArray : ReadOnlyList {
+   public:
+    // константы структуры
+    static constexpr int kBlockSize = simd::kPackedBlockSize;  // кол-во значений в блоке
+
+   private:
+    // заголовок упакованного блока
+    struct Block {
+      int reference;  // опорное значение (минимум блока)
+      int maximum;    // максимум блока
+      int bits;       // ширина упакованного значения в битах
+      int offset;     // смещение блока в words_ (в словах)
+    };
+
+    // поля структуры
+    int size_{0};                             // кол-во элементов в массиве
+    BasicDynamicArray<Block> blocks_;         // каталог упакованных блоков
+    BasicDynamicArray<std::uint32_t> words_;  // упакованные блоки подряд
+    int tail_[kBlockSize];                    // неупакованные значения последнего неполного блока
+
+   public:
+    /**
+     * Создание пустого массива ~ O(1).
+     */
+    CompressedArray();
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) (амортизированно).
+     *
+     * При заполнении последнего блока он упаковывается ~ O(kBlockSize).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value);
+
+    /**
+     * Добавление последовательности элементов в конец массива ~ O(k).
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во элементов последовательности
+     * @return true - операция прошла успешно, false - отрицательное кол-во элементов или нулевой указатель
+     */
+    bool AddRange(const int* values, int count);
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Память под упакованные блоки сохраняется.
+     */
+    void Clear();
+
+    /**
+     * Уменьшение емкости хранилища блоков до занятого объема ~ O(n / kBlockSize * bits).
+     *
+     * Используется после заполнения массива, когда дальнейшие добавления не ожидаются.
+     */
+    void ShrinkToFit();
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Распаковка элементов [index, index + count) в буфер ~ O(count).
+     *
+     * Полные блоки распаковываются сразу в буфер, без промежуточного копирования.
+     *
+     * @param index - позиция первого элемента
+     * @param count - кол-во элементов
+     * @param out - буфер для значений (не менее count ячеек)
+     * @return true - операция прошла успешно, false - диапазон за пределами массива
+     */
+    bool Decode(int index, int count, int* out) const;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * Блоки, в диапазон которых значение не попадает, не распаковываются.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Подсчет кол-ва элементов с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return кол-во элементов, равных value
+     */
+    int Count(int value) const;
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override;
+
+    /**
+     * Возвращает объем памяти, занятый элементами ~ O(1).
+     *
+     * Учитываются упакованные блоки и каталог блоков (с запасом емкости) и буфер неполного блока.
+     *
+     * @return кол-во байт
+     */
+    std::size_t memory_usage() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    explicit CompressedArray(const std::vector<int>& values);
+
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Упаковка заполненного последнего блока ~ O(kBlockSize).
+     */
+    void SealTail();
+
+    /**
+     * Проверка попадания значения в диапазон упакованного блока ~ O(1).
+     *
+     * @param block - заголовок блока
+     * @param value - значение
+     * @return true - значение может присутствовать в блоке, false - значения в блоке нет
+     */
+    static bool MayContain(const Block& block, int value);
+
+    /**
+     * Кол-во элементов в упакованных блоках ~ O(1).
+     */
+    int sealed_size() const;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <memory_resource>  // memory_resource
+#include <optional>         // optional
+#include <vector>           // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/node.hpp"          // DoubleNode
+#include "assignment/node_pool.hpp"     // NodePool
+#include "assignment/private/list.hpp"  // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "двусвязный список".
+   * Хранит в себе элементы в виде последовательности узлов со ссылками на предыдущий и следующий узлы.
+   *
+   * Поиск по индексу идет от ближайшего конца списка (не больше n / 2 переходов).
+   * Добавление и удаление с обоих концов, удаление и перемещение узла по указателю на него ~ O(1):
+   * указатель на узел (FindNode, front_node, back_node) действителен до удаления этого узла.
+   *
+   * Узлы выделяются из собственного пула списка (NodePool).
+   */
+  struct DoublyLinkedList : List {
+   private:
+    // поля структуры
+    int size_{0};                 // кол-во узлов в списке
+    DoubleNode* front_{nullptr};  // указатель на начальный узел
+    DoubleNode* back_{nullptr};   // указатель на конечный узел
+    NodePool<DoubleNode> pool_;   // пул узлов (удаленные узлы переиспользуются)
+
+   public:
+    /**
+     * Создание пустого списка ~ O(1).
+     */
+    DoublyLinkedList() = default;
+
+    /**
+     * Создание пустого списка с источником памяти для узлов ~ O(1).
+     *
+     * Источник памяти должен существовать дольше списка.
+     *
+     * @param resource - источник памяти
+     * @throws invalid_argument при нулевом указателе на ресурс
+     */
+    explicit DoublyLinkedList(std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии списка ~ O(n).
+     *
+     * Узлы копии выделяются одним непрерывным блоком в пуле копии (тот же источник памяти).
+     *
+     * @param other - копируемый список
+     */
+    DoublyLinkedList(const DoublyLinkedList& other);
+
+    DoublyLinkedList& operator=(const DoublyLinkedList& other);
+
+    /**
+     * Перемещение списка ~ O(1).
+     *
+     * @param other - перемещаемый список, становится пустым
+     */
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
+
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков пула).
+     *
+     * Высвобождает выделенную память.
+     */
+    ~DoublyLinkedList() override;
+
+    /**
+     * Добавление элемента в конец списка ~ O(1).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Добавление элемента в начало списка ~ O(1).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void AddFront(int value);
+
+    /**
+     * Вставка элемента в список по индексу ~ O(min(index, size - index)).
+     *
+     * @param index - позиция для вставки элемента в список
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента списка по индексу ~ O(min(index, size - index)).
+     *
+     * @param index - позиция изменяемого элемента списка
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из списка по индексу ~ O(min(index, size - index)).
+     *
+     * @param index - позиция удаляемого элемента в списке
+     * @return значение удаленного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Удаление начального элемента списка ~ O(1).
+     *
+     * @return значение удаленного элемента или ничего (список пуст)
+     */
+    std::optional<int> RemoveFront();
+
+    /**
+     * Удаление конечного элемента списка ~ O(1).
+     *
+     * @return значение удаленного элемента или ничего (список пуст)
+     */
+    std::optional<int> RemoveBack();
+
+    /**
+     * Удаление узла списка по указателю ~ O(1).
+     *
+     * @param node - узел этого списка (не нулевой)
+     * @return значение удаленного узла
+     */
+    int RemoveNode(DoubleNode* node);
+
+    /**
+     * Перемещение узла списка в начало ~ O(1).
+     *
+     * Узел и его значение сохраняются, указатели на узел остаются действительными.
+     *
+     * @param node - узел этого списка (не нулевой)
+     */
+    void MoveToFront(DoubleNode* node);
+
+    /**
+     * Очистка списка ~ O(кол-во блоков пула).
+     *
+     * Наибольший блок пула сохраняется для следующих добавлений.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента списка по индексу ~ O(min(index, size - index)).
+     *
+     * @param index - позиция элемента в списке
+     * @return значение найденного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в списке по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в списке, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты списка ~ O(1).
+     *
+     * @return true - если список пустой, false - в списке есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер списка ~ O(1).
+     *
+     * @return количество элементов в списке
+     */
+    int size() const override;
+
+    /**
+     * Возвращает пул узлов списка ~ O(1).
+     *
+     * @return пул узлов (кол-во узлов и блоков, источник памяти)
+     */
+    const NodePool<DoubleNode>& pool() const;
+
+    /**
+     * Возвращает начальный элемент списка ~ O(1).
+     *
+     * @return значение начального узла или ничего (список пуст)
+     */
+    std::optional<int> front() const;
+
+    /**
+     * Возвращает конечный элемент списка ~ O(1).
+     *
+     * @return значение конечного узла или ничего (список пуст)
+     */
+    std::optional<int> back() const;
+
+    /**
+     * Возвращает начальный узел списка ~ O(1).
+     *
+     * @return указатель на узел или nullptr (список пуст)
+     */
+    DoubleNode* front_node() const;
+
+    /**
+     * Возвращает конечный узел списка ~ O(1).
+     *
+     * @return указатель на узел или nullptr (список пуст)
+     */
+    DoubleNode* back_node() const;
+
+    /**
+     * Поиск узла по индексу от ближайшего конца списка ~ O(min(index, size - index)).
+     *
+     * @param index - позиция узла в списке
+     * @return указатель на найденный узел или nullptr (индекс за пределами списка)
+     */
+    DoubleNode* FindNode(int index) const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Вставка узла перед узлом next (в конец списка при нулевом next) ~ O(1).
+     */
+    void InsertBefore(DoubleNode* next, int value);
+
+    /**
+     * Исключение узла из цепочки без освобождения ~ O(1).
+     */
+    void Unlink(DoubleNode* node);
+
+    /**
+     * Обмен содержимым двух списков ~ O(1).
+     */
+    void Swap(DoublyLinkedList& other) noexcept;
+  };
+
+}  // namespace assignment
@@ -1,11 +1,27 @@
 #pragma once
 
-#include <vector>  // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+#include <algorithm>    // copy
+#include <atomic>       // atomic
+#include <cstddef>      // size_t
+#include <memory_resource>  // memory_resource, get_default_resource
+#include <iterator>     // distance, iterator_traits
+#include <type_traits>  // is_base_of, is_pointer, is_same
+#include <vector>       // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
 
-#include "assignment/private/list.hpp"  // List
+#include "assignment/growth_policy.hpp"  // GrowthPolicy
+#include "assignment/shrink_policy.hpp"  // ShrinkPolicy
+#include "assignment/span.hpp"           // Span
+#include "assignment/private/list.hpp"   // List
 
 namespace assignment {
 
+  struct ThreadPool;
+  struct HashIndex;
+
+  namespace binary {
+    struct Mapping;
+  }
+
   /**
    * Структура данных "массив переменной длины".
    *
@@ -18,10 +34,24 @@ namespace assignment {
     int capacity_{0};     // емкость массива (кол-во ячеек в массиве)
     int* data_{nullptr};  // указатель на выделенный блок памяти
 
+    GrowthPolicy growth_policy_{GrowthPolicy::Default()};  // политика увеличения емкости
+    ShrinkPolicy shrink_policy_{ShrinkPolicy::None()};     // политика уменьшения емкости
+    std::size_t reclaimed_bytes_{0};                        // кол-во высвобожденных при уменьшении емкости байт
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};  // источник памяти для элементов
+    mutable std::atomic<std::atomic<int>*> shared_refs_{nullptr};  // счетчик владельцев буфера (nullptr - не разделяется)
+    binary::Mapping* mapping_{nullptr};  // отображенная запись, хранящая буфер (nullptr - буфер из источника памяти)
+
+    ThreadPool* thread_pool_{nullptr};             // пул потоков для параллельного поиска (не владеет)
+    int parallel_min_size_{kParallelScanMinSize};  // минимальный размер массива для параллельного поиска
+
+    HashIndex* hash_index_{nullptr};  // индекс "значение -> первая позиция" (nullptr - поиск просмотром массива)
+
    public:
     // константы структуры
     static constexpr int kInitCapacity = 10;  // начальная емкость массива
     static constexpr int kCapacityGrowthCoefficient = 5;  // коэффициент увеличения размера массива
+    static constexpr int kParallelScanMinSize = 1 << 22;  // размер массива, начиная с которого поиск параллелен
 
     /**
      * Создание массива с указанной емкостью ~ O(n).
@@ -33,19 +63,94 @@ namespace assignment {
      */
     explicit DynamicArray(int capacity = kInitCapacity);
 
+    /**
+     * Создание массива с указанной емкостью и политикой увеличения емкости ~ O(n).
+     *
+     * @param capacity - начальная емкость массива
+     * @param growth_policy - политика увеличения емкости
+     * @throws invalid_argument при указании неположительной емкости массива
+     */
+    DynamicArray(int capacity, GrowthPolicy growth_policy);
+
+    /**
+     * Создание массива с указанной емкостью и источником памяти ~ O(n).
+     *
+     * Вся память под элементы массива выделяется и высвобождается через resource
+     * (например, MonotonicArena или std::pmr::monotonic_buffer_resource).
+     * Источник памяти должен существовать дольше массива.
+     *
+     * @param capacity - начальная емкость массива
+     * @param resource - источник памяти
+     * @throws invalid_argument при указании неположительной емкости массива или нулевого указателя на ресурс
+     */
+    DynamicArray(int capacity, std::pmr::memory_resource* resource);
+
+    /**
+     * Создание массива с указанной емкостью, политикой увеличения емкости и источником памяти ~ O(n).
+     *
+     * @param capacity - начальная емкость массива
+     * @param growth_policy - политика увеличения емкости
+     * @param resource - источник памяти
+     * @throws invalid_argument при указании неположительной емкости массива или нулевого указателя на ресурс
+     */
+    DynamicArray(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии массива ~ O(n).
+     *
+     * Копия получает собственный буфер той же емкости, политики и источник памяти оригинала.
+     * Для копии за O(1) используется Snapshot.
+     *
+     * @param other - копируемый массив
+     */
+    DynamicArray(const DynamicArray& other);
+
+    /**
+     * Перемещение массива ~ O(1).
+     *
+     * @param other - перемещаемый массив, становится пустым (без выделенной памяти)
+     */
+    DynamicArray(DynamicArray&& other) noexcept;
+
+    DynamicArray& operator=(const DynamicArray& other);
+
+    DynamicArray& operator=(DynamicArray&& other) noexcept;
+
     /**
      * Деструктор ~ O(1).
      *
-     * Высвобождает выделенную память.
+     * Высвобождает выделенную память (разделяемый буфер - при уничтожении последнего владельца).
      * Устанавливает поля в нулевые значения.
      */
     ~DynamicArray() override;
 
+    /**
+     * Создание снимка массива ~ O(1).
+     *
+     * Снимок разделяет буфер с массивом (копирование при записи): буфер копируется целиком
+     * при первом изменении любого из владельцев, пока буфер разделяется.
+     * Снимок можно читать и уничтожать в другом потоке одновременно с изменением оригинала.
+     * Снимки одного массива можно создавать из нескольких потоков одновременно: счетчик владельцев
+     * устанавливается атомарно. Первый снимок выделяет счетчик у источника памяти массива -
+     * при одновременном создании первых снимков источник должен быть потокобезопасным (как ресурс по умолчанию).
+     *
+     * @return массив, разделяющий буфер с текущим
+     */
+    DynamicArray Snapshot() const;
+
+    /**
+     * Проверка разделения буфера с другими массивами (снимками) ~ O(1).
+     *
+     * @return true - буфер разделяется, false - буфер принадлежит только этому массиву
+     */
+    bool IsShared() const;
+
     /**
      * Добавление элемента в конец массива ~ O(1) или O(n).
      *
      * При недостаточной емкости массив расширяется
-     * на kCapacityGrowthCoefficient с сохранением элементов.
+     * согласно политике увеличения емкости с сохранением элементов
+     * (по умолчанию на kCapacityGrowthCoefficient).
      *
      * @param value - значение добавляемого элемента
      */
@@ -55,7 +160,8 @@ namespace assignment {
      * Вставка элемента в массив по индексу ~ O(n).
      *
      * При недостаточной емкости массив расширяется
-     * на kCapacityGrowthCoefficient с сохранением элементов.
+     * согласно политике увеличения емкости с сохранением элементов
+     * (по умолчанию на kCapacityGrowthCoefficient).
      *
      * @param index - позиция для вставки элемента в массив
      * @param value - значение вставляемого элемента
@@ -63,6 +169,101 @@ namespace assignment {
      */
     bool Insert(int index, int value) override;
 
+    /**
+     * Добавление последовательности элементов в конец массива ~ O(k) или O(n + k).
+     *
+     * Емкость проверяется (и при необходимости расширяется) один раз на всю последовательность.
+     * Последовательность может указывать на элементы самого массива.
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во элементов последовательности
+     * @return true - операция прошла успешно, false - отрицательное кол-во элементов или нулевой указатель
+     */
+    bool AddRange(const int* values, int count);
+
+    /**
+     * Добавление последовательности элементов [first, last) в конец массива ~ O(k) или O(n + k).
+     *
+     * @param first, last - однонаправленные итераторы на границы последовательности
+     * @return true - операция прошла успешно, false - некорректная последовательность
+     */
+    template <typename ForwardIt>
+    bool AddRange(ForwardIt first, ForwardIt last);
+
+    /**
+     * Вставка последовательности элементов в массив по индексу ~ O(n + k).
+     *
+     * Хвост массива сдвигается одним блоком (memmove), последовательность копируется одним блоком.
+     * Последовательность может указывать на элементы самого массива.
+     *
+     * @param index - позиция для вставки первого элемента последовательности
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во элементов последовательности
+     * @return true - операция прошла успешно, false - индекс за пределами массива или некорректная последовательность
+     */
+    bool InsertRange(int index, const int* values, int count);
+
+    /**
+     * Вставка последовательности элементов [first, last) в массив по индексу ~ O(n + k).
+     *
+     * @param index - позиция для вставки первого элемента последовательности
+     * @param first, last - однонаправленные итераторы на границы последовательности
+     * @return true - операция прошла успешно, false - индекс за пределами массива или некорректная последовательность
+     */
+    template <typename ForwardIt>
+    bool InsertRange(int index, ForwardIt first, ForwardIt last);
+
+    /**
+     * Удаление последовательности элементов [index, index + count) из массива ~ O(n).
+     *
+     * Хвост массива сдвигается одним блоком (memmove).
+     * При включенной политике уменьшения емкости массив может быть перенесен в меньший блок памяти.
+     *
+     * @param index - позиция первого удаляемого элемента
+     * @param count - кол-во удаляемых элементов
+     * @return true - операция прошла успешно, false - последовательность за пределами массива
+     */
+    bool RemoveRange(int index, int count);
+
+    /**
+     * Замена содержимого массива последовательностью элементов ~ O(k) или O(n + k).
+     *
+     * Последовательность может указывать на элементы самого массива.
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во элементов последовательности
+     * @return true - операция прошла успешно, false - отрицательное кол-во элементов или нулевой указатель
+     */
+    bool Assign(const int* values, int count);
+
+    /**
+     * Замена содержимого массива последовательностью элементов [first, last) ~ O(k) или O(n + k).
+     *
+     * @param first, last - однонаправленные итераторы на границы последовательности
+     * @return true - операция прошла успешно, false - некорректная последовательность
+     */
+    template <typename ForwardIt>
+    bool Assign(ForwardIt first, ForwardIt last);
+
+    /**
+     * Замена содержимого массива count копиями значения ~ O(k) или O(n + k).
+     *
+     * @param count - новый размер массива
+     * @param value - значение элементов
+     * @return true - операция прошла успешно, false - отрицательное кол-во элементов
+     */
+    bool Assign(int count, int value);
+
+    /**
+     * Заполнение элементов [index, index + count) значением ~ O(k).
+     *
+     * @param index - позиция первого заполняемого элемента
+     * @param count - кол-во заполняемых элементов
+     * @param value - значение элементов
+     * @return true - операция прошла успешно, false - последовательность за пределами массива
+     */
+    bool Fill(int index, int count, int value);
+
     /**
      * Изменение значения элемента массива по индексу ~ O(1).
      *
@@ -72,9 +273,24 @@ namespace assignment {
      */
     bool Set(int index, int new_value) override;
 
+    /**
+     * Изменение значений элементов массива по набору индексов ~ O(count).
+     *
+     * Индексы проверяются один раз до изменения массива, ячейки предварительно запрашиваются (prefetch).
+     * При повторяющихся индексах сохраняется последнее значение.
+     *
+     * @param indices - индексы изменяемых элементов
+     * @param values - новые значения элементов (values[i] для indices[i])
+     * @param count - кол-во индексов
+     * @return true - операция прошла успешно, false - индекс за пределами массива (массив не изменен)
+     */
+    bool SetMany(const int* indices, const int* values, int count);
+
     /**
      * Удаление элемента из массива по индексу ~ O(n).
      *
+     * При включенной политике уменьшения емкости массив может быть перенесен в меньший блок памяти.
+     *
      * @param index - позиция удаляемого элемента в массиве
      * @return значение удаленного элемента или ничего (индекс за пределами списка)
      */
@@ -84,6 +300,7 @@ namespace assignment {
      * Очистка массива ~ O(1).
      *
      * Обнуляет размер массива.
+     * При включенной политике уменьшения емкости высвобождает память ~ O(1).
      */
     void Clear() override;
 
@@ -96,7 +313,24 @@ namespace assignment {
     std::optional<int> Get(int index) const override;
 
     /**
-     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     * Получение значений элементов массива по набору индексов ~ O(count).
+     *
+     * Индексы проверяются один раз для всего набора, выборка выполняется инструкцией gather (AVX2)
+     * с предвыборкой ячеек, см. simd::Gather.
+     *
+     * @param indices - индексы элементов
+     * @param count - кол-во индексов
+     * @param out - буфер для значений (не менее count ячеек)
+     * @return true - операция прошла успешно, false - индекс за пределами массива (out не изменен)
+     */
+    bool GetMany(const int* indices, int count, int* out) const;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n) или O(1) (с хеш-индексом).
+     *
+     * Использует векторные инструкции (SSE2/AVX2/AVX-512), см. simd::FindFirst.
+     * При установленном пуле потоков большие массивы просматриваются параллельно, см. parallel::FindFirst.
+     * При включенном хеш-индексе поиск выполняется по индексу, см. EnableHashIndex.
      *
      * @param value - значение элемента
      * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
@@ -104,13 +338,27 @@ namespace assignment {
     std::optional<int> IndexOf(int value) const override;
 
     /**
-     * Проверка наличия элемента в массиве по значению ~ O(n).
+     * Проверка наличия элемента в массиве по значению ~ O(n) или O(1) (с хеш-индексом).
+     *
+     * Использует векторные инструкции (SSE2/AVX2/AVX-512), см. simd::FindFirst.
+     * При установленном пуле потоков большие массивы просматриваются параллельно, см. parallel::FindFirst.
+     * При включенном хеш-индексе поиск выполняется по индексу, см. EnableHashIndex.
      *
      * @param value - значение элемента
      * @return true - при наличии элемента в массиве, false - при отсутствии элемента
      */
     bool Contains(int value) const override;
 
+    /**
+     * Подсчет кол-ва элементов с указанным значением ~ O(n).
+     *
+     * Использует векторные инструкции, при установленном пуле потоков - параллельный проход.
+     *
+     * @param value - значение элемента
+     * @return кол-во элементов, равных value
+     */
+    int Count(int value) const;
+
     /**
      * Проверка пустоты массива ~ O(1).
      *
@@ -140,10 +388,333 @@ namespace assignment {
      */
     bool Resize(int new_capacity);
 
+    /**
+     * Возвращает политику увеличения емкости массива ~ O(1).
+     *
+     * @return политика увеличения емкости
+     */
+    const GrowthPolicy& growth_policy() const;
+
+    /**
+     * Установка политики увеличения емкости массива ~ O(1).
+     *
+     * @param growth_policy - новая политика увеличения емкости
+     */
+    void set_growth_policy(GrowthPolicy growth_policy);
+
+    /**
+     * Уменьшение емкости массива до его размера ~ O(n).
+     *
+     * Емкость массива остается положительной (не меньше 1).
+     *
+     * @return true - емкость уменьшена, false - емкость уже равна размеру
+     */
+    bool ShrinkToFit();
+
+    /**
+     * Возвращает политику уменьшения емкости массива ~ O(1).
+     *
+     * @return политика уменьшения емкости
+     */
+    const ShrinkPolicy& shrink_policy() const;
+
+    /**
+     * Установка политики уменьшения емкости массива ~ O(1) или O(n).
+     *
+     * Политика применяется сразу же к текущему размеру массива.
+     *
+     * @param shrink_policy - новая политика уменьшения емкости
+     */
+    void set_shrink_policy(ShrinkPolicy shrink_policy);
+
+    /**
+     * Возвращает кол-во байт, высвобожденных при уменьшении емкости массива ~ O(1).
+     *
+     * Учитываются ShrinkToFit и уменьшения по политике уменьшения емкости.
+     *
+     * @return суммарное кол-во высвобожденных байт
+     */
+    std::size_t reclaimed_bytes() const;
+
+    /**
+     * Возвращает источник памяти массива ~ O(1).
+     *
+     * @return указатель на источник памяти (по умолчанию std::pmr::get_default_resource())
+     */
+    std::pmr::memory_resource* resource() const;
+
+    /**
+     * Включение параллельного поиска (IndexOf, Contains, Count) ~ O(1).
+     *
+     * Поиск выполняется в пуле потоков для массивов размером не меньше min_size,
+     * меньшие массивы просматриваются в вызывающем потоке. Пул должен существовать дольше массива
+     * (или до отключения параллельного поиска).
+     *
+     * @param thread_pool - пул потоков (nullptr - отключить параллельный поиск)
+     * @param min_size - минимальный размер массива для параллельного поиска (опционально)
+     */
+    void set_thread_pool(ThreadPool* thread_pool, int min_size = kParallelScanMinSize);
+
+    /**
+     * Возвращает пул потоков для параллельного поиска ~ O(1).
+     *
+     * @return указатель на пул потоков или nullptr (параллельный поиск отключен)
+     */
+    ThreadPool* thread_pool() const;
+
+    /**
+     * Включение хеш-индекса "значение -> позиция первого вхождения" для IndexOf и Contains ~ O(n).
+     *
+     * Индекс поддерживается при изменении массива:
+     * Add, Insert, AddRange, InsertRange, Remove, Clear - сразу (вставка и удаление в середине
+     * дополнительно сдвигают позиции в индексе ~ O(емкость индекса));
+     * Set - сразу, при перезаписи первого вхождения следующее вхождение ищется просмотром ~ O(n);
+     * RemoveRange нескольких элементов, Assign, Load - индекс перестраивается сразу ~ O(n);
+     * Fill, SetMany, неконстантные итераторы и представление - индекс помечается устаревшим и перестраивается
+     * при следующем изменении массива перечисленными выше операциями или вызове EnableHashIndex ~ O(n).
+     * Пока индекс устарел, IndexOf и Contains просматривают массив.
+     *
+     * Индекс занимает 16-32 байта на каждое различное значение (см. hash_index_memory_usage).
+     * Поиск индекс не изменяет: константные методы можно вызывать из нескольких потоков одновременно.
+     * Снимки массива индекс не получают.
+     */
+    void EnableHashIndex();
+
+    /**
+     * Отключение хеш-индекса с высвобождением его памяти ~ O(1).
+     */
+    void DisableHashIndex();
+
+    /**
+     * Проверка наличия хеш-индекса ~ O(1).
+     *
+     * @return true - хеш-индекс включен, false - поиск просмотром массива
+     */
+    bool has_hash_index() const;
+
+    /**
+     * Возвращает объем памяти, занятый хеш-индексом ~ O(1).
+     *
+     * @return кол-во байт (0 - индекс отключен)
+     */
+    std::size_t hash_index_memory_usage() const;
+
+    using iterator = int*;
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива ~ O(1).
+     *
+     * Неконстантные итераторы и представление предварительно отделяют буфер от снимков ~ O(n), см. Snapshot.
+     * Итераторы действительны до изменения емкости массива.
+     */
+    iterator begin();
+
+    iterator end();
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    const_iterator cbegin() const;
+
+    const_iterator cend() const;
+
+    /**
+     * Непрерывное представление элементов массива [0, size) ~ O(1).
+     *
+     * @return представление для изменения элементов
+     */
+    Span<int> span();
+
+    /**
+     * Непрерывное представление элементов массива [0, size) только для чтения ~ O(1).
+     *
+     * @return представление для чтения элементов
+     */
+    Span<const int> span() const;
+
+    /**
+     * Сохранение элементов массива в двоичном формате (binary_format.hpp) ~ O(n).
+     *
+     * Значения записываются одним блоком без промежуточного копирования.
+     *
+     * @param fd - дескриптор, открытый на запись
+     * @throws system_error при ошибке записи
+     */
+    void Save(int fd) const;
+
+    /**
+     * Загрузка элементов массива, сохраненных методом Save ~ O(n).
+     *
+     * Запись в обычном файле отображается в память (MAP_PRIVATE) и становится буфером массива без копирования,
+     * емкость массива равна кол-ву элементов. Из каналов и сокетов значения читаются в новый буфер.
+     * Политики емкости и источник памяти сохраняются. При ошибке массив не изменяется.
+     *
+     * @param fd - дескриптор, открытый на чтение
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при неизвестном формате, другом типе контейнера, обрыве записи
+     *                       или несовпадении контрольной суммы
+     */
+    void Load(int fd);
+
     // ДЛЯ ТЕСТИРОВАНИЯ
     DynamicArray(const std::vector<int>& values, int capacity);
 
     std::vector<int> toVector(std::optional<int> size = std::nullopt) const;
+
+   private:
+    // признак конструктора снимка
+    struct SnapshotTag {};
+
+    /**
+     * Создание снимка, разделяющего буфер с other ~ O(1).
+     *
+     * Счетчик владельцев должен быть заранее создан и увеличен.
+     */
+    DynamicArray(const DynamicArray& other, SnapshotTag);
+
+    /**
+     * Поиск индекса первого вхождения значения (последовательно или параллельно) ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс первого вхождения или -1 (в случае отсутствия значения)
+     */
+    int FindFirst(int value) const;
+
+    /**
+     * Выделение блока памяти под указанное кол-во ячеек через источник памяти ~ O(1).
+     *
+     * @param capacity - кол-во ячеек
+     * @return указатель на выделенный (неинициализированный) блок памяти
+     */
+    int* Allocate(int capacity);
+
+    /**
+     * Возврат блока памяти источнику памяти ~ O(1).
+     *
+     * Отображенный буфер загруженной записи вместо этого снимается с отображения.
+     *
+     * @param data - указатель на блок памяти (может быть нулевым)
+     * @param capacity - кол-во ячеек блока
+     */
+    void Deallocate(int* data, int capacity);
+
+    /**
+     * Перенос элементов в новый блок памяти указанной емкости ~ O(n).
+     *
+     * @param new_capacity - новая емкость массива, new_capacity >= size
+     */
+    void Reallocate(int new_capacity);
+
+    /**
+     * Отказ от владения буфером ~ O(1).
+     *
+     * Буфер высвобождается, если массив был его последним владельцем.
+     */
+    void ReleaseBuffer();
+
+    /**
+     * Получение буфера в единоличное владение перед изменением элементов ~ O(1) или O(n).
+     *
+     * Разделяемый буфер копируется (кроме случая, когда остальные владельцы уже уничтожены).
+     */
+    void MakeUnique();
+
+    /**
+     * Обмен счетчиками владельцев буфера двух массивов ~ O(1).
+     */
+    void SwapSharedRefs(DynamicArray& other) noexcept;
+
+    /**
+     * Обмен содержимым двух массивов ~ O(1).
+     */
+    void Swap(DynamicArray& other) noexcept;
+
+    /**
+     * Уменьшение емкости массива согласно политике уменьшения емкости ~ O(1) или O(n).
+     */
+    void ShrinkIfNeeded();
+
+    /**
+     * Освобождение места под count элементов начиная с позиции index ~ O(n).
+     *
+     * Расширяет массив (не более одного раза) и сдвигает хвост массива одним блоком.
+     * Размер массива увеличивается на count, содержимое освобожденных ячеек не определено.
+     *
+     * @param index - позиция начала освобождаемого места, 0 <= index <= size
+     * @param count - кол-во освобождаемых ячеек, count >= 0
+     * @return указатель на первую освобожденную ячейку
+     */
+    int* OpenGap(int index, int count);
+
+    /**
+     * Учет в хеш-индексе элементов, вставленных в [index, index + count) ~ O(count) или O(count + емкость индекса).
+     *
+     * Позиции после вставленных элементов сдвигаются на count.
+     *
+     * @param index - позиция первого вставленного элемента
+     * @param count - кол-во вставленных элементов
+     */
+    void IndexInserted(int index, int count);
+
+    /**
+     * Пометка хеш-индекса устаревшим (непрослеживаемое изменение элементов) ~ O(1).
+     */
+    void InvalidateHashIndex();
+
+    /**
+     * Перестроение хеш-индекса по элементам массива (массовое изменение элементов) ~ O(n).
+     */
+    void RebuildHashIndex();
+
+    // итератор является указателем на int (последовательность может указывать на буфер массива)
+    template <typename It>
+    static constexpr bool kIsIntPointer =
+        std::is_pointer_v<It> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, int>;
   };
 
+  template <typename ForwardIt>
+  bool DynamicArray::AddRange(ForwardIt first, ForwardIt last) {
+    return InsertRange(size_, first, last);
+  }
+
+  template <typename ForwardIt>
+  bool DynamicArray::InsertRange(int index, ForwardIt first, ForwardIt last) {
+    using Category = typename std::iterator_traits<ForwardIt>::iterator_category;
+    static_assert(std::is_base_of_v<std::forward_iterator_tag, Category>, "forward iterators are required");
+
+    if constexpr (kIsIntPointer<ForwardIt>) {
+      return InsertRange(index, first, static_cast<int>(last - first));
+    } else {
+      const auto count = std::distance(first, last);
+      if ((index < 0)||(index > size_)||(count < 0)) {
+        return false;
+      }
+      // итераторы произвольного типа не могут указывать на внутренний буфер массива
+      std::copy(first, last, OpenGap(index, static_cast<int>(count)));
+      IndexInserted(index, static_cast<int>(count));
+      return true;
+    }
+  }
+
+  template <typename ForwardIt>
+  bool DynamicArray::Assign(ForwardIt first, ForwardIt last) {
+    using Category = typename std::iterator_traits<ForwardIt>::iterator_category;
+    static_assert(std::is_base_of_v<std::forward_iterator_tag, Category>, "forward iterators are required");
+
+    if constexpr (kIsIntPointer<ForwardIt>) {
+      return Assign(first, static_cast<int>(last - first));
+    } else {
+      const auto count = std::distance(first, last);
+      if (count < 0) {
+        return false;
+      }
+      size_ = 0;
+      std::copy(first, last, OpenGap(0, static_cast<int>(count)));
+      RebuildHashIndex();
+      return true;
+    }
+  }
+
 }  // namespace assignment
\ No newline at end of file
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <optional>  // optional
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/growth_policy.hpp"  // GrowthPolicy
+#include "assignment/private/list.hpp"   // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "буфер с разрывом" (gap buffer).
+   *
+   * Элементы хранятся в одном блоке памяти, разделенном на две части свободным промежутком (разрывом).
+   * Разрыв перемещается к месту вставки/удаления (memmove участка между старым и новым положением),
+   * поэтому серия вставок и удалений рядом с курсором выполняется за O(1) амортизированно.
+   */
+  struct GapBuffer : List {
+   private:
+    // поля структуры
+    int* data_{nullptr};  // указатель на выделенный блок памяти
+    int capacity_{0};     // емкость буфера (кол-во ячеек, включая разрыв)
+    int gap_begin_{0};    // начало разрыва (индекс первой свободной ячейки)
+    int gap_end_{0};      // конец разрыва (индекс первой ячейки после разрыва)
+
+    GrowthPolicy growth_policy_{GrowthPolicy::Geometric2()};  // политика увеличения емкости
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = 16;  // начальная емкость буфера
+
+    /**
+     * Создание пустого буфера с указанной емкостью ~ O(1).
+     *
+     * @param capacity - начальная емкость буфера (опционально)
+     * @param growth_policy - политика увеличения емкости (по умолчанию - удвоение)
+     * @throws invalid_argument при указании неположительной емкости буфера
+     */
+    explicit GapBuffer(int capacity = kInitCapacity, GrowthPolicy growth_policy = GrowthPolicy::Geometric2());
+
+    /**
+     * Создание копии буфера ~ O(n).
+     *
+     * @param other - копируемый буфер
+     */
+    GapBuffer(const GapBuffer& other);
+
+    /**
+     * Перемещение буфера ~ O(1).
+     *
+     * @param other - перемещаемый буфер, становится пустым (без выделенной памяти)
+     */
+    GapBuffer(GapBuffer&& other) noexcept;
+
+    GapBuffer& operator=(const GapBuffer& other);
+
+    GapBuffer& operator=(GapBuffer&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(1).
+     *
+     * Высвобождает выделенную память.
+     */
+    ~GapBuffer() override;
+
+    /**
+     * Добавление элемента в конец буфера ~ O(1) амортизированно (после перемещения разрыва в конец).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента по индексу ~ O(|index - cursor|) + O(1) амортизированно.
+     *
+     * Разрыв перемещается к позиции вставки, курсор оказывается после вставленного элемента.
+     *
+     * @param index - позиция для вставки элемента
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами буфера
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами буфера
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента по индексу ~ O(|index - cursor|).
+     *
+     * Разрыв перемещается к позиции удаления и поглощает удаленный элемент, курсор оказывается на index.
+     *
+     * @param index - позиция удаляемого элемента
+     * @return значение удаленного элемента или ничего (индекс за пределами буфера)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка буфера ~ O(1).
+     *
+     * Разрыв занимает весь буфер, емкость сохраняется.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента по индексу ~ O(1).
+     *
+     * @param index - позиция элемента
+     * @return значение найденного элемента или ничего (индекс за пределами буфера)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * Части до и после разрыва просматриваются векторными инструкциями, см. simd::FindFirst.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в буфере, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты буфера ~ O(1).
+     *
+     * @return true - буфер пустой, false - в буфере есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер буфера ~ O(1).
+     *
+     * @return количество элементов в буфере
+     */
+    int size() const override;
+
+    /**
+     * Возвращает емкость буфера ~ O(1).
+     *
+     * @return количество ячеек буфера (элементы и разрыв)
+     */
+    int capacity() const;
+
+    /**
+     * Возвращает положение курсора (начала разрыва) ~ O(1).
+     *
+     * @return индекс, перед которым находится разрыв
+     */
+    int cursor() const;
+
+    /**
+     * Перемещение курсора (разрыва) к указанной позиции ~ O(|index - cursor|).
+     *
+     * @param index - новая позиция курсора в [0, size]
+     * @return true - операция прошла успешно, false - индекс за пределами буфера
+     */
+    bool MoveCursor(int index);
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Возвращает длину разрыва ~ O(1).
+     */
+    int GapSize() const;
+
+    /**
+     * Перевод логического индекса элемента в индекс ячейки ~ O(1).
+     *
+     * @param index - логический индекс в [0, size)
+     * @return индекс ячейки в блоке памяти
+     */
+    int Physical(int index) const;
+
+    /**
+     * Перемещение разрыва к позиции index ~ O(|index - cursor|).
+     *
+     * @param index - новая позиция разрыва в [0, size]
+     */
+    void MoveGap(int index);
+
+    /**
+     * Увеличение емкости согласно политике увеличения емкости ~ O(n).
+     *
+     * Разрыв сохраняет свое положение и расширяется на все добавленные ячейки.
+     */
+    void Grow();
+
+    /**
+     * Обмен содержимым двух буферов ~ O(1).
+     */
+    void Swap(GapBuffer& other) noexcept;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <functional>  // function
+
+namespace assignment {
+
+  /**
+   * Политика увеличения емкости массивов (DynamicArray, ArrayStack).
+   *
+   * Определяет новую емкость массива при нехватке свободных ячеек:
+   *  - аддитивный рост (емкость + k) ~ O(n) на добавление в худшем случае, O(n^2) на серию из n добавлений;
+   *  - геометрический рост (емкость * 1.5, емкость * 2) ~ амортизированное O(1) на добавление;
+   *  - пользовательская функция.
+   *
+   * Политика по умолчанию выбирается на этапе компиляции (см. Default).
+   */
+  struct GrowthPolicy {
+    // функция вычисления новой емкости по текущей емкости массива
+    using Function = std::function<int(int capacity)>;
+
+    // разновидности политик
+    enum class Kind {
+      kAdditive,     // емкость + increment
+      kGeometric15,  // емкость * 1.5
+      kGeometric2,   // емкость * 2
+      kCustom        // пользовательская функция
+    };
+
+   private:
+    // поля структуры
+    Kind kind_{Kind::kAdditive};       // разновидность политики
+    int increment_{kDefaultIncrement};  // прирост емкости (для аддитивной политики)
+    Function function_;                 // пользовательская функция (для kCustom)
+
+   public:
+    // константы структуры
+    static constexpr int kDefaultIncrement = 5;  // прирост емкости аддитивной политики по умолчанию
+
+    /**
+     * Аддитивная политика: новая емкость = емкость + increment.
+     *
+     * @param increment - прирост емкости (опционально)
+     * @throws invalid_argument при указании неположительного прироста
+     */
+    static GrowthPolicy Additive(int increment = kDefaultIncrement);
+
+    /**
+     * Геометрическая политика: новая емкость = емкость * 1.5.
+     */
+    static GrowthPolicy Geometric15();
+
+    /**
+     * Геометрическая политика: новая емкость = емкость * 2.
+     */
+    static GrowthPolicy Geometric2();
+
+    /**
+     * Пользовательская политика.
+     *
+     * Результат функции ограничивается снизу требуемой емкостью (см. NextCapacity).
+     *
+     * @param function - функция вычисления новой емкости по текущей
+     * @throws invalid_argument при передаче пустой функции
+     */
+    static GrowthPolicy Custom(Function function);
+
+    /**
+     * Политика по умолчанию, выбирается на этапе компиляции.
+     *
+     * Определяется макросами ASSIGNMENT_GROWTH_POLICY_GEOMETRIC15 / ASSIGNMENT_GROWTH_POLICY_GEOMETRIC2
+     * (CMake опция GROWTH_POLICY), при их отсутствии - аддитивная политика.
+     */
+    static GrowthPolicy Default();
+
+    /**
+     * Вычисление новой емкости массива.
+     *
+     * @param capacity - текущая емкость массива
+     * @param min_capacity - минимально необходимая емкость
+     * @return новая емкость: не меньше min_capacity и больше capacity (с ограничением INT_MAX)
+     */
+    int NextCapacity(int capacity, int min_capacity) const;
+
+    /**
+     * Возвращает разновидность политики.
+     *
+     * @return разновидность политики
+     */
+    Kind kind() const;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>          // size_t
+#include <memory_resource>  // memory_resource, get_default_resource
+
+namespace assignment {
+
+  /**
+   * Хеш-индекс "значение -> позиция первого вхождения" (открытая адресация, линейное пробирование).
+   *
+   * Используется массивом DynamicArray для поиска по значению за O(1), см. DynamicArray::EnableHashIndex.
+   * Емкость таблицы - степень двойки, заполненность не превышает 1/2. Удаление выполняется
+   * обратным сдвигом цепочки пробирования (без надгробий), поэтому длина цепочек не растет со временем.
+   *
+   * Индекс может быть помечен устаревшим (Invalidate) - владелец не ищет по нему
+   * до перестроения (Build).
+   */
+  struct HashIndex {
+   private:
+    // ячейка таблицы
+    struct Slot {
+      int key;    // значение
+      int index;  // позиция первого вхождения (kEmpty - ячейка свободна)
+    };
+
+    // поля структуры
+    int size_{0};           // кол-во значений в индексе
+    int capacity_{0};       // кол-во ячеек таблицы (степень двойки или 0)
+    Slot* slots_{nullptr};  // таблица
+    bool stale_{false};     // индекс устарел и должен быть перестроен
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};  // источник памяти для таблицы
+
+   public:
+    // константы структуры
+    static constexpr int kEmpty = -1;        // признак свободной ячейки
+    static constexpr int kMinCapacity = 16;  // минимальная емкость непустой таблицы
+
+    /**
+     * Создание пустого индекса ~ O(1).
+     *
+     * @param resource - источник памяти для таблицы (опционально)
+     * @throws invalid_argument при нулевом указателе на источник памяти
+     */
+    explicit HashIndex(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * Создание копии индекса ~ O(capacity).
+     *
+     * @param other - копируемый индекс
+     */
+    HashIndex(const HashIndex& other);
+
+    HashIndex& operator=(const HashIndex&) = delete;
+
+    /**
+     * Деструктор ~ O(1).
+     */
+    ~HashIndex();
+
+    /**
+     * Перестроение индекса по последовательности значений ~ O(n).
+     *
+     * Снимает признак устаревания.
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во значений
+     */
+    void Build(const int* values, int count);
+
+    /**
+     * Поиск позиции первого вхождения значения ~ O(1) (в среднем).
+     *
+     * @param key - значение
+     * @return позиция первого вхождения или kEmpty (значения нет в индексе)
+     */
+    int Find(int key) const;
+
+    /**
+     * Добавление вхождения значения ~ O(1) (амортизированно).
+     *
+     * Позиция запоминается, если значения нет в индексе или его первое вхождение находится дальше.
+     *
+     * @param key - значение
+     * @param index - позиция вхождения
+     */
+    void Add(int key, int index);
+
+    /**
+     * Установка позиции первого вхождения значения ~ O(1) (амортизированно).
+     *
+     * @param key - значение
+     * @param index - позиция первого вхождения
+     */
+    void Assign(int key, int index);
+
+    /**
+     * Удаление значения из индекса ~ O(1) (в среднем).
+     *
+     * @param key - значение
+     * @return true - значение удалено, false - значения нет в индексе
+     */
+    bool Erase(int key);
+
+    /**
+     * Сдвиг позиций не меньше index на delta (вставка и удаление элементов) ~ O(capacity).
+     *
+     * @param index - первая сдвигаемая позиция
+     * @param delta - величина сдвига
+     */
+    void Shift(int index, int delta);
+
+    /**
+     * Очистка индекса ~ O(capacity).
+     *
+     * Таблица сохраняется, признак устаревания снимается.
+     */
+    void Clear();
+
+    /**
+     * Пометка индекса устаревшим ~ O(1).
+     */
+    void Invalidate();
+
+    /**
+     * Проверка устаревания индекса ~ O(1).
+     *
+     * @return true - индекс должен быть перестроен перед поиском, false - индекс актуален
+     */
+    bool stale() const;
+
+    /**
+     * Возвращает кол-во значений в индексе ~ O(1).
+     *
+     * @return кол-во различных значений
+     */
+    int size() const;
+
+    /**
+     * Возвращает объем памяти, занятый таблицей ~ O(1).
+     *
+     * @return кол-во байт
+     */
+    std::size_t memory_usage() const;
+
+   private:
+    /**
+     * Поиск ячейки значения или свободной ячейки, в которой цепочка пробирования обрывается ~ O(1) (в среднем).
+     *
+     * @param key - значение
+     * @return номер ячейки (таблица непустая)
+     */
+    int Probe(int key) const;
+
+    /**
+     * Увеличение таблицы до емкости, вмещающей count значений ~ O(capacity).
+     *
+     * @param count - ожидаемое кол-во значений
+     */
+    void Reserve(int count);
+
+    /**
+     * Номер начальной ячейки цепочки пробирования значения ~ O(1).
+     *
+     * @param key - значение
+     * @return номер ячейки
+     */
+    int Home(int key) const;
+  };
+
+}  // namespace assignment
@@ -1,22 +1,35 @@
 #pragma once
 
-#include <vector>  // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+#include <memory_resource>  // memory_resource
+#include <vector>           // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
 
-#include "assignment/node.hpp"          // Node
-#include "assignment/private/list.hpp"  // List
+#include "assignment/node.hpp"           // Node
+#include "assignment/node_pool.hpp"      // NodePool
+#include "assignment/node_iterator.hpp"  // NodeIterator
+#include "assignment/private/list.hpp"   // List
 
 namespace assignment {
 
   /**
    * Структура данных "связный список".
    * Хранит в себе элементы в виде последовательности "узлов".
+   *
+   * Узлы выделяются из собственного пула списка (NodePool): удаленные узлы переиспользуются,
+   * очистка возвращает память блоками.
+   *
+   * Список запоминает последний найденный по индексу узел ("палец") и продолжает поиск от него,
+   * если искомый индекс не меньше: последовательный проход Get(0), Get(1), ... выполняется за O(n) в сумме.
+   * Поэтому даже чтение по индексу изменяет состояние списка - одновременные вызовы из разных потоков недопустимы.
    */
   struct LinkedList : List {
    private:
     // поля структуры
-    int size_{0};           // кол-вод узлов в списке
-    Node* front_{nullptr};  // указатель на начальный узел
-    Node* back_{nullptr};   // указатель на конечный узел
+    int size_{0};                         // кол-вод узлов в списке
+    Node* front_{nullptr};                // указатель на начальный узел
+    Node* back_{nullptr};                 // указатель на конечный узел
+    NodePool<Node> pool_;                 // пул узлов (удаленные узлы переиспользуются)
+    mutable int finger_index_{-1};        // индекс последнего найденного узла ("палец", -1 - не задан)
+    mutable Node* finger_node_{nullptr};  // последний найденный узел
 
    public:
     /**
@@ -27,7 +40,38 @@ namespace assignment {
     LinkedList() = default;
 
     /**
-     * Деструктор ~ O(n).
+     * Создание пустого связного списка с источником памяти для узлов ~ O(1).
+     *
+     * Блоки узлов запрашиваются у resource (например, MonotonicArena).
+     * Источник памяти должен существовать дольше списка.
+     *
+     * @param resource - источник памяти
+     * @throws invalid_argument при нулевом указателе на ресурс
+     */
+    explicit LinkedList(std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии списка ~ O(n).
+     *
+     * Узлы копии выделяются одним непрерывным блоком в пуле копии (тот же источник памяти).
+     *
+     * @param other - копируемый список
+     */
+    LinkedList(const LinkedList& other);
+
+    LinkedList& operator=(const LinkedList& other);
+
+    /**
+     * Перемещение списка ~ O(1).
+     *
+     * @param other - перемещаемый список, становится пустым
+     */
+    LinkedList(LinkedList&& other) noexcept;
+
+    LinkedList& operator=(LinkedList&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков пула).
      *
      * Высвобождает выделенную память.
      * Устанавливает поля в нулевые значения.
@@ -43,7 +87,7 @@ namespace assignment {
 
     /**
      * Вставка элемента в список по индексу ~ O(n).
-     * Вставка в начало или конец списка ~ O(1).
+     * Вставка в начало или конец списка, вставка после последнего найденного узла ~ O(1).
      *
      * @param index - позиция для вставки элемента в список
      * @param value - значение вставляемого элемента
@@ -53,6 +97,7 @@ namespace assignment {
 
     /**
      * Изменение значения элемента списка по индексу ~ O(n).
+     * Изменение элемента не раньше последнего найденного ~ O(index - индекс пальца).
      *
      * @param index - позиция изменяемого элемента списка
      * @param new_value - новое значение элемента
@@ -62,7 +107,9 @@ namespace assignment {
 
     /**
      * Удаление элемента из списка по индексу ~ O(n).
-     * Удаление элемента с начала списка ~ O(1).
+     * Удаление элемента с начала списка, удаление после последнего найденного узла ~ O(1).
+     *
+     * Узел возвращается в пул и переиспользуется следующим добавлением.
      *
      * @param index - позиция удаляемого элемента в списке
      * @return значение удаленного элемента или ничего (индекс за пределами списка)
@@ -70,21 +117,48 @@ namespace assignment {
     std::optional<int> Remove(int index) override;
 
     /**
-     * Очистка списка ~ O(n).
+     * Очистка списка ~ O(кол-во блоков пула).
      *
-     * Высвобождение выделенной под узлы памяти.
+     * Узлы высвобождаются блоками, наибольший блок пула сохраняется для следующих добавлений.
      * Обнуление полей списка.
      */
     void Clear() override;
 
     /**
      * Получение значения элемента списка по индексу ~ O(n).
+     * Получение элемента не раньше последнего найденного ~ O(index - индекс пальца), конечного ~ O(1).
      *
      * @param index - позиция элемента в списке
      * @return значение найденного элемента или ничего (индекс за пределами списка)
      */
     std::optional<int> Get(int index) const override;
 
+    /**
+     * Получение значений элементов списка по набору индексов ~ O(n + count * log(count)).
+     *
+     * Набор индексов упорядочивается и разрешается за один проход по списку
+     * (вместо count проходов от начала списка при вызовах Get).
+     *
+     * @param indices - индексы элементов
+     * @param count - кол-во индексов
+     * @param out - буфер для значений (не менее count ячеек)
+     * @return true - операция прошла успешно, false - индекс за пределами списка (out не изменен)
+     */
+    bool GetMany(const int* indices, int count, int* out) const;
+
+    /**
+     * Изменение значений элементов списка по набору индексов ~ O(n + count * log(count)).
+     *
+     * Набор индексов упорядочивается и применяется за один проход по списку.
+     * При повторяющихся индексах сохраняется последнее значение.
+     *
+     * @param indices - индексы изменяемых элементов
+     * @param values - новые значения элементов (values[i] для indices[i])
+     * @param count - кол-во индексов
+     * @return true - операция прошла успешно, false - индекс за пределами списка (список не изменен)
+     */
+    bool SetMany(const int* indices, const int* values, int count);
+
     /**
      * Поиск индекса первого вхождения узла с указанным значением ~ O(n).
      *
@@ -115,6 +189,13 @@ namespace assignment {
      */
     int size() const override;
 
+    /**
+     * Возвращает пул узлов списка ~ O(1).
+     *
+     * @return пул узлов (кол-во узлов и блоков, источник памяти)
+     */
+    const NodePool<Node>& pool() const;
+
     /**
      * Возвращает начальный элемент списка ~ O(1).
      *
@@ -133,16 +214,172 @@ namespace assignment {
      * Поиск узла по индексу ~ O(n).
      *
      * Используется для операций над списком, выполняемых по индексу.
+     * Поиск продолжается от последнего найденного узла, если index не меньше его индекса;
+     * найденный узел запоминается.
      *
      * @param index - позиция узла в списке
      * @return указатель на найденный узел или nullptr (индекс за пределами списка)
      */
     Node* FindNode(int index) const;
 
+    /**
+     * Курсор: позиция в списке для последовательного прохода с изменениями.
+     *
+     * Переход к следующему узлу, вставка и удаление после текущего узла ~ O(1), без поиска по индексу.
+     * Курсор действителен до удаления его узла (в том числе другим курсором), очистки или загрузки списка.
+     *
+     * Индекс курсора - позиция при создании плюс кол-во переходов Next: изменения списка перед узлом
+     * курсора (Insert/Remove по индексу, другие курсоры) его не обновляют. Вставка и удаление курсором
+     * не зависят от индекса и сбрасывают палец списка.
+     */
+    struct Cursor {
+     private:
+      // поля структуры
+      LinkedList* list_{nullptr};  // список курсора
+      Node* node_{nullptr};        // текущий узел (nullptr - конец списка)
+      int index_{0};               // индекс текущего узла (размер списка в конце), без учета изменений перед узлом
+
+      Cursor(LinkedList* list, Node* node, int index);
+
+      friend struct LinkedList;
+
+     public:
+      /**
+       * Проверка достижения конца списка ~ O(1).
+       *
+       * @return true - курсор за последним узлом, false - курсор на узле
+       */
+      bool IsEnd() const;
+
+      /**
+       * Возвращает индекс текущего узла ~ O(1).
+       *
+       * @return индекс узла (размер списка в конце), если список не изменялся перед узлом курсора
+       */
+      int index() const;
+
+      /**
+       * Возвращает значение текущего узла ~ O(1).
+       *
+       * @return значение узла или ничего (курсор в конце)
+       */
+      std::optional<int> value() const;
+
+      /**
+       * Изменение значения текущего узла ~ O(1).
+       *
+       * @param new_value - новое значение
+       * @return true - операция прошла успешно, false - курсор в конце
+       */
+      bool Set(int new_value);
+
+      /**
+       * Переход к следующему узлу ~ O(1).
+       *
+       * @return true - курсор на следующем узле, false - достигнут конец (или курсор уже в конце)
+       */
+      bool Next();
+
+      /**
+       * Вставка элемента после текущего узла ~ O(1).
+       *
+       * Курсор остается на текущем узле, вставленный узел - следующий.
+       *
+       * @param value - значение вставляемого элемента
+       * @return true - операция прошла успешно, false - курсор в конце
+       */
+      bool InsertAfter(int value);
+
+      /**
+       * Удаление элемента, следующего за текущим узлом ~ O(1).
+       *
+       * @return значение удаленного элемента или ничего (курсор в конце или на последнем узле)
+       */
+      std::optional<int> RemoveAfter();
+    };
+
+    /**
+     * Создание курсора на узле по индексу ~ O(n) (поиск по индексу, см. FindNode).
+     *
+     * @param index - позиция узла; индекс за пределами [0, size) - курсор в конце списка
+     * @return курсор
+     */
+    Cursor cursor(int index = 0);
+
+    using iterator = NodeIterator<int>;
+    using const_iterator = NodeIterator<const int>;
+
+    /**
+     * Однонаправленные итераторы по элементам списка ~ O(1).
+     *
+     * Полный проход по списку итератором ~ O(n), проход через Get(index) ~ O(n^2).
+     * Итератор действителен до удаления его узла из списка.
+     */
+    iterator begin();
+
+    iterator end();
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    const_iterator cbegin() const;
+
+    const_iterator cend() const;
+
+    /**
+     * Сохранение элементов списка в двоичном формате (binary_format.hpp) ~ O(n).
+     *
+     * @param fd - дескриптор, открытый на запись
+     * @throws system_error при ошибке записи
+     */
+    void Save(int fd) const;
+
+    /**
+     * Загрузка элементов списка, сохраненных методом Save ~ O(n).
+     *
+     * Узлы создаются в одном непрерывном блоке пула (одно выделение памяти, соседние узлы - по соседним адресам).
+     * Текущие элементы удаляются. При ошибке список не изменяется.
+     *
+     * @param fd - дескриптор, открытый на чтение
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при неизвестном формате, другом типе контейнера, обрыве записи
+     *                       или несовпадении контрольной суммы
+     */
+    void Load(int fd);
+
     // ДЛЯ ТЕСТИРОВАНИЯ
     explicit LinkedList(const std::vector<int>& values);
 
     std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Вставка узла после узла node с индексом index ~ O(1).
+     *
+     * Индекс пальца после позиции вставки сдвигается; при неизвестном индексе (index < 0) палец сбрасывается.
+     */
+    void InsertAfterNode(Node* node, int index, int value);
+
+    /**
+     * Удаление узла, следующего за узлом node с индексом index ~ O(1).
+     *
+     * Палец на удаляемом узле переносится на node, палец после него сдвигается;
+     * при неизвестном индексе (index < 0) палец сбрасывается.
+     *
+     * @return значение удаленного узла
+     */
+    int RemoveAfterNode(Node* node, int index);
+
+    /**
+     * Сброс пальца ~ O(1).
+     */
+    void ResetFinger() const;
+
+    /**
+     * Обмен содержимым двух списков ~ O(1).
+     */
+    void Swap(LinkedList& other) noexcept;
   };
 
 }  // namespace assignment
\ No newline at end of file
@@ -1,14 +1,20 @@
 #pragma once
 
+#include <memory_resource>  // memory_resource
 #include <vector>
 
 #include "assignment/node.hpp"           // Node
+#include "assignment/node_pool.hpp"      // NodePool
+#include "assignment/node_iterator.hpp"  // NodeIterator
 #include "assignment/private/queue.hpp"  // Queue
 
 namespace assignment {
 
   /**
    * Структура данных "очередь" на базе "связного списка".
+   *
+   * Узлы выделяются из собственного пула очереди (NodePool): извлеченные узлы переиспользуются,
+   * поэтому при устойчивой нагрузке (Enqueue и Dequeue поровну) память не выделяется.
    */
   struct LinkedQueue : Queue {
    private:
@@ -16,6 +22,7 @@ namespace assignment {
     int size_{0};           // кол-во узлов в очереди
     Node* front_{nullptr};  // указатель на начало очереди
     Node* back_{nullptr};   // указатель на конец очереди
+    NodePool<Node> pool_;   // пул узлов (удаленные узлы переиспользуются)
 
    public:
     /**
@@ -24,7 +31,38 @@ namespace assignment {
     LinkedQueue() = default;
 
     /**
-     * Деструктор ~ O(n).
+     * Создание пустой очереди с источником памяти для узлов ~ O(1).
+     *
+     * Блоки узлов запрашиваются у resource (например, MonotonicArena).
+     * Источник памяти должен существовать дольше очереди.
+     *
+     * @param resource - источник памяти
+     * @throws invalid_argument при нулевом указателе на ресурс
+     */
+    explicit LinkedQueue(std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии очереди ~ O(n).
+     *
+     * Узлы копии выделяются одним непрерывным блоком в пуле копии (тот же источник памяти).
+     *
+     * @param other - копируемая очередь
+     */
+    LinkedQueue(const LinkedQueue& other);
+
+    LinkedQueue& operator=(const LinkedQueue& other);
+
+    /**
+     * Перемещение очереди ~ O(1).
+     *
+     * @param other - перемещаемая очередь, становится пустой
+     */
+    LinkedQueue(LinkedQueue&& other) noexcept;
+
+    LinkedQueue& operator=(LinkedQueue&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков пула).
      *
      * Высвобождает выделенную под очередь память.
      * Устанавливает поля в нулевые значения.
@@ -41,14 +79,16 @@ namespace assignment {
     /**
      * Удаление элемента из начала очереди ~ O(1).
      *
+     * Узел возвращается в пул и переиспользуется следующим добавлением.
+     *
      * @return true - операция успешна, false - операция невозможна (очередь пуста)
      */
     bool Dequeue() override;
 
     /**
-     * Очистка очереди ~ O(n).
+     * Очистка очереди ~ O(кол-во блоков пула).
      *
-     * Высвобождает выделенную под очередь память.
+     * Узлы высвобождаются блоками, наибольший блок пула сохраняется для следующих добавлений.
      * Устанавливает поля в нулевые значения.
      */
     void Clear() override;
@@ -81,10 +121,56 @@ namespace assignment {
      */
     int size() const override;
 
+    /**
+     * Возвращает пул узлов очереди ~ O(1).
+     *
+     * @return пул узлов (кол-во узлов и блоков, источник памяти)
+     */
+    const NodePool<Node>& pool() const;
+
+    using const_iterator = NodeIterator<const int>;
+
+    /**
+     * Однонаправленные итераторы по элементам очереди от начала к концу ~ O(1).
+     *
+     * Только для чтения: изменение очереди выполняется через Enqueue и Dequeue.
+     * Итератор действителен до удаления его узла из очереди.
+     */
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    /**
+     * Сохранение элементов очереди в двоичном формате (binary_format.hpp) ~ O(n).
+     *
+     * @param fd - дескриптор, открытый на запись
+     * @throws system_error при ошибке записи
+     */
+    void Save(int fd) const;
+
+    /**
+     * Загрузка элементов очереди, сохраненных методом Save ~ O(n).
+     *
+     * Узлы создаются в одном непрерывном блоке пула (одно выделение памяти, соседние узлы - по соседним адресам).
+     * Текущие элементы удаляются. При ошибке очередь не изменяется.
+     *
+     * @param fd - дескриптор, открытый на чтение
+     * @throws system_error при ошибке чтения
+     * @throws runtime_error при неизвестном формате, другом типе контейнера, обрыве записи
+     *                       или несовпадении контрольной суммы
+     */
+    void Load(int fd);
+
     // для тестирования
     explicit LinkedQueue(const std::vector<int>& values);
 
     std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Обмен содержимым двух очередей ~ O(1).
+     */
+    void Swap(LinkedQueue& other) noexcept;
   };
 
 }  // namespace assignment
\ No newline at end of file
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <cstdint>   // int64_t, uint32_t
+#include <optional>  // optional
+#include <string>    // string
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/growth_policy.hpp"  // GrowthPolicy
+#include "assignment/span.hpp"           // Span
+#include "assignment/private/list.hpp"   // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "массив переменной длины", хранящийся в отображенном в память файле (POSIX mmap).
+   *
+   * Файл состоит из заголовка (сигнатура, версия формата, размер и емкость массива)
+   * и следующих за ним ячеек массива. Все операции работают непосредственно с отображенной памятью,
+   * поэтому повторное открытие файла дает готовый к работе массив без копирования и разбора элементов.
+   * Увеличение емкости выполняется увеличением файла (ftruncate) и повторным отображением.
+   *
+   * Порядок байт и размер int должны совпадать у создавшей и открывающей файл программы.
+   */
+  struct MappedDynamicArray : List {
+   private:
+    // заголовок файла
+    struct Header {
+      std::uint32_t magic;    // сигнатура формата
+      std::uint32_t version;  // версия формата
+      std::int64_t size;      // кол-во элементов в массиве
+      std::int64_t capacity;  // емкость массива (кол-во ячеек в файле)
+    };
+
+    // поля структуры
+    std::string path_;              // путь к файлу
+    int fd_{-1};                    // дескриптор открытого файла
+    void* mapping_{nullptr};        // начало отображенной области (заголовок)
+    std::int64_t mapping_size_{0};  // размер отображенной области в байтах
+    Header* header_{nullptr};       // заголовок файла
+    int* data_{nullptr};            // ячейки массива (следуют за заголовком)
+
+    GrowthPolicy growth_policy_{GrowthPolicy::Default()};  // политика увеличения емкости
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = 10;             // начальная емкость нового массива
+    static constexpr std::uint32_t kMagic = 0x41444D41;  // сигнатура формата ("AMDA")
+    static constexpr std::uint32_t kVersion = 1;         // текущая версия формата
+    static constexpr std::int64_t kDataOffset = 64;      // смещение ячеек массива от начала файла
+
+    /**
+     * Открытие массива, хранящегося в файле, или создание нового файла ~ O(1).
+     *
+     * Существующий файл отображается в память без чтения элементов,
+     * новый файл создается с указанной емкостью.
+     *
+     * @param path - путь к файлу
+     * @param capacity - емкость нового массива (не используется при открытии существующего файла)
+     * @param growth_policy - политика увеличения емкости (опционально)
+     * @throws invalid_argument при указании неположительной емкости массива
+     * @throws system_error при ошибке открытия, изменения размера или отображения файла
+     * @throws runtime_error при несовпадении сигнатуры, версии или размеров в заголовке файла
+     */
+    explicit MappedDynamicArray(const std::string& path, int capacity = kInitCapacity,
+                                GrowthPolicy growth_policy = GrowthPolicy::Default());
+
+    MappedDynamicArray(const MappedDynamicArray&) = delete;
+    MappedDynamicArray& operator=(const MappedDynamicArray&) = delete;
+
+    /**
+     * Деструктор ~ O(1).
+     *
+     * Снимает отображение и закрывает файл (без принудительной записи на диск, см. Sync).
+     */
+    ~MappedDynamicArray() override;
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) или O(n).
+     *
+     * При недостаточной емкости файл увеличивается согласно политике увеличения емкости.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(n).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Обнуляет размер массива, размер файла сохраняется.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override;
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество ячеек массива в файле
+     */
+    int capacity() const;
+
+    /**
+     * Увеличение емкости массива (размера файла) ~ O(1).
+     *
+     * Элементы не копируются: файл увеличивается и отображается заново.
+     *
+     * @param new_capacity - новая емкость массива
+     * @return true - операция прошла успешно, false - новая емкость меньше или равна текущей
+     * @throws system_error при ошибке изменения размера или отображения файла
+     */
+    bool Resize(int new_capacity);
+
+    /**
+     * Синхронная запись измененных страниц (заголовка и элементов) на диск ~ O(n).
+     *
+     * @throws system_error при ошибке записи
+     */
+    void Sync();
+
+    /**
+     * Возвращает путь к файлу массива ~ O(1).
+     *
+     * @return путь к файлу
+     */
+    const std::string& path() const;
+
+    using iterator = int*;
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива (в отображенной памяти) ~ O(1).
+     *
+     * Итераторы действительны до изменения емкости массива (повторного отображения файла).
+     */
+    iterator begin();
+
+    iterator end();
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    /**
+     * Непрерывное представление элементов массива [0, size) ~ O(1).
+     *
+     * @return представление для изменения элементов
+     */
+    Span<int> span();
+
+    /**
+     * Непрерывное представление элементов массива [0, size) только для чтения ~ O(1).
+     *
+     * @return представление для чтения элементов
+     */
+    Span<const int> span() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Изменение размера файла под указанную емкость ~ O(1).
+     *
+     * @param capacity - емкость массива
+     */
+    void Truncate(std::int64_t capacity);
+
+    /**
+     * Отображение первых bytes байт файла в память ~ O(1).
+     *
+     * @param bytes - размер отображаемой области
+     */
+    void Map(std::int64_t bytes);
+
+    /**
+     * Снятие отображения файла ~ O(1).
+     */
+    void Unmap();
+
+    /**
+     * Закрытие файла и снятие отображения (при наличии) ~ O(1).
+     */
+    void Close() noexcept;
+  };
+
+}  // namespace assignment
@@ -26,9 +26,9 @@ namespace assignment {
    */
   struct DoubleNode {
     // поля структуры
-    int value{0};
-    Node* prev{nullptr};  // указатель на предыдущий узел
-    Node* next{nullptr};  // указатель на следующий узел
+    int value{0};               // значение узла
+    DoubleNode* prev{nullptr};  // указатель на предыдущий узел
+    DoubleNode* next{nullptr};  // указатель на следующий узел
 
     /**
      * Создание узла со значением, указателями на предыдущий и следующий узлы.
@@ -37,7 +37,7 @@ namespace assignment {
      * @param prev - указатель на предыдущий узел
      * @param next - указатель на следующий узел
      */
-    explicit DoubleNode(int value, Node* prev = nullptr, Node* next = nullptr);
+    explicit DoubleNode(int value, DoubleNode* prev = nullptr, DoubleNode* next = nullptr);
   };
 
 }  // namespace assignment
\ No newline at end of file
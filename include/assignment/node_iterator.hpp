@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>      // ptrdiff_t
+#include <iterator>     // forward_iterator_tag
+#include <type_traits>  // conditional_t, is_const_v, enable_if_t
+
+#include "assignment/node.hpp"  // Node
+
+namespace assignment {
+
+  /**
+   * Однонаправленный итератор по цепочке узлов (LinkedList, LinkedQueue).
+   *
+   * Переход к следующему элементу ~ O(1), в отличие от Get(index) ~ O(n).
+   *
+   * @tparam T - int (изменение значений) или const int (только чтение)
+   */
+  template <typename T>
+  struct NodeIterator {
+   private:
+    using NodePointer = std::conditional_t<std::is_const_v<T>, const Node*, Node*>;
+
+    // поля структуры
+    NodePointer node_{nullptr};  // текущий узел (nullptr - конец последовательности)
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    NodeIterator() = default;
+
+    explicit NodeIterator(NodePointer node) : node_{node} {}
+
+    /**
+     * Преобразование итератора для изменения в итератор только для чтения ~ O(1).
+     */
+    template <typename U, typename = std::enable_if_t<std::is_const_v<T> && !std::is_const_v<U>>>
+    NodeIterator(const NodeIterator<U>& other) : node_{other.node()} {}
+
+    reference operator*() const {
+      return node_->value;
+    }
+
+    pointer operator->() const {
+      return &node_->value;
+    }
+
+    NodeIterator& operator++() {
+      node_ = node_->next;
+      return *this;
+    }
+
+    NodeIterator operator++(int) {
+      NodeIterator previous = *this;
+      node_ = node_->next;
+      return previous;
+    }
+
+    bool operator==(const NodeIterator& other) const {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const NodeIterator& other) const {
+      return node_ != other.node_;
+    }
+
+    /**
+     * Возвращает текущий узел ~ O(1).
+     *
+     * @return указатель на узел или nullptr (конец последовательности)
+     */
+    NodePointer node() const {
+      return node_;
+    }
+  };
+
+}  // namespace assignment
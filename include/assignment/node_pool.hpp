@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cstddef>          // size_t
+#include <memory_resource>  // memory_resource, get_default_resource
+#include <new>              // placement new
+#include <stdexcept>        // invalid_argument
+#include <type_traits>      // is_trivially_destructible
+#include <utility>          // forward, swap
+
+namespace assignment {
+
+  /**
+   * Пул узлов фиксированного размера (slab-аллокатор) со списком свободных ячеек.
+   *
+   * Узлы выделяются из блоков (slab): сначала из списка освобожденных ячеек, затем сдвигом указателя
+   * в текущем блоке. Размер каждого следующего блока удваивается от kInitSlabCapacity до kMaxSlabCapacity ячеек.
+   * Освобожденный узел попадает в список свободных ячеек и переиспользуется следующим выделением -
+   * при устойчивой нагрузке (добавление и удаление поровну) обращений к источнику памяти нет.
+   *
+   * Узлы не уничтожаются поштучно при сбросе пула, поэтому тип узла должен быть тривиально уничтожаемым.
+   * Не является потокобезопасным.
+   *
+   * @tparam T - тип узла
+   * @tparam InitSlabCapacity - кол-во ячеек первого блока (меньше для крупных узлов)
+   */
+  template <typename T, int InitSlabCapacity = 64>
+  struct NodePool {
+    static_assert(std::is_trivially_destructible_v<T>, "pooled nodes are released without destructors");
+    static_assert(InitSlabCapacity > 0, "slab must hold at least one node");
+
+   private:
+    // свободная ячейка (размещается на месте освобожденного узла)
+    struct FreeCell {
+      FreeCell* next;  // следующая свободная ячейка
+    };
+
+    // ячейка блока: вмещает узел или свободную ячейку
+    struct alignas(alignof(T) > alignof(FreeCell) ? alignof(T) : alignof(FreeCell)) Cell {
+      unsigned char bytes[sizeof(T) > sizeof(FreeCell) ? sizeof(T) : sizeof(FreeCell)];
+    };
+
+    // заголовок блока (ячейки следуют за заголовком)
+    struct alignas(Cell) Slab {
+      Slab* next;    // ранее выделенный блок
+      int capacity;  // кол-во ячеек блока
+    };
+
+    // поля структуры
+    Slab* slabs_{nullptr};          // последний выделенный блок (текущий)
+    Cell* next_cell_{nullptr};      // первая невыделенная ячейка текущего блока
+    Cell* end_cell_{nullptr};       // конец текущего блока
+    FreeCell* free_list_{nullptr};  // освобожденные ячейки
+    int next_slab_capacity_{kInitSlabCapacity};  // кол-во ячеек следующего блока
+    int slab_count_{0};                          // кол-во выделенных блоков
+    int live_count_{0};                          // кол-во выделенных и не освобожденных узлов
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};  // источник памяти для блоков
+
+   public:
+    // константы структуры
+    static constexpr int kInitSlabCapacity = InitSlabCapacity;  // кол-во ячеек первого блока
+    static constexpr int kMaxSlabCapacity = 4096;               // наибольшее кол-во ячеек блока при удвоении
+
+    /**
+     * Создание пустого пула ~ O(1).
+     *
+     * Память у источника запрашивается при первом выделении.
+     *
+     * @param resource - источник памяти для блоков (опционально)
+     * @throws invalid_argument при нулевом указателе на источник памяти
+     */
+    explicit NodePool(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : resource_{resource} {
+      if (resource == nullptr) {
+        throw std::invalid_argument("memory resource is null");
+      }
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * Деструктор ~ O(кол-во блоков).
+     *
+     * Возвращает все блоки источнику памяти.
+     */
+    ~NodePool() {
+      Release();
+    }
+
+    /**
+     * Создание узла ~ O(1) (амортизированно).
+     *
+     * @param args - аргументы конструктора узла
+     * @return указатель на созданный узел
+     */
+    template <typename... Args>
+    T* New(Args&&... args) {
+      void* cell = TakeCell();
+      live_count_++;
+      return new (cell) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Освобождение узла (ячейка переиспользуется следующим выделением) ~ O(1).
+     *
+     * @param node - узел, созданный этим пулом (может быть нулевым)
+     */
+    void Delete(T* node) {
+      if (node == nullptr) {
+        return;
+      }
+      node->~T();
+      free_list_ = new (static_cast<void*>(node)) FreeCell{free_list_};
+      live_count_--;
+    }
+
+    /**
+     * Выделение непрерывного блока ячеек под count узлов (узлы не создаются) ~ O(1).
+     *
+     * Блок выделяется отдельно от текущего, ячейки блока освобождаются по одной (Delete) или вместе с пулом.
+     *
+     * @param count - кол-во ячеек, count > 0
+     * @return указатель на первую ячейку (ячейки следуют подряд с шагом sizeof(T))
+     */
+    T* NewBlock(int count) {
+      Slab* slab = AllocateSlab(count);
+      // новый блок становится следующим за текущим, текущий блок продолжает выделение
+      if (slabs_ != nullptr) {
+        slab->next = slabs_->next;
+        slabs_->next = slab;
+      } else {
+        slab->next = nullptr;
+        slabs_ = slab;
+        next_cell_ = CellsOf(slab) + count;
+        end_cell_ = next_cell_;
+      }
+      live_count_ += count;
+      static_assert(sizeof(Cell) == sizeof(T), "cells of a block must be laid out as an array of nodes");
+      return reinterpret_cast<T*>(CellsOf(slab));
+    }
+
+    /**
+     * Сброс пула для повторного использования ~ O(кол-во блоков).
+     *
+     * Все узлы считаются освобожденными (без вызова деструкторов). Наибольший блок сохраняется,
+     * остальные возвращаются источнику памяти.
+     */
+    void Reset() {
+      Slab* largest = nullptr;
+      for (Slab* slab = slabs_; slab != nullptr;) {
+        Slab* next = slab->next;
+        if ((largest == nullptr)||(slab->capacity > largest->capacity)) {
+          if (largest != nullptr) {
+            DeallocateSlab(largest);
+          }
+          largest = slab;
+        } else {
+          DeallocateSlab(slab);
+        }
+        slab = next;
+      }
+
+      slabs_ = largest;
+      free_list_ = nullptr;
+      live_count_ = 0;
+      if (largest != nullptr) {
+        largest->next = nullptr;
+        next_cell_ = CellsOf(largest);
+        end_cell_ = next_cell_ + largest->capacity;
+      } else {
+        next_cell_ = nullptr;
+        end_cell_ = nullptr;
+      }
+    }
+
+    /**
+     * Высвобождение всех блоков пула ~ O(кол-во блоков).
+     *
+     * Все узлы считаются освобожденными (без вызова деструкторов).
+     */
+    void Release() {
+      while (slabs_ != nullptr) {
+        Slab* next = slabs_->next;
+        DeallocateSlab(slabs_);
+        slabs_ = next;
+      }
+      next_cell_ = nullptr;
+      end_cell_ = nullptr;
+      free_list_ = nullptr;
+      next_slab_capacity_ = kInitSlabCapacity;
+      live_count_ = 0;
+    }
+
+    /**
+     * Обмен содержимым двух пулов ~ O(1).
+     */
+    void Swap(NodePool& other) noexcept {
+      std::swap(slabs_, other.slabs_);
+      std::swap(next_cell_, other.next_cell_);
+      std::swap(end_cell_, other.end_cell_);
+      std::swap(free_list_, other.free_list_);
+      std::swap(next_slab_capacity_, other.next_slab_capacity_);
+      std::swap(slab_count_, other.slab_count_);
+      std::swap(live_count_, other.live_count_);
+      std::swap(resource_, other.resource_);
+    }
+
+    /**
+     * Возвращает кол-во выделенных и не освобожденных узлов ~ O(1).
+     *
+     * @return кол-во узлов
+     */
+    int live_count() const {
+      return live_count_;
+    }
+
+    /**
+     * Возвращает кол-во блоков, полученных от источника памяти ~ O(1).
+     *
+     * @return кол-во блоков
+     */
+    int slab_count() const {
+      return slab_count_;
+    }
+
+    /**
+     * Возвращает объем памяти, полученной от источника ~ O(кол-во блоков).
+     *
+     * @return кол-во байт во всех блоках (включая заголовки и свободные ячейки)
+     */
+    std::size_t memory_usage() const {
+      std::size_t bytes = 0;
+      for (const Slab* slab = slabs_; slab != nullptr; slab = slab->next) {
+        bytes += SlabBytes(slab->capacity);
+      }
+      return bytes;
+    }
+
+    /**
+     * Возвращает источник памяти пула ~ O(1).
+     *
+     * @return указатель на источник памяти
+     */
+    std::pmr::memory_resource* resource() const {
+      return resource_;
+    }
+
+   private:
+    static Cell* CellsOf(Slab* slab) {
+      return reinterpret_cast<Cell*>(slab + 1);
+    }
+
+    static std::size_t SlabBytes(int capacity) {
+      return sizeof(Slab) + static_cast<std::size_t>(capacity) * sizeof(Cell);
+    }
+
+    void* TakeCell() {
+      if (free_list_ != nullptr) {
+        FreeCell* cell = free_list_;
+        free_list_ = cell->next;
+        return cell;
+      }
+      if (next_cell_ == end_cell_) {
+        Slab* slab = AllocateSlab(next_slab_capacity_);
+        slab->next = slabs_;
+        slabs_ = slab;
+        next_cell_ = CellsOf(slab);
+        end_cell_ = next_cell_ + slab->capacity;
+        if (next_slab_capacity_ < kMaxSlabCapacity) {
+          next_slab_capacity_ *= 2;
+        }
+      }
+      return next_cell_++;
+    }
+
+    Slab* AllocateSlab(int capacity) {
+      void* memory = resource_->allocate(SlabBytes(capacity), alignof(Slab));
+      slab_count_++;
+      return new (memory) Slab{nullptr, capacity};
+    }
+
+    void DeallocateSlab(Slab* slab) {
+      const int capacity = slab->capacity;
+      resource_->deallocate(slab, SlabBytes(capacity), alignof(Slab));
+      slab_count_--;
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "assignment/thread_pool.hpp"  // ThreadPool
+
+namespace assignment::parallel {
+
+  // кол-во элементов в одной задаче параллельного прохода (256 КБ значений int)
+  constexpr int kChunkSize = 1 << 16;
+
+  /**
+   * Параллельный поиск индекса первого вхождения значения ~ O(n / threads).
+   *
+   * Последовательность делится на блоки по kChunkSize элементов, блоки раздаются потокам по возрастанию.
+   * Блоки, начинающиеся после уже найденного вхождения, пропускаются (ранняя отмена),
+   * поэтому результат совпадает с последовательным поиском - наименьший индекс вхождения.
+   *
+   * @param pool - пул потоков
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return индекс первого вхождения или -1 (в случае отсутствия значения)
+   */
+  int FindFirst(ThreadPool& pool, const int* data, int size, int value);
+
+  /**
+   * Параллельный подсчет кол-ва вхождений значения ~ O(n / threads).
+   *
+   * @param pool - пул потоков
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return кол-во элементов, равных value
+   */
+  int Count(ThreadPool& pool, const int* data, int size, int value);
+
+}  // namespace assignment::parallel
@@ -2,13 +2,17 @@
 
 #include <optional>
 
+#include "assignment/private/read_only_list.hpp"  // ReadOnlyList
+
 namespace assignment {
 
   /**
    * Интерфейс "абстрактный список".
    * Последовательность элементов одинакового типа.
+   *
+   * Операции чтения объявлены в ReadOnlyList.
    */
-  struct List {
+  struct List : ReadOnlyList {
 
     /**
      * Деструктор.
@@ -16,7 +20,7 @@ namespace assignment {
      * Высвобождает выделенную память.
      * Устанавливает поля в нулевые значения.
      */
-    virtual ~List() = default;
+    ~List() override = default;
 
     /**
      * Добавление элемента в конец списка.
@@ -57,44 +61,6 @@ namespace assignment {
      * Поведение зависит от конкретной реализации списка.
      */
     virtual void Clear() = 0;
-
-    /**
-     * Получение значения элемента списка по индексу.
-     *
-     * @param index - позиция элемента в списке
-     * @return значение найденного элемента или ничего (индекс за пределами списка)
-     */
-    virtual std::optional<int> Get(int index) const = 0;
-
-    /**
-     * Поиск индекса первого вхождения элемента с указанным значением.
-     *
-     * @param value - значение элемента
-     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
-     */
-    virtual std::optional<int> IndexOf(int value) const = 0;
-
-    /**
-     * Проверка наличия элемента в списке по значению.
-     *
-     * @param value - значение элемента
-     * @return true - при наличии элемента в списке, false - при отсутствии элемента
-     */
-    virtual bool Contains(int value) const = 0;
-
-    /**
-     * Проверка пустоты списка.
-     *
-     * @return true - список пустой, false - в списке есть элементы
-     */
-    virtual bool IsEmpty() const = 0;
-
-    /**
-     * Возвращает размер списка.
-     *
-     * @return количество элементов в списке
-     */
-    virtual int size() const = 0;
   };
 
 }  // namespace assignment
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <optional>
+
+namespace assignment {
+
+  /**
+   * Интерфейс "абстрактный список" (только чтение).
+   * Последовательность элементов одинакового типа, доступная по индексу и значению.
+   *
+   * Реализуется списками, не допускающими произвольного изменения (например, упорядоченными).
+   */
+  struct ReadOnlyList {
+
+    /**
+     * Деструктор.
+     */
+    virtual ~ReadOnlyList() = default;
+
+    /**
+     * Получение значения элемента списка по индексу.
+     *
+     * @param index - позиция элемента в списке
+     * @return значение найденного элемента или ничего (индекс за пределами списка)
+     */
+    virtual std::optional<int> Get(int index) const = 0;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    virtual std::optional<int> IndexOf(int value) const = 0;
+
+    /**
+     * Проверка наличия элемента в списке по значению.
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в списке, false - при отсутствии элемента
+     */
+    virtual bool Contains(int value) const = 0;
+
+    /**
+     * Проверка пустоты списка.
+     *
+     * @return true - список пустой, false - в списке есть элементы
+     */
+    virtual bool IsEmpty() const = 0;
+
+    /**
+     * Возвращает размер списка.
+     *
+     * @return количество элементов в списке
+     */
+    virtual int size() const = 0;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <optional>
+
+namespace assignment {
+
+  /**
+   * Статический интерфейс "абстрактный список" (CRTP, без таблицы виртуальных функций).
+   *
+   * Derived реализует Add, Insert, Set, Remove, Clear, Get, IndexOf и size,
+   * производные операции (Contains, IsEmpty) выражаются через них и встраиваются компилятором.
+   * Виртуальный интерфейс List доступен через адаптер ListAdapter.
+   *
+   * @tparam Derived - реализация списка
+   */
+  template <typename Derived>
+  struct StaticList {
+
+    /**
+     * Проверка наличия элемента в списке по значению.
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в списке, false - при отсутствии элемента
+     */
+    bool Contains(int value) const {
+      return self().IndexOf(value).has_value();
+    }
+
+    /**
+     * Проверка пустоты списка.
+     *
+     * @return true - список пустой, false - в списке есть элементы
+     */
+    bool IsEmpty() const {
+      return self().size() == 0;
+    }
+
+   protected:
+    // удаление через указатель на StaticList не предусмотрено
+    ~StaticList() = default;
+
+   private:
+    const Derived& self() const {
+      return static_cast<const Derived&>(*this);
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace assignment {
+
+  /**
+   * Статический интерфейс "очередь" (CRTP, без таблицы виртуальных функций).
+   *
+   * Derived реализует Enqueue, Dequeue, Clear, front, back и size.
+   * Виртуальный интерфейс Queue доступен через адаптер QueueAdapter.
+   *
+   * @tparam Derived - реализация очереди
+   */
+  template <typename Derived>
+  struct StaticQueue {
+
+    /**
+     * Проверка пустоты очереди.
+     *
+     * @return true - очередь пустая, false - в очереди есть элементы
+     */
+    bool IsEmpty() const {
+      return static_cast<const Derived&>(*this).size() == 0;
+    }
+
+   protected:
+    // удаление через указатель на StaticQueue не предусмотрено
+    ~StaticQueue() = default;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace assignment {
+
+  /**
+   * Статический интерфейс "стек" (CRTP, без таблицы виртуальных функций).
+   *
+   * Derived реализует Push, Pop, Clear, Peek и size.
+   * Виртуальный интерфейс Stack доступен через адаптер StackAdapter.
+   *
+   * @tparam Derived - реализация стека
+   */
+  template <typename Derived>
+  struct StaticStack {
+
+    /**
+     * Проверка пустоты стека.
+     *
+     * @return true - стек пустой, false - в стеке есть элементы
+     */
+    bool IsEmpty() const {
+      return static_cast<const Derived&>(*this).size() == 0;
+    }
+
+   protected:
+    // удаление через указатель на StaticStack не предусмотрено
+    ~StaticStack() = default;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <optional>  // optional
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/private/list.hpp"  // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "сегментированный массив".
+   *
+   * Элементы хранятся в блоках (сегментах) фиксированного размера kChunkSize,
+   * указатели на блоки хранятся в каталоге. Добавление в конец выделяет новый блок при необходимости
+   * и никогда не перемещает существующие элементы: адреса ячеек стабильны, копирования при росте нет
+   * (при увеличении каталога копируются только указатели на блоки).
+   * Доступ по индексу ~ O(1): номер блока - index >> kChunkShift, позиция в блоке - index & kChunkMask.
+   */
+  struct SegmentedArray : List {
+   private:
+    // поля структуры
+    int size_{0};                // кол-во элементов в массиве
+    int chunk_count_{0};         // кол-во выделенных блоков
+    int directory_capacity_{0};  // емкость каталога (кол-во указателей)
+    int** chunks_{nullptr};      // каталог блоков
+
+   public:
+    // константы структуры
+    static constexpr int kChunkShift = 10;               // log2 размера блока
+    static constexpr int kChunkSize = 1 << kChunkShift;  // кол-во элементов в блоке (4 КБ значений int)
+    static constexpr int kChunkMask = kChunkSize - 1;    // маска позиции в блоке
+
+    /**
+     * Создание пустого массива ~ O(1).
+     *
+     * Блоки выделяются при добавлении элементов.
+     */
+    SegmentedArray() = default;
+
+    /**
+     * Создание копии массива ~ O(n).
+     *
+     * @param other - копируемый массив
+     */
+    SegmentedArray(const SegmentedArray& other);
+
+    /**
+     * Перемещение массива ~ O(1).
+     *
+     * @param other - перемещаемый массив, становится пустым
+     */
+    SegmentedArray(SegmentedArray&& other) noexcept;
+
+    SegmentedArray& operator=(const SegmentedArray& other);
+
+    SegmentedArray& operator=(SegmentedArray&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков).
+     *
+     * Высвобождает блоки и каталог.
+     */
+    ~SegmentedArray() override;
+
+    /**
+     * Добавление элемента в конец массива ~ O(1).
+     *
+     * Существующие элементы не перемещаются.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(n).
+     *
+     * Элементы после index сдвигаются на одну ячейку (memmove внутри блоков, перенос на границах блоков).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Обнуляет размер массива, выделенные блоки сохраняются для повторного использования.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * Блоки просматриваются векторными инструкциями, см. simd::FindFirst.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override;
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество ячеек во всех выделенных блоках
+     */
+    int capacity() const;
+
+    /**
+     * Возвращает адрес ячейки элемента по индексу ~ O(1).
+     *
+     * Адрес остается действительным при добавлении элементов и до уничтожения массива
+     * (Insert и Remove сдвигают значения между ячейками, но не перемещают сами ячейки).
+     *
+     * @param index - позиция элемента в массиве
+     * @return указатель на ячейку или nullptr (индекс за пределами массива)
+     */
+    int* At(int index);
+
+    const int* At(int index) const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Выделение нового блока (и увеличение каталога при необходимости) ~ O(1) амортизированно.
+     */
+    void AddChunk();
+
+    /**
+     * Обмен содержимым двух массивов ~ O(1).
+     */
+    void Swap(SegmentedArray& other) noexcept;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,60 @@
+#pragma once
+
+namespace assignment {
+
+  /**
+   * Политика уменьшения емкости массивов (DynamicArray, ArrayStack).
+   *
+   * Емкость уменьшается в factor раз, пока размер массива меньше 1/threshold емкости.
+   * Условие threshold > factor обеспечивает гистерезис: после уменьшения емкости
+   * массив заполнен менее чем на factor/threshold (по умолчанию 1/2),
+   * поэтому чередование добавлений/удалений на границе не приводит к постоянному перевыделению памяти.
+   */
+  struct ShrinkPolicy {
+   private:
+    // поля структуры
+    bool enabled_{false};                // уменьшение емкости включено
+    int threshold_{kDefaultThreshold};   // порог заполненности 1/threshold
+    int factor_{kDefaultFactor};         // коэффициент уменьшения емкости
+    int min_capacity_{kDefaultMinCapacity};  // емкость, ниже которой массив не уменьшается
+
+   public:
+    // константы структуры
+    static constexpr int kDefaultThreshold = 4;     // уменьшение при заполненности менее 1/4
+    static constexpr int kDefaultFactor = 2;        // уменьшение емкости вдвое
+    static constexpr int kDefaultMinCapacity = 10;  // минимальная емкость (совпадает с kInitCapacity)
+
+    /**
+     * Политика без уменьшения емкости (по умолчанию).
+     */
+    static ShrinkPolicy None();
+
+    /**
+     * Политика уменьшения емкости с гистерезисом.
+     *
+     * @param threshold - емкость уменьшается при размере меньше capacity / threshold (опционально)
+     * @param factor - емкость уменьшается в factor раз (опционально)
+     * @param min_capacity - минимальная емкость массива (опционально)
+     * @throws invalid_argument при factor < 2, threshold <= factor или неположительной min_capacity
+     */
+    static ShrinkPolicy Hysteresis(int threshold = kDefaultThreshold, int factor = kDefaultFactor,
+                                   int min_capacity = kDefaultMinCapacity);
+
+    /**
+     * Вычисление емкости массива после удаления элементов.
+     *
+     * @param size - текущий размер массива
+     * @param capacity - текущая емкость массива
+     * @return новая емкость (равна capacity, если уменьшение не требуется)
+     */
+    int ShrinkCapacity(int size, int capacity) const;
+
+    /**
+     * Проверка включенности политики.
+     *
+     * @return true - емкость уменьшается, false - емкость не уменьшается
+     */
+    bool enabled() const;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>  // uint32_t
+
+namespace assignment::simd {
+
+  // кол-во значений в упакованном блоке (Pack, Unpack)
+  constexpr int kPackedBlockSize = 128;
+
+  /**
+   * Наборы векторных инструкций, для которых реализованы вычислительные ядра.
+   */
+  enum class Isa {
+    kScalar,  // переносимая скалярная реализация
+    kSse2,    // 4 значения int за инструкцию
+    kAvx2,    // 8 значений int за инструкцию
+    kAvx512   // 16 значений int за инструкцию
+  };
+
+  /**
+   * Поиск индекса первого вхождения значения в последовательности ~ O(n).
+   *
+   * Использует наиболее широкий набор инструкций, поддерживаемый процессором.
+   * Набор инструкций определяется один раз (CPUID) при загрузке программы.
+   *
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return индекс первого вхождения или -1 (в случае отсутствия значения)
+   */
+  int FindFirst(const int* data, int size, int value);
+
+  /**
+   * Поиск индекса первого вхождения значения с явным выбором набора инструкций ~ O(n).
+   *
+   * Используется для тестирования и сравнения ядер между собой.
+   * Неподдерживаемый процессором набор инструкций заменяется скалярной реализацией.
+   *
+   * @param isa - набор инструкций
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return индекс первого вхождения или -1 (в случае отсутствия значения)
+   */
+  int FindFirst(Isa isa, const int* data, int size, int value);
+
+  /**
+   * Подсчет кол-ва вхождений значения в последовательности ~ O(n).
+   *
+   * Использует тот же набор инструкций, что и FindFirst.
+   *
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return кол-во элементов, равных value
+   */
+  int Count(const int* data, int size, int value);
+
+  /**
+   * Подсчет кол-ва вхождений значения с явным выбором набора инструкций ~ O(n).
+   *
+   * @param isa - набор инструкций
+   * @param data - указатель на начало последовательности
+   * @param size - кол-во элементов последовательности
+   * @param value - искомое значение
+   * @return кол-во элементов, равных value
+   */
+  int Count(Isa isa, const int* data, int size, int value);
+
+  /**
+   * Выборка элементов по индексам ~ O(count): out[i] = data[indices[i]].
+   *
+   * Использует инструкцию gather (AVX2) и программную предвыборку ячеек.
+   * Индексы не проверяются (должны быть проверены вызывающим кодом).
+   *
+   * @param data - указатель на начало последовательности
+   * @param indices - индексы выбираемых элементов
+   * @param count - кол-во индексов
+   * @param out - буфер для значений (не менее count ячеек)
+   */
+  void Gather(const int* data, const int* indices, int count, int* out);
+
+  /**
+   * Выборка элементов по индексам с явным выбором набора инструкций ~ O(count).
+   *
+   * @param isa - набор инструкций
+   * @param data - указатель на начало последовательности
+   * @param indices - индексы выбираемых элементов
+   * @param count - кол-во индексов
+   * @param out - буфер для значений (не менее count ячеек)
+   */
+  void Gather(Isa isa, const int* data, const int* indices, int count, int* out);
+
+  /**
+   * Упаковка блока из kPackedBlockSize значений по bits бит на значение (смещение от reference) ~ O(1).
+   *
+   * Раскладка "вертикальная" (4 полосы по 32 значения): значение i хранится в полосе i % 4
+   * на позиции i / 4, 32-битные слова полос чередуются (слово k полосы l - packed[4 * k + l]).
+   * Такая раскладка распаковывается одним вектором SSE2 по 4 значения за шаг.
+   *
+   * @param values - упаковываемые значения (kPackedBlockSize значений)
+   * @param bits - кол-во бит на значение в [0, 32], все values[i] - reference должны в них помещаться
+   * @param reference - опорное значение (обычно минимум блока)
+   * @param packed - буфер для упакованного блока (4 * bits слов)
+   */
+  void Pack(const int* values, int bits, int reference, std::uint32_t* packed);
+
+  /**
+   * Распаковка блока, упакованного Pack ~ O(1).
+   *
+   * Использует ядро SSE2 со сдвигами, развернутыми для каждой ширины значения.
+   *
+   * @param packed - упакованный блок (4 * bits слов)
+   * @param bits - кол-во бит на значение в [0, 32]
+   * @param reference - опорное значение
+   * @param out - буфер для значений (kPackedBlockSize ячеек)
+   */
+  void Unpack(const std::uint32_t* packed, int bits, int reference, int* out);
+
+  /**
+   * Распаковка блока с явным выбором набора инструкций ~ O(1).
+   *
+   * @param isa - набор инструкций
+   * @param packed - упакованный блок (4 * bits слов)
+   * @param bits - кол-во бит на значение в [0, 32]
+   * @param reference - опорное значение
+   * @param out - буфер для значений (kPackedBlockSize ячеек)
+   */
+  void Unpack(Isa isa, const std::uint32_t* packed, int bits, int reference, int* out);
+
+  /**
+   * Подсчет кол-ва вхождений значения в блоке, упакованном Pack, без распаковки в память ~ O(1).
+   *
+   * Значение переводится в смещение от reference и сравнивается с упакованными смещениями.
+   *
+   * @param packed - упакованный блок (4 * bits слов)
+   * @param bits - кол-во бит на значение в [0, 32]
+   * @param reference - опорное значение
+   * @param value - искомое значение
+   * @return кол-во значений блока, равных value
+   */
+  int CountPacked(const std::uint32_t* packed, int bits, int reference, int value);
+
+  /**
+   * Подсчет кол-ва вхождений значения в упакованном блоке с явным выбором набора инструкций ~ O(1).
+   *
+   * @param isa - набор инструкций
+   * @param packed - упакованный блок (4 * bits слов)
+   * @param bits - кол-во бит на значение в [0, 32]
+   * @param reference - опорное значение
+   * @param value - искомое значение
+   * @return кол-во значений блока, равных value
+   */
+  int CountPacked(Isa isa, const std::uint32_t* packed, int bits, int reference, int value);
+
+  /**
+   * Распаковка одного значения блока, упакованного Pack ~ O(1).
+   *
+   * @param packed - упакованный блок (4 * bits слов)
+   * @param bits - кол-во бит на значение в [0, 32]
+   * @param reference - опорное значение
+   * @param index - позиция значения в блоке в [0, kPackedBlockSize)
+   * @return значение
+   */
+  int UnpackAt(const std::uint32_t* packed, int bits, int reference, int index);
+
+  /**
+   * Проверка поддержки набора инструкций процессором и сборкой.
+   *
+   * @param isa - набор инструкций
+   * @return true - набор инструкций поддерживается, false - не поддерживается
+   */
+  bool IsSupported(Isa isa);
+
+  /**
+   * Возвращает набор инструкций, выбранный для FindFirst, Count, Gather, Unpack и CountPacked.
+   *
+   * @return самый широкий поддерживаемый набор инструкций
+   */
+  Isa ActiveIsa();
+
+  /**
+   * Возвращает название набора инструкций.
+   *
+   * @param isa - набор инструкций
+   * @return строковое представление ("scalar", "sse2", "avx2", "avx512")
+   */
+  const char* ToString(Isa isa);
+
+}  // namespace assignment::simd
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t
+#include <memory_resource>  // memory_resource, get_default_resource
+#include <optional>         // optional
+#include <vector>           // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/private/list.hpp"  // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "индексируемый список с пропусками" (indexable skip list).
+   *
+   * Узлы связаны на нескольких уровнях: уровень 0 - обычный связный список, каждый следующий уровень
+   * содержит в среднем каждый 4-й узел предыдущего. Каждая связь хранит длину (span) - кол-во позиций,
+   * на которое она перескакивает. Поиск по индексу спускается с верхнего уровня, суммируя длины связей,
+   * поэтому Get, Set, Insert и Remove по индексу выполняются за O(log n) в среднем.
+   *
+   * Высота узла выбирается случайно (вероятность следующего уровня - 1/4), генератор детерминирован.
+   * Для Add и back хранятся последние узлы каждого уровня: добавление в конец не выполняет поиска.
+   *
+   * Узлы разной высоты выделяются у источника памяти поштучно (заголовок и связи - одним блоком).
+   */
+  struct SkipList : List {
+   public:
+    // константы структуры
+    static constexpr int kMaxLevel = 16;  // наибольшее кол-во уровней (достаточно для 4^16 узлов)
+
+   private:
+    struct SkipNode;
+
+    // связь узла на одном уровне
+    struct Link {
+      SkipNode* next;  // следующий узел на уровне (nullptr - конец уровня)
+      int span;        // кол-во позиций между узлом и next (для next == nullptr не используется)
+    };
+
+    // узел списка (связи уровней следуют за заголовком)
+    struct SkipNode {
+      int value;   // значение узла
+      int height;  // кол-во уровней узла
+    };
+
+    static_assert(sizeof(SkipNode) % alignof(Link) == 0, "links should follow the node header without padding");
+
+    // поля структуры
+    int size_{0};                     // кол-во элементов в списке
+    int level_{1};                    // кол-во используемых уровней
+    Link head_[kMaxLevel]{};          // связи начала списка на каждом уровне
+    SkipNode* tails_[kMaxLevel]{};    // последний узел каждого уровня (nullptr - начало списка)
+    int tail_ranks_[kMaxLevel]{};     // позиция последнего узла каждого уровня (с 1, 0 - начало списка)
+    std::uint32_t random_state_{1u};  // состояние генератора высот узлов (xorshift32)
+
+    std::pmr::memory_resource* resource_{std::pmr::get_default_resource()};  // источник памяти для узлов
+
+   public:
+    /**
+     * Создание пустого списка ~ O(1).
+     */
+    SkipList() = default;
+
+    /**
+     * Создание пустого списка с источником памяти для узлов ~ O(1).
+     *
+     * Источник памяти должен существовать дольше списка.
+     *
+     * @param resource - источник памяти
+     * @throws invalid_argument при нулевом указателе на ресурс
+     */
+    explicit SkipList(std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии списка ~ O(n).
+     *
+     * @param other - копируемый список
+     */
+    SkipList(const SkipList& other);
+
+    SkipList& operator=(const SkipList& other);
+
+    /**
+     * Перемещение списка ~ O(1).
+     *
+     * @param other - перемещаемый список, становится пустым
+     */
+    SkipList(SkipList&& other) noexcept;
+
+    SkipList& operator=(SkipList&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(n).
+     *
+     * Высвобождает узлы списка.
+     */
+    ~SkipList() override;
+
+    /**
+     * Добавление элемента в конец списка ~ O(1) в среднем.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента в список по индексу ~ O(log n) в среднем.
+     *
+     * @param index - позиция для вставки элемента в список
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента списка по индексу ~ O(log n) в среднем.
+     *
+     * @param index - позиция изменяемого элемента списка
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из списка по индексу ~ O(log n) в среднем.
+     *
+     * @param index - позиция удаляемого элемента в списке
+     * @return значение удаленного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка списка ~ O(n).
+     *
+     * Узлы возвращаются источнику памяти.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента списка по индексу ~ O(log n) в среднем.
+     *
+     * @param index - позиция элемента в списке
+     * @return значение найденного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в списке по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в списке, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты списка ~ O(1).
+     *
+     * @return true - если список пустой, false - в списке есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер списка ~ O(1).
+     *
+     * @return количество элементов в списке
+     */
+    int size() const override;
+
+    /**
+     * Возвращает кол-во используемых уровней ~ O(1).
+     *
+     * @return количество уровней (не меньше 1)
+     */
+    int level() const;
+
+    /**
+     * Возвращает начальный элемент списка ~ O(1).
+     *
+     * @return значение начального элемента или ничего (список пуст)
+     */
+    std::optional<int> front() const;
+
+    /**
+     * Возвращает конечный элемент списка ~ O(1).
+     *
+     * @return значение конечного элемента или ничего (список пуст)
+     */
+    std::optional<int> back() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Возвращает кол-во байт узла высоты height (заголовок и связи) ~ O(1).
+     */
+    static std::size_t NodeBytes(int height);
+
+    /**
+     * Возвращает связи узла (связи начала списка для nullptr) ~ O(1).
+     */
+    Link* Links(SkipNode* node);
+
+    const Link* Links(const SkipNode* node) const;
+
+    /**
+     * Поиск узла по индексу ~ O(log n) в среднем.
+     *
+     * @param index - позиция узла в списке, 0 <= index < size
+     * @return указатель на узел
+     */
+    SkipNode* FindNode(int index) const;
+
+    /**
+     * Поиск узлов, предшествующих позиции index на каждом уровне ~ O(log n) в среднем.
+     *
+     * @param index - позиция, 0 <= index <= size
+     * @param update - предшествующий узел каждого уровня (nullptr - начало списка)
+     * @param ranks - позиция предшествующего узла каждого уровня (с 1, 0 - начало списка)
+     */
+    void FindPredecessors(int index, SkipNode** update, int* ranks) const;
+
+    /**
+     * Создание узла случайной высоты ~ O(1) в среднем.
+     */
+    SkipNode* CreateNode(int value);
+
+    void DestroyNode(SkipNode* node);
+
+    /**
+     * Обмен содержимым двух списков ~ O(1).
+     */
+    void Swap(SkipList& other) noexcept;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>  // copy
+#include <cstring>    // memmove
+#include <optional>   // optional
+#include <vector>     // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/private/list.hpp"  // List
+#include "assignment/simd.hpp"          // FindFirst
+#include "assignment/span.hpp"          // Span
+
+namespace assignment {
+
+  /**
+   * Структура данных "массив переменной длины" со встроенным буфером на N элементов.
+   *
+   * Первые N элементов хранятся внутри самой структуры (без выделения памяти в куче),
+   * при превышении N элементы переносятся в кучу, емкость увеличивается вдвое.
+   * Ячейки массива не инициализируются нулями (в отличие от DynamicArray).
+   *
+   * @tparam N - емкость встроенного буфера
+   */
+  template <int N>
+  struct SmallDynamicArray : List {
+    static_assert(N > 0, "inline capacity must be positive");
+
+   private:
+    // поля структуры
+    int size_{0};         // кол-во элементов в массиве
+    int capacity_{N};     // емкость массива (кол-во ячеек в массиве)
+    int* data_{inline_};  // указатель на встроенный буфер или блок памяти в куче
+    int inline_[static_cast<std::size_t>(N)];  // встроенный буфер
+
+   public:
+    // константы структуры
+    static constexpr int kInlineCapacity = N;  // емкость встроенного буфера
+
+    /**
+     * Создание пустого массива ~ O(1).
+     *
+     * Память в куче не выделяется.
+     */
+    SmallDynamicArray() = default;
+
+    /**
+     * Создание копии массива ~ O(n).
+     *
+     * @param other - копируемый массив
+     */
+    SmallDynamicArray(const SmallDynamicArray& other) : List() {
+      Reserve(other.size_);
+      std::copy(other.data_, other.data_ + other.size_, data_);
+      size_ = other.size_;
+    }
+
+    /**
+     * Перемещение массива ~ O(1) (элементы в куче) или O(N) (элементы во встроенном буфере).
+     *
+     * @param other - перемещаемый массив, становится пустым
+     */
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept : List() {
+      StealFrom(other);
+    }
+
+    SmallDynamicArray& operator=(const SmallDynamicArray& other) {
+      if (this != &other) {
+        size_ = 0;
+        Reserve(other.size_);
+        std::copy(other.data_, other.data_ + other.size_, data_);
+        size_ = other.size_;
+      }
+      return *this;
+    }
+
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept {
+      if (this != &other) {
+        Release();
+        StealFrom(other);
+      }
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(1).
+     *
+     * Высвобождает память в куче (при наличии).
+     */
+    ~SmallDynamicArray() override {
+      Release();
+    }
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) или O(n).
+     *
+     * При заполнении встроенного буфера элементы переносятся в кучу.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override {
+      if (size_ == capacity_) {
+        Reserve(capacity_ * 2);
+      }
+      data_[size_] = value;
+      size_++;
+    }
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(n).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, int value) override {
+      if ((index < 0)||(index > size_)) {
+        return false;
+      }
+      if (size_ == capacity_) {
+        Reserve(capacity_ * 2);
+      }
+      std::memmove(data_ + index + 1, data_ + index, static_cast<std::size_t>(size_ - index) * sizeof(int));
+      data_[index] = value;
+      size_++;
+      return true;
+    }
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, int new_value) override {
+      if ((index < 0)||(index >= size_)) {
+        return false;
+      }
+      data_[index] = new_value;
+      return true;
+    }
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index) override {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      const int removed = data_[index];
+      std::memmove(data_ + index, data_ + index + 1, static_cast<std::size_t>(size_ - index - 1) * sizeof(int));
+      size_--;
+      return removed;
+    }
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Обнуляет размер массива, память в куче сохраняется.
+     */
+    void Clear() override {
+      size_ = 0;
+    }
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      return data_[index];
+    }
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override {
+      const int index = simd::FindFirst(data_, size_, value);
+      if (index < 0) {
+        return std::nullopt;
+      }
+      return index;
+    }
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override {
+      return simd::FindFirst(data_, size_, value) >= 0;
+    }
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override {
+      return size_ == 0;
+    }
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override {
+      return size_;
+    }
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество доступных ячеек массива (не меньше N)
+     */
+    int capacity() const {
+      return capacity_;
+    }
+
+    /**
+     * Проверка расположения элементов во встроенном буфере ~ O(1).
+     *
+     * @return true - элементы во встроенном буфере, false - элементы в куче
+     */
+    bool IsInline() const {
+      return data_ == inline_;
+    }
+
+    using iterator = int*;
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива ~ O(1).
+     *
+     * Итераторы действительны до переноса элементов в кучу (или изменения емкости).
+     */
+    iterator begin() {
+      return data_;
+    }
+
+    iterator end() {
+      return data_ + size_;
+    }
+
+    const_iterator begin() const {
+      return data_;
+    }
+
+    const_iterator end() const {
+      return data_ + size_;
+    }
+
+    /**
+     * Непрерывное представление элементов массива [0, size) ~ O(1).
+     *
+     * @return представление для изменения (для константного массива - для чтения) элементов
+     */
+    Span<int> span() {
+      return {data_, size_};
+    }
+
+    Span<const int> span() const {
+      return {data_, size_};
+    }
+
+    /**
+     * Увеличение емкости массива ~ O(n).
+     *
+     * @param new_capacity - новая емкость массива
+     * @return true - операция прошла успешно, false - новая емкость меньше или равна текущей
+     */
+    bool Resize(int new_capacity) {
+      if (new_capacity <= capacity_) {
+        return false;
+      }
+      Reserve(new_capacity);
+      return true;
+    }
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const {
+      return {data_, data_ + size_};
+    }
+
+   private:
+    /**
+     * Перенос элементов в кучу при емкости меньше new_capacity ~ O(n).
+     *
+     * @param new_capacity - необходимая емкость массива
+     */
+    void Reserve(int new_capacity) {
+      if (new_capacity <= capacity_) {
+        return;
+      }
+      int* new_data = new int[new_capacity];
+      std::copy(data_, data_ + size_, new_data);
+      Release();
+      data_ = new_data;
+      capacity_ = new_capacity;
+    }
+
+    /**
+     * Перемещение элементов другого массива в пустой массив ~ O(1) или O(N).
+     *
+     * @param other - перемещаемый массив, становится пустым
+     */
+    void StealFrom(SmallDynamicArray& other) noexcept {
+      if (other.IsInline()) {
+        std::copy(other.data_, other.data_ + other.size_, data_);
+      } else {
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_;
+        other.capacity_ = N;
+      }
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+
+    /**
+     * Высвобождение памяти в куче и возврат к встроенному буферу ~ O(1).
+     */
+    void Release() {
+      if (!IsInline()) {
+        delete[] data_;
+      }
+      data_ = inline_;
+      capacity_ = N;
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <optional>  // optional
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/basic_dynamic_array.hpp"          // BasicDynamicArray
+#include "assignment/growth_policy.hpp"                // GrowthPolicy
+#include "assignment/span.hpp"                         // Span
+#include "assignment/private/read_only_list.hpp"       // ReadOnlyList
+
+namespace assignment {
+
+  /**
+   * Структура данных "упорядоченный массив переменной длины".
+   *
+   * Элементы хранятся последовательно в памяти в порядке неубывания.
+   * Поиск по значению выполняется двоичным поиском без ветвлений (условная пересылка вместо перехода),
+   * поэтому время поиска не зависит от предсказателя переходов.
+   * Позиционная вставка и изменение значения не поддерживаются (нарушили бы порядок),
+   * поэтому массив реализует только интерфейс чтения списка.
+   */
+  struct SortedDynamicArray : ReadOnlyList {
+   private:
+    // поля структуры
+    BasicDynamicArray<int> data_;  // элементы в порядке неубывания
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = BasicDynamicArray<int>::kInitCapacity;  // начальная емкость массива
+
+    /**
+     * Создание пустого массива с указанной емкостью ~ O(1).
+     *
+     * @param capacity - начальная емкость массива (опционально)
+     * @param growth_policy - политика увеличения емкости (опционально)
+     * @throws invalid_argument при указании неположительной емкости массива
+     */
+    explicit SortedDynamicArray(int capacity = kInitCapacity, GrowthPolicy growth_policy = GrowthPolicy::Default());
+
+    /**
+     * Вставка элемента с сохранением порядка ~ O(log n + n).
+     *
+     * Элемент вставляется после всех равных ему элементов.
+     *
+     * @param value - значение вставляемого элемента
+     * @return индекс вставленного элемента
+     */
+    int InsertSorted(int value);
+
+    /**
+     * Вставка последовательности элементов с сохранением порядка ~ O(n + k log k).
+     *
+     * Последовательность добавляется в конец, сортируется и сливается с массивом (без k сдвигов хвоста).
+     *
+     * @param values - указатель на начало последовательности
+     * @param count - кол-во элементов последовательности
+     * @return true - операция прошла успешно, false - отрицательное кол-во элементов или нулевой указатель
+     */
+    bool InsertSorted(const int* values, int count);
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index);
+
+    /**
+     * Удаление первого вхождения элемента с указанным значением ~ O(log n + n).
+     *
+     * @param value - значение удаляемого элемента
+     * @return true - элемент удален, false - элемент отсутствует
+     */
+    bool RemoveValue(int value);
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Емкость массива сохраняется.
+     */
+    void Clear();
+
+    /**
+     * Поиск индекса первого элемента, не меньшего value ~ O(log n).
+     *
+     * @param value - значение элемента
+     * @return индекс в [0, size] (size - все элементы меньше value)
+     */
+    int LowerBound(int value) const;
+
+    /**
+     * Поиск индекса первого элемента, большего value ~ O(log n).
+     *
+     * @param value - значение элемента
+     * @return индекс в [0, size] (size - все элементы не больше value)
+     */
+    int UpperBound(int value) const;
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(log n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(log n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override;
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество доступных ячеек массива
+     */
+    int capacity() const;
+
+    /**
+     * Возвращает указатель на элементы массива ~ O(1).
+     *
+     * @return указатель на первый элемент (элементы упорядочены по неубыванию)
+     */
+    const int* data() const;
+
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива в порядке неубывания ~ O(1).
+     *
+     * Только для чтения: изменение значений нарушило бы упорядоченность.
+     */
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    /**
+     * Непрерывное представление упорядоченных элементов массива ~ O(1).
+     *
+     * @return представление для чтения элементов
+     */
+    Span<const int> span() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    explicit SortedDynamicArray(const std::vector<int>& values);
+
+    std::vector<int> toVector() const;
+  };
+
+}  // namespace assignment
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <type_traits>  // enable_if_t, is_same_v
+
+namespace assignment {
+
+  /**
+   * Непрерывное представление последовательности элементов (аналог std::span из C++20).
+   *
+   * Не владеет памятью: действительно, пока не изменена емкость (или буфер) исходного контейнера.
+   * Итераторы - обычные указатели, поэтому циклы и алгоритмы <algorithm> над представлением
+   * не используют виртуальных вызовов и векторизуются компилятором.
+   *
+   * @tparam T - тип элементов (const T - представление только для чтения)
+   */
+  template <typename T>
+  struct Span {
+   private:
+    // поля структуры
+    T* data_{nullptr};  // указатель на первый элемент
+    int size_{0};       // кол-во элементов
+
+   public:
+    using element_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = T*;
+
+    /**
+     * Создание пустого представления ~ O(1).
+     */
+    Span() = default;
+
+    /**
+     * Создание представления над последовательностью ~ O(1).
+     *
+     * @param data - указатель на первый элемент
+     * @param size - кол-во элементов
+     */
+    Span(T* data, int size) : data_{data}, size_{size} {}
+
+    /**
+     * Преобразование представления для изменения в представление только для чтения ~ O(1).
+     */
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    Span(const Span<U>& other) : data_{other.data()}, size_{other.size()} {}
+
+    T* begin() const {
+      return data_;
+    }
+
+    T* end() const {
+      return data_ + size_;
+    }
+
+    T& operator[](int index) const {
+      return data_[index];
+    }
+
+    T* data() const {
+      return data_;
+    }
+
+    int size() const {
+      return size_;
+    }
+
+    bool empty() const {
+      return size_ == 0;
+    }
+
+    /**
+     * Представление части последовательности ~ O(1).
+     *
+     * @param offset - позиция первого элемента части
+     * @param count - кол-во элементов части
+     * @return представление [offset, offset + count)
+     */
+    Span subspan(int offset, int count) const {
+      return {data_ + offset, count};
+    }
+  };
+
+}  // namespace assignment
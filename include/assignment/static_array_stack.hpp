@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>  // copy, max
+#include <optional>   // optional
+#include <stdexcept>  // invalid_argument
+#include <utility>    // swap
+#include <vector>     // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/private/static_stack.hpp"  // StaticStack
+
+namespace assignment {
+
+  /**
+   * Структура данных "стек" на базе массива без виртуальных функций (header-only).
+   *
+   * Вариант ArrayStack для горячих участков кода: Push, Pop и Peek встраиваются в место вызова.
+   * Емкость увеличивается вдвое, политики емкости и источники памяти не поддерживаются (см. ArrayStack).
+   */
+  struct StaticArrayStack : StaticStack<StaticArrayStack> {
+   private:
+    // поля структуры
+    int size_{0};         // кол-во элементов в стеке
+    int capacity_{0};     // емкость стека (кол-во ячеек в массиве)
+    int* data_{nullptr};  // указатель на выделенный блок памяти
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = 10;         // начальная емкость стека
+    static constexpr int kCapacityGrowthFactor = 2;  // множитель увеличения емкости стека
+
+    /**
+     * Создание пустого стека с указанной емкостью ~ O(1).
+     *
+     * @param capacity - начальная емкость стека (опционально)
+     * @throws invalid_argument при неположительной емкости
+     */
+    explicit StaticArrayStack(int capacity = kInitCapacity) {
+      if (capacity <= 0) {
+        throw std::invalid_argument("capacity is not positive");
+      }
+      data_ = new int[capacity];
+      capacity_ = capacity;
+    }
+
+    StaticArrayStack(const StaticArrayStack& other) : StaticArrayStack(other.capacity_) {
+      std::copy(other.data_, other.data_ + other.size_, data_);
+      size_ = other.size_;
+    }
+
+    StaticArrayStack(StaticArrayStack&& other) noexcept {
+      Swap(other);
+    }
+
+    StaticArrayStack& operator=(StaticArrayStack other) noexcept {
+      Swap(other);
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(1).
+     */
+    ~StaticArrayStack() {
+      delete[] data_;
+    }
+
+    /**
+     * Добавление элемента на вершину стека ~ O(1) амортизированно.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Push(int value) {
+      if (size_ == capacity_) {
+        Grow();
+      }
+      data_[size_] = value;
+      size_++;
+    }
+
+    /**
+     * Удаление элемента с вершины стека ~ O(1).
+     *
+     * @return true - операция прошла успешно, false - стек пустой
+     */
+    bool Pop() {
+      if (size_ == 0) {
+        return false;
+      }
+      size_--;
+      return true;
+    }
+
+    /**
+     * Очистка стека ~ O(1).
+     *
+     * Емкость стека сохраняется.
+     */
+    void Clear() {
+      size_ = 0;
+    }
+
+    /**
+     * Получение значения элемента на вершине стека ~ O(1).
+     *
+     * @return значение элемента или ничего (стек пустой)
+     */
+    std::optional<int> Peek() const {
+      if (size_ == 0) {
+        return std::nullopt;
+      }
+      return data_[size_ - 1];
+    }
+
+    /**
+     * Возвращает размер стека ~ O(1).
+     *
+     * @return количество элементов в стеке
+     */
+    int size() const {
+      return size_;
+    }
+
+    /**
+     * Возвращает емкость стека ~ O(1).
+     *
+     * @return количество выделенных ячеек стека
+     */
+    int capacity() const {
+      return capacity_;
+    }
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const {
+      return {data_, data_ + size_};
+    }
+
+   private:
+    /**
+     * Увеличение емкости стека в kCapacityGrowthFactor раз ~ O(n).
+     *
+     * Перемещенный стек (нулевая емкость) получает емкость kInitCapacity.
+     */
+    void Grow() {
+      const int new_capacity = std::max(capacity_ * kCapacityGrowthFactor, kInitCapacity);
+      int* new_data = new int[new_capacity];
+      std::copy(data_, data_ + size_, new_data);
+      delete[] data_;
+      data_ = new_data;
+      capacity_ = new_capacity;
+    }
+
+    void Swap(StaticArrayStack& other) noexcept {
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(data_, other.data_);
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>  // copy, max
+#include <cstring>    // memmove
+#include <optional>   // optional
+#include <stdexcept>  // invalid_argument
+#include <utility>    // swap
+#include <vector>     // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/simd.hpp"                 // FindFirst
+#include "assignment/span.hpp"                 // Span
+#include "assignment/private/static_list.hpp"  // StaticList
+
+namespace assignment {
+
+  /**
+   * Структура данных "массив переменной длины" без виртуальных функций (header-only).
+   *
+   * Вариант DynamicArray для горячих участков кода: все операции определены в заголовке
+   * и встраиваются в место вызова. Емкость увеличивается вдвое, политики емкости,
+   * источники памяти и снимки не поддерживаются (см. DynamicArray).
+   */
+  struct StaticDynamicArray : StaticList<StaticDynamicArray> {
+   private:
+    // поля структуры
+    int size_{0};         // кол-во элементов в массиве
+    int capacity_{0};     // емкость массива (кол-во ячеек в массиве)
+    int* data_{nullptr};  // указатель на выделенный блок памяти
+
+   public:
+    // константы структуры
+    static constexpr int kInitCapacity = 10;         // начальная емкость массива
+    static constexpr int kCapacityGrowthFactor = 2;  // множитель увеличения емкости массива
+
+    /**
+     * Создание пустого массива с указанной емкостью ~ O(1).
+     *
+     * @param capacity - начальная емкость массива (опционально)
+     * @throws invalid_argument при неположительной емкости
+     */
+    explicit StaticDynamicArray(int capacity = kInitCapacity) {
+      if (capacity <= 0) {
+        throw std::invalid_argument("capacity is not positive");
+      }
+      data_ = new int[capacity];
+      capacity_ = capacity;
+    }
+
+    StaticDynamicArray(const StaticDynamicArray& other) : StaticDynamicArray(other.capacity_) {
+      std::copy(other.data_, other.data_ + other.size_, data_);
+      size_ = other.size_;
+    }
+
+    StaticDynamicArray(StaticDynamicArray&& other) noexcept {
+      Swap(other);
+    }
+
+    StaticDynamicArray& operator=(StaticDynamicArray other) noexcept {
+      Swap(other);
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(1).
+     */
+    ~StaticDynamicArray() {
+      delete[] data_;
+    }
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) амортизированно.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) {
+      if (size_ == capacity_) {
+        Grow();
+      }
+      data_[size_] = value;
+      size_++;
+    }
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(n).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, int value) {
+      if ((index < 0)||(index > size_)) {
+        return false;
+      }
+      if (size_ == capacity_) {
+        Grow();
+      }
+      std::memmove(data_ + index + 1, data_ + index, static_cast<std::size_t>(size_ - index) * sizeof(int));
+      data_[index] = value;
+      size_++;
+      return true;
+    }
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, int new_value) {
+      if ((index < 0)||(index >= size_)) {
+        return false;
+      }
+      data_[index] = new_value;
+      return true;
+    }
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index) {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      const int removed = data_[index];
+      std::memmove(data_ + index, data_ + index + 1, static_cast<std::size_t>(size_ - index - 1) * sizeof(int));
+      size_--;
+      return removed;
+    }
+
+    /**
+     * Очистка массива ~ O(1).
+     *
+     * Емкость массива сохраняется.
+     */
+    void Clear() {
+      size_ = 0;
+    }
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      return data_[index];
+    }
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const {
+      const int index = simd::FindFirst(data_, size_, value);
+      if (index < 0) {
+        return std::nullopt;
+      }
+      return index;
+    }
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const {
+      return size_;
+    }
+
+    /**
+     * Возвращает емкость массива ~ O(1).
+     *
+     * @return количество выделенных ячеек массива
+     */
+    int capacity() const {
+      return capacity_;
+    }
+
+    using iterator = int*;
+    using const_iterator = const int*;
+
+    /**
+     * Итераторы произвольного доступа по элементам массива ~ O(1).
+     *
+     * Итераторы действительны до изменения емкости массива.
+     */
+    iterator begin() {
+      return data_;
+    }
+
+    iterator end() {
+      return data_ + size_;
+    }
+
+    const_iterator begin() const {
+      return data_;
+    }
+
+    const_iterator end() const {
+      return data_ + size_;
+    }
+
+    /**
+     * Непрерывное представление элементов массива [0, size) ~ O(1).
+     *
+     * @return представление для изменения (для константного массива - для чтения) элементов
+     */
+    Span<int> span() {
+      return {data_, size_};
+    }
+
+    Span<const int> span() const {
+      return {data_, size_};
+    }
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const {
+      return {data_, data_ + size_};
+    }
+
+   private:
+    /**
+     * Увеличение емкости массива в kCapacityGrowthFactor раз ~ O(n).
+     *
+     * Перемещенный массив (нулевая емкость) получает емкость kInitCapacity.
+     */
+    void Grow() {
+      const int new_capacity = std::max(capacity_ * kCapacityGrowthFactor, kInitCapacity);
+      int* new_data = new int[new_capacity];
+      std::copy(data_, data_ + size_, new_data);
+      delete[] data_;
+      data_ = new_data;
+      capacity_ = new_capacity;
+    }
+
+    void Swap(StaticDynamicArray& other) noexcept {
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(data_, other.data_);
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <optional>  // optional
+#include <utility>   // move, swap
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/node.hpp"                 // Node
+#include "assignment/node_iterator.hpp"        // NodeIterator
+#include "assignment/private/static_list.hpp"  // StaticList
+
+namespace assignment {
+
+  /**
+   * Структура данных "связный список" без виртуальных функций (header-only).
+   *
+   * Вариант LinkedList для горячих участков кода: операции над концами списка
+   * (Add, вставка и удаление в начале, front, back) встраиваются в место вызова.
+   */
+  struct StaticLinkedList : StaticList<StaticLinkedList> {
+   private:
+    // поля структуры
+    int size_{0};           // кол-во узлов в списке
+    Node* front_{nullptr};  // указатель на начальный узел
+    Node* back_{nullptr};   // указатель на конечный узел
+
+   public:
+    /**
+     * Создание пустого связного списка ~ O(1).
+     */
+    StaticLinkedList() = default;
+
+    StaticLinkedList(const StaticLinkedList& other) = delete;
+
+    StaticLinkedList(StaticLinkedList&& other) noexcept {
+      Swap(other);
+    }
+
+    StaticLinkedList& operator=(const StaticLinkedList& other) = delete;
+
+    StaticLinkedList& operator=(StaticLinkedList&& other) noexcept {
+      StaticLinkedList moved(std::move(other));
+      Swap(moved);
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(n).
+     *
+     * Высвобождает узлы списка.
+     */
+    ~StaticLinkedList() {
+      Clear();
+    }
+
+    /**
+     * Добавление элемента в конец списка ~ O(1).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) {
+      Node* node = new Node(value);
+      if (back_ == nullptr) {
+        front_ = node;
+      } else {
+        back_->next = node;
+      }
+      back_ = node;
+      size_++;
+    }
+
+    /**
+     * Вставка элемента в список по индексу ~ O(n).
+     * Вставка в начало или конец списка ~ O(1).
+     *
+     * @param index - позиция для вставки элемента в список
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Insert(int index, int value) {
+      if ((index < 0)||(index > size_)) {
+        return false;
+      }
+      if (index == size_) {
+        Add(value);
+        return true;
+      }
+      if (index == 0) {
+        front_ = new Node(value, front_);
+      } else {
+        Node* prev = FindNode(index - 1);
+        prev->next = new Node(value, prev->next);
+      }
+      size_++;
+      return true;
+    }
+
+    /**
+     * Изменение значения элемента списка по индексу ~ O(n).
+     *
+     * @param index - позиция изменяемого элемента списка
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Set(int index, int new_value) {
+      Node* node = FindNode(index);
+      if (node == nullptr) {
+        return false;
+      }
+      node->value = new_value;
+      return true;
+    }
+
+    /**
+     * Удаление элемента из списка по индексу ~ O(n).
+     * Удаление элемента с начала списка ~ O(1).
+     *
+     * @param index - позиция удаляемого элемента в списке
+     * @return значение удаленного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Remove(int index) {
+      if ((index < 0)||(index >= size_)) {
+        return std::nullopt;
+      }
+      Node* prev = index == 0 ? nullptr : FindNode(index - 1);
+      Node* removed = prev == nullptr ? front_ : prev->next;
+
+      if (prev == nullptr) {
+        front_ = removed->next;
+      } else {
+        prev->next = removed->next;
+      }
+      if (removed == back_) {
+        back_ = prev;
+      }
+      const int value = removed->value;
+      delete removed;
+      size_--;
+      return value;
+    }
+
+    /**
+     * Очистка списка ~ O(n).
+     *
+     * Высвобождает узлы списка.
+     */
+    void Clear() {
+      while (front_ != nullptr) {
+        Node* next = front_->next;
+        delete front_;
+        front_ = next;
+      }
+      back_ = nullptr;
+      size_ = 0;
+    }
+
+    /**
+     * Получение значения элемента списка по индексу ~ O(n).
+     *
+     * @param index - позиция элемента в списке
+     * @return значение найденного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Get(int index) const {
+      const Node* node = FindNode(index);
+      if (node == nullptr) {
+        return std::nullopt;
+      }
+      return node->value;
+    }
+
+    /**
+     * Поиск индекса первого вхождения узла с указанным значением ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const {
+      int index = 0;
+      for (const Node* node = front_; node != nullptr; node = node->next, index++) {
+        if (node->value == value) {
+          return index;
+        }
+      }
+      return std::nullopt;
+    }
+
+    /**
+     * Возвращает размер списка ~ O(1).
+     *
+     * @return количество элементов в списке
+     */
+    int size() const {
+      return size_;
+    }
+
+    /**
+     * Возвращает начальный элемент списка ~ O(1).
+     *
+     * @return значение начального узла или ничего (пустой список)
+     */
+    std::optional<int> front() const {
+      if (front_ == nullptr) {
+        return std::nullopt;
+      }
+      return front_->value;
+    }
+
+    /**
+     * Возвращает конечный элемент списка ~ O(1).
+     *
+     * @return значение конечного узла или ничего (пустой список)
+     */
+    std::optional<int> back() const {
+      if (back_ == nullptr) {
+        return std::nullopt;
+      }
+      return back_->value;
+    }
+
+    using iterator = NodeIterator<int>;
+    using const_iterator = NodeIterator<const int>;
+
+    iterator begin() {
+      return iterator(front_);
+    }
+
+    iterator end() {
+      return iterator(nullptr);
+    }
+
+    const_iterator begin() const {
+      return const_iterator(front_);
+    }
+
+    const_iterator end() const {
+      return const_iterator(nullptr);
+    }
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const {
+      return {begin(), end()};
+    }
+
+   private:
+    /**
+     * Поиск узла по индексу ~ O(n).
+     *
+     * @param index - позиция узла в списке
+     * @return указатель на найденный узел или nullptr (индекс за пределами списка)
+     */
+    Node* FindNode(int index) const {
+      if ((index < 0)||(index >= size_)) {
+        return nullptr;
+      }
+      Node* node = front_;
+      for (int i = 0; i < index; i++) {
+        node = node->next;
+      }
+      return node;
+    }
+
+    void Swap(StaticLinkedList& other) noexcept {
+      std::swap(size_, other.size_);
+      std::swap(front_, other.front_);
+      std::swap(back_, other.back_);
+    }
+  };
+
+}  // namespace assignment
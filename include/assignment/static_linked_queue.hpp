@@ -0,0 +1,155 @@
+#pragma once
+
+#include <optional>  // optional
+#include <utility>   // move, swap
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/node.hpp"                  // Node
+#include "assignment/node_iterator.hpp"         // NodeIterator
+#include "assignment/private/static_queue.hpp"  // StaticQueue
+
+namespace assignment {
+
+  /**
+   * Структура данных "очередь" на базе связного списка без виртуальных функций (header-only).
+   *
+   * Вариант LinkedQueue для горячих участков кода: все операции встраиваются в место вызова.
+   */
+  struct StaticLinkedQueue : StaticQueue<StaticLinkedQueue> {
+   private:
+    // поля структуры
+    int size_{0};           // кол-во узлов в очереди
+    Node* front_{nullptr};  // указатель на начало очереди
+    Node* back_{nullptr};   // указатель на конец очереди
+
+   public:
+    /**
+     * Создание пустой очереди ~ O(1).
+     */
+    StaticLinkedQueue() = default;
+
+    StaticLinkedQueue(const StaticLinkedQueue& other) = delete;
+
+    StaticLinkedQueue(StaticLinkedQueue&& other) noexcept {
+      Swap(other);
+    }
+
+    StaticLinkedQueue& operator=(const StaticLinkedQueue& other) = delete;
+
+    StaticLinkedQueue& operator=(StaticLinkedQueue&& other) noexcept {
+      StaticLinkedQueue moved(std::move(other));
+      Swap(moved);
+      return *this;
+    }
+
+    /**
+     * Деструктор ~ O(n).
+     *
+     * Высвобождает узлы очереди.
+     */
+    ~StaticLinkedQueue() {
+      Clear();
+    }
+
+    /**
+     * Добавление элемента в конец очереди ~ O(1).
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Enqueue(int value) {
+      Node* node = new Node(value);
+      if (back_ == nullptr) {
+        front_ = node;
+      } else {
+        back_->next = node;
+      }
+      back_ = node;
+      size_++;
+    }
+
+    /**
+     * Удаление элемента из начала очереди ~ O(1).
+     *
+     * @return true - операция успешна, false - операция невозможна (очередь пуста)
+     */
+    bool Dequeue() {
+      if (front_ == nullptr) {
+        return false;
+      }
+      Node* removed = front_;
+      front_ = front_->next;
+      if (front_ == nullptr) {
+        back_ = nullptr;
+      }
+      delete removed;
+      size_--;
+      return true;
+    }
+
+    /**
+     * Очистка очереди ~ O(n).
+     *
+     * Высвобождает узлы очереди.
+     */
+    void Clear() {
+      while (Dequeue()) {
+      }
+    }
+
+    /**
+     * Получение элемента в начале очереди ~ O(1).
+     *
+     * @return значение элемента или ничего (пустая очередь)
+     */
+    std::optional<int> front() const {
+      if (front_ == nullptr) {
+        return std::nullopt;
+      }
+      return front_->value;
+    }
+
+    /**
+     * Получение элемента в конце очереди ~ O(1).
+     *
+     * @return значение элемента или ничего (пустая очередь)
+     */
+    std::optional<int> back() const {
+      if (back_ == nullptr) {
+        return std::nullopt;
+      }
+      return back_->value;
+    }
+
+    /**
+     * Возвращает размер очереди ~ O(1).
+     *
+     * @return количество элементов в очереди
+     */
+    int size() const {
+      return size_;
+    }
+
+    using const_iterator = NodeIterator<const int>;
+
+    const_iterator begin() const {
+      return const_iterator(front_);
+    }
+
+    const_iterator end() const {
+      return const_iterator(nullptr);
+    }
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const {
+      return {begin(), end()};
+    }
+
+   private:
+    void Swap(StaticLinkedQueue& other) noexcept {
+      std::swap(size_, other.size_);
+      std::swap(front_, other.front_);
+      std::swap(back_, other.back_);
+    }
+  };
+
+}  // namespace assignment
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>              // atomic
+#include <condition_variable>  // condition_variable
+#include <functional>          // function
+#include <mutex>               // mutex
+#include <thread>              // thread
+#include <vector>              // vector
+
+namespace assignment {
+
+  /**
+   * Пул потоков для параллельного выполнения пронумерованных задач (fork-join).
+   *
+   * Вызывающий поток участвует в выполнении задач наравне с рабочими потоками,
+   * задачи раздаются по возрастанию номеров через общий атомарный счетчик.
+   * Одновременно выполняется не более одного набора задач, остальные вызовы ожидают.
+   */
+  struct ThreadPool {
+   private:
+    using Task = std::function<void(int)>;
+
+    // поля структуры
+    std::vector<std::thread> workers_;  // рабочие потоки
+
+    std::mutex run_mutex_;              // сериализация вызовов ParallelFor
+    std::mutex mutex_;                  // защита состояния текущего набора задач
+    std::condition_variable wake_;      // пробуждение рабочих потоков
+    std::condition_variable done_;      // завершение набора задач рабочими потоками
+
+    const Task* task_{nullptr};         // текущая задача
+    int tasks_{0};                      // кол-во задач в наборе
+    std::atomic<int> next_{0};          // номер следующей невыданной задачи
+    int active_{0};                     // кол-во рабочих потоков, не завершивших набор
+    unsigned generation_{0};            // номер текущего набора задач
+    bool stop_{false};                  // признак остановки пула
+
+   public:
+    /**
+     * Создание пула потоков ~ O(threads).
+     *
+     * @param threads - общее кол-во потоков, включая вызывающий (по умолчанию - кол-во ядер процессора)
+     * @throws invalid_argument при указании неположительного кол-ва потоков
+     */
+    explicit ThreadPool(int threads = DefaultThreads());
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Деструктор ~ O(threads).
+     *
+     * Останавливает и присоединяет рабочие потоки.
+     */
+    ~ThreadPool();
+
+    /**
+     * Параллельное выполнение задач task(0), ..., task(count - 1) ~ O(count / threads).
+     *
+     * Возвращает управление после завершения всех задач.
+     * Задачи не должны выбрасывать исключения.
+     *
+     * @param count - кол-во задач
+     * @param task - задача, принимающая свой номер
+     */
+    void ParallelFor(int count, const Task& task);
+
+    /**
+     * Возвращает кол-во потоков пула ~ O(1).
+     *
+     * @return кол-во потоков, включая вызывающий
+     */
+    int size() const;
+
+    /**
+     * Возвращает кол-во потоков по умолчанию.
+     *
+     * @return кол-во аппаратных потоков процессора (не менее 1)
+     */
+    static int DefaultThreads();
+
+   private:
+    /**
+     * Выполнение невыданных задач текущего набора.
+     */
+    void RunTasks();
+
+    /**
+     * Цикл рабочего потока.
+     */
+    void WorkerLoop();
+  };
+
+}  // namespace assignment
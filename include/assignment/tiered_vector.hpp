@@ -0,0 +1,189 @@
+#pragma once
+
+#include <optional>  // optional
+#include <vector>    // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/private/list.hpp"  // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "многоуровневый вектор" (tiered vector).
+   *
+   * Элементы хранятся в блоках емкостью B = 2^shift, каждый блок - кольцевой буфер со своим началом (head).
+   * Все используемые блоки, кроме последнего, заполнены полностью, поэтому доступ по индексу ~ O(1).
+   * Вставка и удаление сдвигают элементы только внутри одного блока (O(B)), в остальных блоках
+   * один элемент переносится между соседями сдвигом head (O(n / B)).
+   * Размер блока поддерживается порядка √n: при росте и уменьшении массива блоки перестраиваются.
+   */
+  struct TieredVector : List {
+   private:
+    // кольцевой буфер емкостью 2^shift
+    struct Block {
+      int* data;  // ячейки блока
+      int head;   // позиция первого элемента блока
+    };
+
+    // поля структуры
+    int size_{0};                // кол-во элементов в массиве
+    int shift_{kMinBlockShift};  // log2 емкости блока
+    int block_count_{0};         // кол-во выделенных блоков
+    int directory_capacity_{0};  // емкость каталога блоков
+    Block* blocks_{nullptr};     // каталог блоков
+
+   public:
+    // константы структуры
+    static constexpr int kMinBlockShift = 5;  // минимальный размер блока - 32 элемента
+
+    /**
+     * Создание пустого массива ~ O(1).
+     */
+    TieredVector() = default;
+
+    /**
+     * Создание копии массива ~ O(n).
+     *
+     * @param other - копируемый массив
+     */
+    TieredVector(const TieredVector& other);
+
+    /**
+     * Перемещение массива ~ O(1).
+     *
+     * @param other - перемещаемый массив, становится пустым
+     */
+    TieredVector(TieredVector&& other) noexcept;
+
+    TieredVector& operator=(const TieredVector& other);
+
+    TieredVector& operator=(TieredVector&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков).
+     *
+     * Высвобождает блоки и каталог.
+     */
+    ~TieredVector() override;
+
+    /**
+     * Добавление элемента в конец массива ~ O(1) амортизированно.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента в массив по индексу ~ O(√n).
+     *
+     * @param index - позиция для вставки элемента в массив
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция изменяемого элемента в массиве
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами массива
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из массива по индексу ~ O(√n).
+     *
+     * @param index - позиция удаляемого элемента в массиве
+     * @return значение удаленного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка массива ~ O(кол-во блоков).
+     *
+     * Высвобождает все блоки, размер блока возвращается к минимальному.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента массива по индексу ~ O(1).
+     *
+     * @param index - позиция элемента в массиве
+     * @return значение найденного элемента или ничего (индекс за пределами массива)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * Каждый блок просматривается как два непрерывных отрезка векторными инструкциями.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в массиве по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в массиве, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты массива ~ O(1).
+     *
+     * @return true - массив пустой, false - в массиве есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер массива ~ O(1).
+     *
+     * @return количество элементов в массиве
+     */
+    int size() const override;
+
+    /**
+     * Возвращает емкость блока ~ O(1).
+     *
+     * @return кол-во ячеек в одном блоке
+     */
+    int block_size() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Возвращает ячейку элемента по индексу ~ O(1).
+     */
+    int& At(int index) const;
+
+    /**
+     * Подготовка ячейки под новый элемент в конце массива ~ O(1) амортизированно.
+     *
+     * При необходимости увеличивает размер блока или выделяет новый блок.
+     */
+    void Reserve();
+
+    /**
+     * Перестроение массива в блоки емкостью 2^new_shift ~ O(n).
+     *
+     * @param new_shift - log2 новой емкости блока
+     */
+    void Rebuild(int new_shift);
+
+    /**
+     * Высвобождение блоков и каталога ~ O(кол-во блоков).
+     */
+    void Release();
+
+    /**
+     * Обмен содержимым двух массивов ~ O(1).
+     */
+    void Swap(TieredVector& other) noexcept;
+  };
+
+}  // namespace assignment
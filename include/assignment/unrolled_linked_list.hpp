@@ -0,0 +1,241 @@
+#pragma once
+
+#include <memory_resource>  // memory_resource
+#include <optional>         // optional
+#include <vector>           // НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ
+
+#include "assignment/node_pool.hpp"     // NodePool
+#include "assignment/private/list.hpp"  // List
+
+namespace assignment {
+
+  /**
+   * Структура данных "развернутый связный список" (unrolled linked list).
+   *
+   * Каждый узел хранит до kNodeCapacity значений подряд, узел занимает ровно 4 кэш-линии.
+   * Проход по списку - последовательное чтение массивов внутри узлов с одним переходом по указателю
+   * на kNodeCapacity значений (у LinkedList - переход на каждое значение).
+   *
+   * Вставка в заполненный узел делит его пополам. Удаление, после которого в узле остается меньше
+   * kNodeCapacity / 2 значений, объединяет узел со следующим или забирает у следующего половину разницы.
+   * Поэтому все узлы, кроме последнего, заполнены не меньше чем наполовину.
+   *
+   * Узлы выделяются из собственного пула списка (NodePool).
+   */
+  struct UnrolledLinkedList : List {
+   public:
+    // константы структуры
+    static constexpr int kNodeCapacity = 60;                // кол-во значений в узле
+    static constexpr int kMinNodeSize = kNodeCapacity / 2;  // наименьшее кол-во значений в узле (кроме последнего)
+
+   private:
+    // узел списка: заголовок и значения, 256 байт
+    struct alignas(64) Chunk {
+      Chunk* next;                // следующий узел
+      int size;                   // кол-во значений в узле
+      int values[kNodeCapacity];  // значения узла
+    };
+
+    static_assert(sizeof(Chunk) == 256, "chunk should occupy exactly four cache lines");
+
+    // поля структуры
+    int size_{0};              // кол-во элементов в списке
+    int chunk_count_{0};       // кол-во узлов в списке
+    Chunk* front_{nullptr};    // указатель на начальный узел
+    Chunk* back_{nullptr};     // указатель на конечный узел
+    NodePool<Chunk, 4> pool_;  // пул узлов (удаленные узлы переиспользуются)
+
+   public:
+    /**
+     * Создание пустого списка ~ O(1).
+     */
+    UnrolledLinkedList() = default;
+
+    /**
+     * Создание пустого списка с источником памяти для узлов ~ O(1).
+     *
+     * Источник памяти должен существовать дольше списка.
+     *
+     * @param resource - источник памяти
+     * @throws invalid_argument при нулевом указателе на ресурс
+     */
+    explicit UnrolledLinkedList(std::pmr::memory_resource* resource);
+
+    /**
+     * Создание копии списка ~ O(n).
+     *
+     * Узлы копии заполняются полностью (в копии не больше узлов, чем в оригинале).
+     *
+     * @param other - копируемый список
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other);
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other);
+
+    /**
+     * Перемещение списка ~ O(1).
+     *
+     * @param other - перемещаемый список, становится пустым
+     */
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept;
+
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept;
+
+    /**
+     * Деструктор ~ O(кол-во блоков пула).
+     *
+     * Высвобождает выделенную память.
+     */
+    ~UnrolledLinkedList() override;
+
+    /**
+     * Добавление элемента в конец списка ~ O(1).
+     *
+     * Новый узел создается только при заполненном конечном узле.
+     *
+     * @param value - значение добавляемого элемента
+     */
+    void Add(int value) override;
+
+    /**
+     * Вставка элемента в список по индексу ~ O(n / kNodeCapacity + kNodeCapacity).
+     *
+     * Заполненный узел делится пополам.
+     *
+     * @param index - позиция для вставки элемента в список
+     * @param value - значение вставляемого элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Insert(int index, int value) override;
+
+    /**
+     * Изменение значения элемента списка по индексу ~ O(n / kNodeCapacity).
+     *
+     * @param index - позиция изменяемого элемента списка
+     * @param new_value - новое значение элемента
+     * @return true - операция прошла успешно, false - индекс за пределами списка
+     */
+    bool Set(int index, int new_value) override;
+
+    /**
+     * Удаление элемента из списка по индексу ~ O(n / kNodeCapacity + kNodeCapacity).
+     *
+     * Узел, заполненный меньше чем наполовину, объединяется со следующим или забирает у него значения.
+     *
+     * @param index - позиция удаляемого элемента в списке
+     * @return значение удаленного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Remove(int index) override;
+
+    /**
+     * Очистка списка ~ O(кол-во блоков пула).
+     *
+     * Наибольший блок пула сохраняется для следующих добавлений.
+     */
+    void Clear() override;
+
+    /**
+     * Получение значения элемента списка по индексу ~ O(n / kNodeCapacity).
+     *
+     * @param index - позиция элемента в списке
+     * @return значение найденного элемента или ничего (индекс за пределами списка)
+     */
+    std::optional<int> Get(int index) const override;
+
+    /**
+     * Поиск индекса первого вхождения элемента с указанным значением ~ O(n).
+     *
+     * Значения узлов просматриваются векторными инструкциями, см. simd::FindFirst.
+     *
+     * @param value - значение элемента
+     * @return индекс найденного элемента или ничего (в случае отсутствия элемента)
+     */
+    std::optional<int> IndexOf(int value) const override;
+
+    /**
+     * Проверка наличия элемента в списке по значению ~ O(n).
+     *
+     * @param value - значение элемента
+     * @return true - при наличии элемента в списке, false - при отсутствии элемента
+     */
+    bool Contains(int value) const override;
+
+    /**
+     * Проверка пустоты списка ~ O(1).
+     *
+     * @return true - если список пустой, false - в списке есть элементы
+     */
+    bool IsEmpty() const override;
+
+    /**
+     * Возвращает размер списка ~ O(1).
+     *
+     * @return количество элементов в списке
+     */
+    int size() const override;
+
+    /**
+     * Возвращает кол-во узлов списка ~ O(1).
+     *
+     * @return количество узлов
+     */
+    int chunk_count() const;
+
+    /**
+     * Возвращает пул узлов списка ~ O(1).
+     *
+     * @return пул узлов (кол-во узлов и блоков, объем памяти, источник памяти)
+     */
+    const NodePool<Chunk, 4>& pool() const;
+
+    /**
+     * Возвращает начальный элемент списка ~ O(1).
+     *
+     * @return значение начального элемента или ничего (список пуст)
+     */
+    std::optional<int> front() const;
+
+    /**
+     * Возвращает конечный элемент списка ~ O(1).
+     *
+     * @return значение конечного элемента или ничего (список пуст)
+     */
+    std::optional<int> back() const;
+
+    // ДЛЯ ТЕСТИРОВАНИЯ
+    std::vector<int> toVector() const;
+
+   private:
+    /**
+     * Поиск узла, содержащего элемент с индексом index ~ O(n / kNodeCapacity).
+     *
+     * @param index - позиция элемента в списке, 0 <= index < size; заменяется позицией в узле
+     * @param prev - предыдущий узел (nullptr для начального), если не нулевой указатель
+     * @return указатель на узел
+     */
+    Chunk* FindChunk(int& index, Chunk** prev = nullptr) const;
+
+    /**
+     * Создание пустого узла после узла chunk (в конце списка при нулевом chunk) ~ O(1).
+     *
+     * @return указатель на созданный узел
+     */
+    Chunk* InsertChunkAfter(Chunk* chunk);
+
+    /**
+     * Удаление узла, следующего за prev (начального при нулевом prev) ~ O(1).
+     */
+    void RemoveChunkAfter(Chunk* prev);
+
+    /**
+     * Восстановление заполненности узла после удаления из него значения ~ O(kNodeCapacity).
+     */
+    void Rebalance(Chunk* chunk, Chunk* prev);
+
+    /**
+     * Обмен содержимым двух списков ~ O(1).
+     */
+    void Swap(UnrolledLinkedList& other) noexcept;
+  };
+
+}  // namespace assignment
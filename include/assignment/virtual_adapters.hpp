@@ -0,0 +1,209 @@
+#pragma once
+
+#include <optional>  // optional
+#include <utility>   // forward
+
+#include "assignment/private/list.hpp"   // List
+#include "assignment/private/queue.hpp"  // Queue
+#include "assignment/private/stack.hpp"  // Stack
+
+namespace assignment {
+
+  /**
+   * Адаптер статического списка (StaticList) к виртуальному интерфейсу List.
+   *
+   * Каждая операция - один виртуальный вызов, внутри которого операция Impl встраивается.
+   * Используется там, где требуется полиморфизм времени выполнения (например, List&).
+   *
+   * @tparam Impl - статический список (StaticDynamicArray, StaticLinkedList)
+   */
+  template <typename Impl>
+  struct ListAdapter final : List {
+   private:
+    // поля структуры
+    Impl impl_;  // адаптируемый список
+
+   public:
+    /**
+     * Создание адаптера с аргументами конструктора Impl.
+     *
+     * @param args - аргументы конструктора адаптируемого списка
+     */
+    template <typename... Args>
+    explicit ListAdapter(Args&&... args) : impl_(std::forward<Args>(args)...) {}
+
+    void Add(int value) override {
+      impl_.Add(value);
+    }
+
+    bool Insert(int index, int value) override {
+      return impl_.Insert(index, value);
+    }
+
+    bool Set(int index, int new_value) override {
+      return impl_.Set(index, new_value);
+    }
+
+    std::optional<int> Remove(int index) override {
+      return impl_.Remove(index);
+    }
+
+    void Clear() override {
+      impl_.Clear();
+    }
+
+    std::optional<int> Get(int index) const override {
+      return impl_.Get(index);
+    }
+
+    std::optional<int> IndexOf(int value) const override {
+      return impl_.IndexOf(value);
+    }
+
+    bool Contains(int value) const override {
+      return impl_.Contains(value);
+    }
+
+    bool IsEmpty() const override {
+      return impl_.IsEmpty();
+    }
+
+    int size() const override {
+      return impl_.size();
+    }
+
+    /**
+     * Возвращает адаптируемый список для вызовов без виртуальной диспетчеризации ~ O(1).
+     *
+     * @return ссылка на адаптируемый список
+     */
+    Impl& impl() {
+      return impl_;
+    }
+
+    const Impl& impl() const {
+      return impl_;
+    }
+  };
+
+  /**
+   * Адаптер статического стека (StaticStack) к виртуальному интерфейсу Stack.
+   *
+   * @tparam Impl - статический стек (StaticArrayStack)
+   */
+  template <typename Impl>
+  struct StackAdapter final : Stack {
+   private:
+    // поля структуры
+    Impl impl_;  // адаптируемый стек
+
+   public:
+    /**
+     * Создание адаптера с аргументами конструктора Impl.
+     *
+     * @param args - аргументы конструктора адаптируемого стека
+     */
+    template <typename... Args>
+    explicit StackAdapter(Args&&... args) : impl_(std::forward<Args>(args)...) {}
+
+    void Push(int value) override {
+      impl_.Push(value);
+    }
+
+    bool Pop() override {
+      return impl_.Pop();
+    }
+
+    void Clear() override {
+      impl_.Clear();
+    }
+
+    std::optional<int> Peek() const override {
+      return impl_.Peek();
+    }
+
+    bool IsEmpty() const override {
+      return impl_.IsEmpty();
+    }
+
+    int size() const override {
+      return impl_.size();
+    }
+
+    /**
+     * Возвращает адаптируемый стек для вызовов без виртуальной диспетчеризации ~ O(1).
+     *
+     * @return ссылка на адаптируемый стек
+     */
+    Impl& impl() {
+      return impl_;
+    }
+
+    const Impl& impl() const {
+      return impl_;
+    }
+  };
+
+  /**
+   * Адаптер статической очереди (StaticQueue) к виртуальному интерфейсу Queue.
+   *
+   * @tparam Impl - статическая очередь (StaticLinkedQueue)
+   */
+  template <typename Impl>
+  struct QueueAdapter final : Queue {
+   private:
+    // поля структуры
+    Impl impl_;  // адаптируемая очередь
+
+   public:
+    /**
+     * Создание адаптера с аргументами конструктора Impl.
+     *
+     * @param args - аргументы конструктора адаптируемой очереди
+     */
+    template <typename... Args>
+    explicit QueueAdapter(Args&&... args) : impl_(std::forward<Args>(args)...) {}
+
+    void Enqueue(int value) override {
+      impl_.Enqueue(value);
+    }
+
+    bool Dequeue() override {
+      return impl_.Dequeue();
+    }
+
+    void Clear() override {
+      impl_.Clear();
+    }
+
+    std::optional<int> front() const override {
+      return impl_.front();
+    }
+
+    std::optional<int> back() const override {
+      return impl_.back();
+    }
+
+    bool IsEmpty() const override {
+      return impl_.IsEmpty();
+    }
+
+    int size() const override {
+      return impl_.size();
+    }
+
+    /**
+     * Возвращает адаптируемую очередь для вызовов без виртуальной диспетчеризации ~ O(1).
+     *
+     * @return ссылка на адаптируемую очередь
+     */
+    Impl& impl() {
+      return impl_;
+    }
+
+    const Impl& impl() const {
+      return impl_;
+    }
+  };
+
+}  // namespace assignment
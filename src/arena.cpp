@@ -0,0 +1,86 @@
+#include "assignment/arena.hpp"
+
+#include <algorithm>  // max
+#include <cstdint>    // uintptr_t
+#include <stdexcept>  // invalid_argument
+
+namespace assignment {
+
+  MonotonicArena::MonotonicArena(std::size_t init_chunk_size, std::pmr::memory_resource* upstream)
+      : upstream_{upstream}, next_chunk_size_{init_chunk_size} {
+    if (init_chunk_size == 0) {
+      throw std::invalid_argument("chunk size is zero");
+    }
+    if (upstream == nullptr) {
+      throw std::invalid_argument("upstream resource is null");
+    }
+  }
+
+  MonotonicArena::~MonotonicArena() {
+    Release();
+  }
+
+  void MonotonicArena::Release() {
+    while (chunks_ != nullptr) {
+      Chunk* prev = chunks_->prev;
+      upstream_->deallocate(chunks_, chunks_->size, alignof(std::max_align_t));
+      chunks_ = prev;
+    }
+    current_ = nullptr;
+    end_ = nullptr;
+    bytes_allocated_ = 0;
+  }
+
+  void MonotonicArena::Reset() {
+    if (chunks_ == nullptr) {
+      return;
+    }
+    while (chunks_->prev != nullptr) {
+      Chunk* prev = chunks_->prev;
+      chunks_->prev = prev->prev;
+      upstream_->deallocate(prev, prev->size, alignof(std::max_align_t));
+    }
+    current_ = reinterpret_cast<char*>(chunks_) + sizeof(Chunk);
+    bytes_allocated_ = 0;
+  }
+
+  std::size_t MonotonicArena::bytes_allocated() const {
+    return bytes_allocated_;
+  }
+
+  void* MonotonicArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    auto aligned = [alignment](char* ptr) {
+      const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+      return ptr + ((alignment - address % alignment) % alignment);
+    };
+
+    if ((current_ == nullptr)||(aligned(current_) + bytes > end_)) {
+      // новый блок вмещает заголовок, запрошенный блок с выравниванием и растет геометрически
+      const std::size_t required = sizeof(Chunk) + bytes + alignment;
+      const std::size_t chunk_size = std::max(next_chunk_size_, required);
+
+      auto* chunk = static_cast<Chunk*>(upstream_->allocate(chunk_size, alignof(std::max_align_t)));
+      chunk->prev = chunks_;
+      chunk->size = chunk_size;
+      chunks_ = chunk;
+
+      current_ = reinterpret_cast<char*>(chunk) + sizeof(Chunk);
+      end_ = reinterpret_cast<char*>(chunk) + chunk_size;
+      next_chunk_size_ = chunk_size * 2;
+    }
+
+    char* ptr = aligned(current_);
+    current_ = ptr + bytes;
+    bytes_allocated_ += bytes;
+    return ptr;
+  }
+
+  void MonotonicArena::do_deallocate(void*, std::size_t, std::size_t) {
+    // память высвобождается только целиком (Release)
+  }
+
+  bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+  }
+
+}  // namespace assignment
@@ -1,42 +1,84 @@
 #include "assignment/array_stack.hpp"
 
-#include <algorithm>  // copy, fill
+#include <algorithm>  // copy, fill, max
 #include <stdexcept>  // invalid_argument (НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ)
+#include <utility>    // move, swap
+
+#include "assignment/binary_format.hpp"  // Writer, Reader, Mapping
 
 namespace assignment {
 
-  ArrayStack::ArrayStack(int capacity) {
+  static_assert(ArrayStack::kCapacityGrowthCoefficient == GrowthPolicy::kDefaultIncrement,
+                "default additive growth must match kCapacityGrowthCoefficient");
+
+  ArrayStack::ArrayStack(int capacity) : ArrayStack(capacity, GrowthPolicy::Default()) {}
+
+  ArrayStack::ArrayStack(int capacity, GrowthPolicy growth_policy)
+      : ArrayStack(capacity, std::move(growth_policy), std::pmr::get_default_resource()) {}
+
+  ArrayStack::ArrayStack(int capacity, std::pmr::memory_resource* resource)
+      : ArrayStack(capacity, GrowthPolicy::Default(), resource) {}
+
+  ArrayStack::ArrayStack(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource* resource)
+      : growth_policy_{std::move(growth_policy)}, resource_{resource} {
     if (capacity <= 0) {
       throw std::invalid_argument("capacity is not positive");
     }
+    if (resource == nullptr) {
+      throw std::invalid_argument("memory resource is null");
+    }
     size_ = 0;
     capacity_ = capacity;
-    data_ = new int[capacity_];
+    data_ = Allocate(capacity_);
     std::fill(data_,data_+capacity_,0);
   }
 
+  ArrayStack::ArrayStack(const ArrayStack& other)
+      : Stack(),
+        size_{other.size_},
+        capacity_{other.capacity_},
+        growth_policy_{other.growth_policy_},
+        shrink_policy_{other.shrink_policy_},
+        resource_{other.resource_} {
+    if (other.data_ != nullptr) {
+      data_ = Allocate(capacity_);
+      std::copy(other.data_, other.data_ + capacity_, data_);
+    }
+  }
+
+  ArrayStack::ArrayStack(ArrayStack&& other) noexcept : Stack() {
+    Swap(other);
+  }
+
+  ArrayStack& ArrayStack::operator=(const ArrayStack& other) {
+    if (this != &other) {
+      ArrayStack copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  ArrayStack& ArrayStack::operator=(ArrayStack&& other) noexcept {
+    if (this != &other) {
+      ArrayStack moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
   ArrayStack::~ArrayStack() {
     size_ = 0;
+    Deallocate(data_, capacity_);
     capacity_ = 0;
-    delete[] data_;
     data_ = nullptr;
   }
 
   void ArrayStack::Push(int value) {
     if (size_ == capacity_) {
-      int* new_arr = new int[capacity_+kCapacityGrowthCoefficient];
-      for (int i = 0; i < capacity_; i++) {
-        new_arr[i] = data_[i];
-      }
-      new_arr[size_] = value;
-      capacity_ = capacity_ + kCapacityGrowthCoefficient;
-      size_++;
-      delete[] data_;
-      data_ = new_arr;
-    } else {
-      data_[size_] = value;
-      size_++;
+      Resize(growth_policy_.NextCapacity(capacity_, size_ + 1));
     }
+    data_[size_] = value;
+    size_++;
   }
 
   bool ArrayStack::Pop() {
@@ -44,12 +86,14 @@ namespace assignment {
       return false;
     } else {
       size_--;
+      ShrinkIfNeeded();
       return true;
     }
   }
 
   void ArrayStack::Clear() {
     size_ = 0;
+    ShrinkIfNeeded();
   }
 
   std::optional<int> ArrayStack::Peek() const {
@@ -76,23 +120,139 @@ namespace assignment {
     if (new_capacity <= capacity_) {
       return false;
     }
-    int* new_arr = new int[new_capacity];
-    for (int i = 0; i < capacity_; i++) {
-      new_arr[i] = data_[i];
+    Reallocate(new_capacity);
+    return true;
+  }
+
+  const GrowthPolicy& ArrayStack::growth_policy() const {
+    return growth_policy_;
+  }
+
+  void ArrayStack::set_growth_policy(GrowthPolicy growth_policy) {
+    growth_policy_ = std::move(growth_policy);
+  }
+
+  bool ArrayStack::ShrinkToFit() {
+    const int new_capacity = std::max(size_, 1);
+    if (new_capacity >= capacity_) {
+      return false;
     }
-    capacity_ = new_capacity;
-    delete[] data_;
-    data_ = new_arr;
+    reclaimed_bytes_ += static_cast<std::size_t>(capacity_ - new_capacity) * sizeof(int);
+    Reallocate(new_capacity);
     return true;
   }
 
+  const ShrinkPolicy& ArrayStack::shrink_policy() const {
+    return shrink_policy_;
+  }
+
+  void ArrayStack::set_shrink_policy(ShrinkPolicy shrink_policy) {
+    shrink_policy_ = shrink_policy;
+    ShrinkIfNeeded();
+  }
+
+  std::size_t ArrayStack::reclaimed_bytes() const {
+    return reclaimed_bytes_;
+  }
+
+  std::pmr::memory_resource* ArrayStack::resource() const {
+    return resource_;
+  }
+
+  ArrayStack::const_iterator ArrayStack::begin() const {
+    return data_;
+  }
+
+  ArrayStack::const_iterator ArrayStack::end() const {
+    return data_ + size_;
+  }
+
+  Span<const int> ArrayStack::span() const {
+    return {data_, size_};
+  }
+
+  void ArrayStack::Save(int fd) const {
+    binary::Writer writer(fd, binary::Kind::kArrayStack, size_);
+    writer.Write(data_, size_);
+    writer.Finish();
+  }
+
+  void ArrayStack::Load(int fd) {
+    binary::Reader reader(fd, binary::Kind::kArrayStack);
+    const int count = reader.count();
+
+    // буфер собирается в отдельном стеке, текущий буфер заменяется только после проверки записи
+    ArrayStack loaded(1, growth_policy_, resource_);
+    if (binary::Mapping* mapping = reader.Map(); mapping != nullptr) {
+      loaded.Deallocate(loaded.data_, loaded.capacity_);
+      loaded.mapping_ = mapping;
+      loaded.data_ = mapping->data;
+      loaded.capacity_ = count;
+    } else {
+      if (count > loaded.capacity_) {
+        loaded.Reallocate(count);
+      }
+      reader.Read(loaded.data_, count);
+      reader.Finish();
+    }
+    loaded.size_ = count;
+
+    std::swap(size_, loaded.size_);
+    std::swap(capacity_, loaded.capacity_);
+    std::swap(data_, loaded.data_);
+    std::swap(mapping_, loaded.mapping_);
+  }
+
+  int* ArrayStack::Allocate(int capacity) {
+    return static_cast<int*>(resource_->allocate(static_cast<std::size_t>(capacity) * sizeof(int), alignof(int)));
+  }
+
+  void ArrayStack::Deallocate(int* data, int capacity) {
+    if ((mapping_ != nullptr)&&(data == mapping_->data)) {
+      delete mapping_;
+      mapping_ = nullptr;
+      return;
+    }
+    if (data != nullptr) {
+      resource_->deallocate(data, static_cast<std::size_t>(capacity) * sizeof(int), alignof(int));
+    }
+  }
+
+  void ArrayStack::Reallocate(int new_capacity) {
+    int* new_arr = Allocate(new_capacity);
+    std::copy(data_, data_ + size_, new_arr);
+    Deallocate(data_, capacity_);
+    data_ = new_arr;
+    capacity_ = new_capacity;
+  }
+
+  void ArrayStack::ShrinkIfNeeded() {
+    const int new_capacity = shrink_policy_.ShrinkCapacity(size_, capacity_);
+    if (new_capacity < capacity_) {
+      reclaimed_bytes_ += static_cast<std::size_t>(capacity_ - new_capacity) * sizeof(int);
+      Reallocate(new_capacity);
+    }
+  }
+
+  void ArrayStack::Swap(ArrayStack& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+    std::swap(growth_policy_, other.growth_policy_);
+    std::swap(shrink_policy_, other.shrink_policy_);
+    std::swap(reclaimed_bytes_, other.reclaimed_bytes_);
+    std::swap(resource_, other.resource_);
+    std::swap(mapping_, other.mapping_);
+  }
+
   // ДЛЯ ТЕСТИРОВАНИЯ
   ArrayStack::ArrayStack(const std::vector<int>& values, int capacity) {
 
     size_ = static_cast<int>(values.size());
     capacity_ = capacity;
 
-    data_ = new int[capacity]{};
+    data_ = Allocate(capacity);
+    std::fill(data_, data_ + capacity, 0);
 
     std::copy(values.data(), values.data() + size_, data_);
   }
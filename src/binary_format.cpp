@@ -0,0 +1,312 @@
+#include "assignment/binary_format.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // read, write, lseek, sysconf
+#else
+#include <io.h>  // _read, _write
+#endif
+
+#include <cerrno>        // errno, EINTR
+#include <climits>       // INT_MAX
+#include <cstring>       // memcpy
+#include <new>           // placement new
+#include <stdexcept>     // logic_error, runtime_error
+#include <system_error>  // system_error, generic_category
+
+namespace assignment::binary {
+
+  namespace {
+
+    // простые числа XXH64 (перемешивание битов)
+    constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+
+    // максимальный размер одного системного вызова чтения/записи (ограничение Linux - 2 ГБ без страницы)
+    constexpr std::size_t kMaxIoBytes = std::size_t{1} << 30;
+
+    constexpr std::uint64_t RotateLeft(std::uint64_t value, int bits) {
+      return (value << bits) | (value >> (64 - bits));
+    }
+
+    constexpr std::uint64_t Round(std::uint64_t acc, std::uint64_t word) {
+      return RotateLeft(acc + word * kPrime2, 31) * kPrime1;
+    }
+
+    [[noreturn]] void ThrowSystemError(const char* what) {
+      throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    // запись ровно bytes байт (с повтором при частичной записи и прерывании сигналом)
+    void WriteAll(int fd, const void* data, std::size_t bytes) {
+      const char* begin = static_cast<const char*>(data);
+      while (bytes > 0) {
+        const std::size_t part = bytes < kMaxIoBytes ? bytes : kMaxIoBytes;
+#if defined(__unix__) || defined(__APPLE__)
+        const ssize_t written = ::write(fd, begin, part);
+#else
+        const int written = ::_write(fd, begin, static_cast<unsigned>(part));
+#endif
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          ThrowSystemError("write");
+        }
+        begin += written;
+        bytes -= static_cast<std::size_t>(written);
+      }
+    }
+
+    // чтение ровно bytes байт (с повтором при частичном чтении и прерывании сигналом)
+    void ReadAll(int fd, void* data, std::size_t bytes) {
+      char* begin = static_cast<char*>(data);
+      while (bytes > 0) {
+        const std::size_t part = bytes < kMaxIoBytes ? bytes : kMaxIoBytes;
+#if defined(__unix__) || defined(__APPLE__)
+        const ssize_t received = ::read(fd, begin, part);
+#else
+        const int received = ::_read(fd, begin, static_cast<unsigned>(part));
+#endif
+        if (received < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          ThrowSystemError("read");
+        }
+        if (received == 0) {
+          throw std::runtime_error("unexpected end of binary record");
+        }
+        begin += received;
+        bytes -= static_cast<std::size_t>(received);
+      }
+    }
+
+    std::size_t PayloadBytes(std::int64_t count) {
+      return static_cast<std::size_t>(count) * sizeof(int);
+    }
+
+  }  // namespace
+
+  Checksum::Checksum()
+      : lanes_{kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1}, tail_{kPrime4} {}
+
+  void Checksum::Update(const int* values, std::int64_t count) {
+    std::uint64_t lane0 = lanes_[0];
+    std::uint64_t lane1 = lanes_[1];
+    std::uint64_t lane2 = lanes_[2];
+    std::uint64_t lane3 = lanes_[3];
+
+    std::int64_t index = 0;
+    for (; index + kChecksumBlock <= count; index += kChecksumBlock) {
+      std::uint64_t words[4];
+      std::memcpy(words, values + index, sizeof(words));
+      lane0 = Round(lane0, words[0]);
+      lane1 = Round(lane1, words[1]);
+      lane2 = Round(lane2, words[2]);
+      lane3 = Round(lane3, words[3]);
+    }
+
+    lanes_[0] = lane0;
+    lanes_[1] = lane1;
+    lanes_[2] = lane2;
+    lanes_[3] = lane3;
+
+    // значения неполного блока (только в последней части)
+    const int* tail = values + index;
+    const int tail_size = static_cast<int>(count - index);
+    for (int i = 0; i < tail_size; i++) {
+      tail_ ^= static_cast<std::uint64_t>(static_cast<std::uint32_t>(tail[i])) * kPrime1;
+      tail_ = RotateLeft(tail_, 23) * kPrime2 + kPrime3;
+    }
+    count_ += count;
+  }
+
+  std::uint64_t Checksum::Digest() const {
+    std::uint64_t hash = RotateLeft(lanes_[0], 1) + RotateLeft(lanes_[1], 7) +
+                         RotateLeft(lanes_[2], 12) + RotateLeft(lanes_[3], 18);
+    hash ^= tail_;
+    hash += static_cast<std::uint64_t>(count_) * sizeof(int);
+
+    // финальное перемешивание
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    hash *= kPrime3;
+    hash ^= hash >> 32;
+    return hash;
+  }
+
+  Mapping::~Mapping() {
+#if defined(__unix__) || defined(__APPLE__)
+    if (base != nullptr) {
+      ::munmap(base, length);
+    }
+#endif
+  }
+
+  Writer::Writer(int fd, Kind kind, std::int64_t count) : fd_{fd}, remaining_{count} {
+    const Header header{kMagic, kVersion, static_cast<std::uint16_t>(kind), sizeof(int), 0, count, 0};
+    WriteAll(fd_, &header, sizeof(header));
+  }
+
+  void Writer::Write(const int* values, std::int64_t count) {
+    if (count > remaining_) {
+      throw std::logic_error("more values than declared in the header");
+    }
+    WriteAll(fd_, values, PayloadBytes(count));
+    checksum_.Update(values, count);
+    remaining_ -= count;
+  }
+
+  void Writer::Finish() {
+    if (remaining_ != 0) {
+      throw std::logic_error("fewer values than declared in the header");
+    }
+    const std::uint64_t digest = checksum_.Digest();
+    WriteAll(fd_, &digest, sizeof(digest));
+  }
+
+  Reader::Reader(int fd, Kind kind) : fd_{fd} {
+    Header header{};
+    ReadAll(fd_, &header, sizeof(header));
+
+    if ((header.magic != kMagic)||(header.version != kVersion)) {
+      throw std::runtime_error("unknown binary format or version");
+    }
+    if (header.element_size != sizeof(int)) {
+      throw std::runtime_error("binary record has a different element size");
+    }
+    if (header.kind != static_cast<std::uint16_t>(kind)) {
+      throw std::runtime_error("binary record holds a different container kind");
+    }
+    if ((header.count < 0)||(header.count > INT_MAX)) {
+      throw std::runtime_error("corrupted binary record header");
+    }
+    count_ = static_cast<int>(header.count);
+    remaining_ = header.count;
+  }
+
+  int Reader::count() const {
+    return count_;
+  }
+
+  Mapping* Reader::Map() {
+#if defined(__unix__) || defined(__APPLE__)
+    if ((count_ == 0)||(remaining_ != count_)) {
+      return nullptr;
+    }
+
+    const off_t offset = ::lseek(fd_, 0, SEEK_CUR);
+    struct stat file_stat {};
+    if ((offset < 0)||(::fstat(fd_, &file_stat) != 0)||(!S_ISREG(file_stat.st_mode))) {
+      return nullptr;  // канал, сокет или устройство
+    }
+    if (offset % static_cast<off_t>(alignof(int)) != 0) {
+      return nullptr;  // запись после префикса нечетной длины: значения не выровнены для int
+    }
+
+    const std::size_t payload = PayloadBytes(count_);
+    const off_t record_end = offset + static_cast<off_t>(payload + sizeof(std::uint64_t));
+    if (file_stat.st_size < record_end) {
+      // обращение к странице за концом файла привело бы к SIGBUS
+      throw std::runtime_error("unexpected end of binary record");
+    }
+
+    // смещение отображения должно быть кратно размеру страницы
+    const long page = ::sysconf(_SC_PAGESIZE);
+    const off_t aligned = offset - offset % page;
+    const std::size_t delta = static_cast<std::size_t>(offset - aligned);
+    const std::size_t length = delta + payload + sizeof(std::uint64_t);
+
+    void* base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd_, aligned);
+    if (base == MAP_FAILED) {
+      return nullptr;  // файловая система без поддержки mmap
+    }
+
+    auto* mapping = new Mapping;
+    mapping->base = base;
+    mapping->length = length;
+    mapping->data = reinterpret_cast<int*>(static_cast<char*>(base) + delta);
+
+    checksum_.Update(mapping->data, count_);
+    std::uint64_t stored = 0;
+    std::memcpy(&stored, mapping->data + count_, sizeof(stored));
+    if (stored != checksum_.Digest()) {
+      delete mapping;
+      throw std::runtime_error("binary record checksum mismatch");
+    }
+
+    if (::lseek(fd_, record_end, SEEK_SET) < 0) {
+      delete mapping;
+      ThrowSystemError("lseek");
+    }
+    remaining_ = 0;
+    return mapping;
+#else
+    return nullptr;
+#endif
+  }
+
+  void Reader::Read(int* out, std::int64_t count) {
+    if (count > remaining_) {
+      throw std::logic_error("more values requested than stored in the record");
+    }
+    ReadAll(fd_, out, PayloadBytes(count));
+    checksum_.Update(out, count);
+    remaining_ -= count;
+  }
+
+  void Reader::Finish() {
+    if (remaining_ != 0) {
+      throw std::logic_error("not all values of the record were read");
+    }
+    std::uint64_t stored = 0;
+    ReadAll(fd_, &stored, sizeof(stored));
+    if (stored != checksum_.Digest()) {
+      throw std::runtime_error("binary record checksum mismatch");
+    }
+  }
+
+  void SaveNodes(int fd, Kind kind, const Node* front, int count) {
+    Writer writer(fd, kind, count);
+    int chunk[kChunkSize];
+    int filled = 0;
+    const Node* node = front;
+    for (int i = 0; i < count; i++) {
+      chunk[filled++] = node->value;
+      node = node->next;
+      if (filled == kChunkSize) {
+        writer.Write(chunk, filled);
+        filled = 0;
+      }
+    }
+    writer.Write(chunk, filled);
+    writer.Finish();
+  }
+
+  Node* LoadNodes(Reader& reader, NodePool<Node>& pool) {
+    const int count = reader.count();
+    if (count == 0) {
+      reader.Finish();
+      return nullptr;
+    }
+
+    Node* block = pool.NewBlock(count);
+    int chunk[kChunkSize];
+    for (int begin = 0; begin < count; begin += kChunkSize) {
+      const int part = count - begin < kChunkSize ? count - begin : kChunkSize;
+      reader.Read(chunk, part);
+      for (int i = 0; i < part; i++) {
+        const int index = begin + i;
+        new (block + index) Node(chunk[i], index + 1 < count ? block + index + 1 : nullptr);
+      }
+    }
+    reader.Finish();
+    return block;
+  }
+
+}  // namespace assignment::binary
@@ -0,0 +1,192 @@
+#include "assignment/compressed_array.hpp"
+
+#include <algorithm>  // copy, max, min, minmax_element
+#include <cstdint>    // uint32_t
+
+#include "assignment/simd.hpp"  // Pack, Unpack, UnpackAt, CountPacked, FindFirst, Count
+
+namespace assignment {
+
+  namespace {
+
+    // кол-во бит, необходимое для записи значения
+    int BitWidth(std::uint32_t value) {
+      int bits = 0;
+      while (value != 0) {
+        bits++;
+        value >>= 1;
+      }
+      return bits;
+    }
+
+  }  // namespace
+
+  CompressedArray::CompressedArray()
+      : blocks_(BasicDynamicArray<Block>::kInitCapacity, GrowthPolicy::Geometric2()),
+        words_(BasicDynamicArray<std::uint32_t>::kInitCapacity, GrowthPolicy::Geometric2()) {}
+
+  void CompressedArray::Add(int value) {
+    tail_[size_ - sealed_size()] = value;
+    size_++;
+    if (size_ - sealed_size() == kBlockSize) {
+      SealTail();
+    }
+  }
+
+  bool CompressedArray::AddRange(const int* values, int count) {
+    if ((count < 0)||((values == nullptr)&&(count > 0))) {
+      return false;
+    }
+    while (count > 0) {
+      const int tail_size = size_ - sealed_size();
+      const int part = std::min(count, kBlockSize - tail_size);
+      std::copy(values, values + part, tail_ + tail_size);
+      size_ += part;
+      values += part;
+      count -= part;
+      if (tail_size + part == kBlockSize) {
+        SealTail();
+      }
+    }
+    return true;
+  }
+
+  void CompressedArray::Clear() {
+    size_ = 0;
+    blocks_.Clear();
+    words_.Clear();
+  }
+
+  void CompressedArray::ShrinkToFit() {
+    auto words = BasicDynamicArray<std::uint32_t>(std::max(words_.size(), 1), GrowthPolicy::Geometric2());
+    for (std::uint32_t word : words_) {
+      words.Add(word);
+    }
+    auto blocks = BasicDynamicArray<Block>(std::max(blocks_.size(), 1), GrowthPolicy::Geometric2());
+    for (const Block& block : blocks_) {
+      blocks.Add(block);
+    }
+    words_.Swap(words);
+    blocks_.Swap(blocks);
+  }
+
+  std::optional<int> CompressedArray::Get(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    if (index >= sealed_size()) {
+      return tail_[index - sealed_size()];
+    }
+    const Block& block = blocks_[index / kBlockSize];
+    return simd::UnpackAt(words_.data() + block.offset, block.bits, block.reference, index % kBlockSize);
+  }
+
+  bool CompressedArray::Decode(int index, int count, int* out) const {
+    if ((index < 0)||(count < 0)||(count > size_ - index)) {
+      return false;
+    }
+    int buffer[kBlockSize];
+    const int end = index + count;
+    while ((index < end)&&(index < sealed_size())) {
+      const Block& block = blocks_[index / kBlockSize];
+      const int begin = index % kBlockSize;
+      const int part = std::min(end - index, kBlockSize - begin);
+      if (part == kBlockSize) {
+        simd::Unpack(words_.data() + block.offset, block.bits, block.reference, out);
+      } else {
+        simd::Unpack(words_.data() + block.offset, block.bits, block.reference, buffer);
+        std::copy(buffer + begin, buffer + begin + part, out);
+      }
+      index += part;
+      out += part;
+    }
+    if (index < end) {
+      std::copy(tail_ + (index - sealed_size()), tail_ + (end - sealed_size()), out);
+    }
+    return true;
+  }
+
+  std::optional<int> CompressedArray::IndexOf(int value) const {
+    int buffer[kBlockSize];
+    for (int i = 0; i < blocks_.size(); i++) {
+      const Block& block = blocks_[i];
+      if (!MayContain(block, value)) {
+        continue;
+      }
+      // подсчет без распаковки отсекает блоки, в диапазон которых значение попало, но которые его не содержат
+      const std::uint32_t* packed = words_.data() + block.offset;
+      if (simd::CountPacked(packed, block.bits, block.reference, value) == 0) {
+        continue;
+      }
+      simd::Unpack(packed, block.bits, block.reference, buffer);
+      return i * kBlockSize + simd::FindFirst(buffer, kBlockSize, value);
+    }
+    const int found = simd::FindFirst(tail_, size_ - sealed_size(), value);
+    if (found >= 0) {
+      return sealed_size() + found;
+    }
+    return std::nullopt;
+  }
+
+  bool CompressedArray::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  int CompressedArray::Count(int value) const {
+    int count = 0;
+    for (int i = 0; i < blocks_.size(); i++) {
+      const Block& block = blocks_[i];
+      if (MayContain(block, value)) {
+        count += simd::CountPacked(words_.data() + block.offset, block.bits, block.reference, value);
+      }
+    }
+    return count + simd::Count(tail_, size_ - sealed_size(), value);
+  }
+
+  bool CompressedArray::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int CompressedArray::size() const {
+    return size_;
+  }
+
+  std::size_t CompressedArray::memory_usage() const {
+    return static_cast<std::size_t>(words_.capacity()) * sizeof(std::uint32_t) +
+           static_cast<std::size_t>(blocks_.capacity()) * sizeof(Block) + sizeof(tail_);
+  }
+
+  void CompressedArray::SealTail() {
+    const auto [min, max] = std::minmax_element(tail_, tail_ + kBlockSize);
+    const int bits = BitWidth(static_cast<std::uint32_t>(*max) - static_cast<std::uint32_t>(*min));
+    const int offset = words_.size();
+
+    // kBlockSize значений по bits бит
+    const int words = kBlockSize / 32 * bits;
+    for (int i = 0; i < words; i++) {
+      words_.Add(0);
+    }
+    simd::Pack(tail_, bits, *min, words_.data() + offset);
+    blocks_.Add(Block{*min, *max, bits, offset});
+  }
+
+  bool CompressedArray::MayContain(const Block& block, int value) {
+    return (value >= block.reference)&&(value <= block.maximum);
+  }
+
+  int CompressedArray::sealed_size() const {
+    return blocks_.size() * kBlockSize;
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  CompressedArray::CompressedArray(const std::vector<int>& values) : CompressedArray() {
+    AddRange(values.data(), static_cast<int>(values.size()));
+  }
+
+  std::vector<int> CompressedArray::toVector() const {
+    std::vector<int> values(static_cast<std::size_t>(size_));
+    Decode(0, size_, values.data());
+    return values;
+  }
+
+}  // namespace assignment
@@ -0,0 +1,250 @@
+#include "assignment/doubly_linked_list.hpp"
+
+#include <new>      // placement new
+#include <utility>  // move, swap
+
+namespace assignment {
+
+  DoublyLinkedList::DoublyLinkedList(std::pmr::memory_resource* resource) : pool_{resource} {}
+
+  DoublyLinkedList::DoublyLinkedList(const DoublyLinkedList& other) : List(), pool_{other.pool_.resource()} {
+    if (other.size_ == 0) {
+      return;
+    }
+    DoubleNode* block = pool_.NewBlock(other.size_);
+    const DoubleNode* source = other.front_;
+    for (int i = 0; i < other.size_; i++) {
+      new (block + i) DoubleNode(source->value, i > 0 ? block + i - 1 : nullptr,
+                                 i + 1 < other.size_ ? block + i + 1 : nullptr);
+      source = source->next;
+    }
+    size_ = other.size_;
+    front_ = block;
+    back_ = block + size_ - 1;
+  }
+
+  DoublyLinkedList& DoublyLinkedList::operator=(const DoublyLinkedList& other) {
+    if (this != &other) {
+      DoublyLinkedList copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  DoublyLinkedList::DoublyLinkedList(DoublyLinkedList&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  DoublyLinkedList& DoublyLinkedList::operator=(DoublyLinkedList&& other) noexcept {
+    if (this != &other) {
+      DoublyLinkedList moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  DoublyLinkedList::~DoublyLinkedList() {
+    // узлы высвобождаются вместе с пулом
+    size_ = 0;
+    front_ = nullptr;
+    back_ = nullptr;
+  }
+
+  void DoublyLinkedList::Add(int value) {
+    InsertBefore(nullptr, value);
+  }
+
+  void DoublyLinkedList::AddFront(int value) {
+    InsertBefore(front_, value);
+  }
+
+  bool DoublyLinkedList::Insert(int index, int value) {
+    if ((index < 0)||(index > size_)) {
+      return false;
+    }
+    // узел с индексом index становится следующим за вставленным (nullptr - вставка в конец)
+    InsertBefore(index == size_ ? nullptr : FindNode(index), value);
+    return true;
+  }
+
+  bool DoublyLinkedList::Set(int index, int new_value) {
+    DoubleNode* node = FindNode(index);
+    if (node == nullptr) {
+      return false;
+    }
+    node->value = new_value;
+    return true;
+  }
+
+  std::optional<int> DoublyLinkedList::Remove(int index) {
+    DoubleNode* node = FindNode(index);
+    if (node == nullptr) {
+      return std::nullopt;
+    }
+    return RemoveNode(node);
+  }
+
+  std::optional<int> DoublyLinkedList::RemoveFront() {
+    if (front_ == nullptr) {
+      return std::nullopt;
+    }
+    return RemoveNode(front_);
+  }
+
+  std::optional<int> DoublyLinkedList::RemoveBack() {
+    if (back_ == nullptr) {
+      return std::nullopt;
+    }
+    return RemoveNode(back_);
+  }
+
+  int DoublyLinkedList::RemoveNode(DoubleNode* node) {
+    Unlink(node);
+    const int removed = node->value;
+    pool_.Delete(node);
+    size_--;
+    return removed;
+  }
+
+  void DoublyLinkedList::MoveToFront(DoubleNode* node) {
+    if (node == front_) {
+      return;
+    }
+    Unlink(node);
+    node->prev = nullptr;
+    node->next = front_;
+    front_->prev = node;
+    front_ = node;
+  }
+
+  void DoublyLinkedList::Clear() {
+    size_ = 0;
+    front_ = nullptr;
+    back_ = nullptr;
+    pool_.Reset();
+  }
+
+  std::optional<int> DoublyLinkedList::Get(int index) const {
+    const DoubleNode* node = FindNode(index);
+    if (node == nullptr) {
+      return std::nullopt;
+    }
+    return node->value;
+  }
+
+  std::optional<int> DoublyLinkedList::IndexOf(int value) const {
+    int index = 0;
+    for (const DoubleNode* node = front_; node != nullptr; node = node->next) {
+      if (node->value == value) {
+        return index;
+      }
+      index++;
+    }
+    return std::nullopt;
+  }
+
+  bool DoublyLinkedList::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool DoublyLinkedList::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int DoublyLinkedList::size() const {
+    return size_;
+  }
+
+  const NodePool<DoubleNode>& DoublyLinkedList::pool() const {
+    return pool_;
+  }
+
+  std::optional<int> DoublyLinkedList::front() const {
+    if (front_ == nullptr) {
+      return std::nullopt;
+    }
+    return front_->value;
+  }
+
+  std::optional<int> DoublyLinkedList::back() const {
+    if (back_ == nullptr) {
+      return std::nullopt;
+    }
+    return back_->value;
+  }
+
+  DoubleNode* DoublyLinkedList::front_node() const {
+    return front_;
+  }
+
+  DoubleNode* DoublyLinkedList::back_node() const {
+    return back_;
+  }
+
+  DoubleNode* DoublyLinkedList::FindNode(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return nullptr;
+    }
+    // проход от ближайшего конца списка
+    DoubleNode* node = nullptr;
+    if (index < size_ / 2) {
+      node = front_;
+      for (int i = 0; i < index; i++) {
+        node = node->next;
+      }
+    } else {
+      node = back_;
+      for (int i = size_ - 1; i > index; i--) {
+        node = node->prev;
+      }
+    }
+    return node;
+  }
+
+  void DoublyLinkedList::InsertBefore(DoubleNode* next, int value) {
+    DoubleNode* prev = next == nullptr ? back_ : next->prev;
+    DoubleNode* node = pool_.New(value, prev, next);
+    if (prev == nullptr) {
+      front_ = node;
+    } else {
+      prev->next = node;
+    }
+    if (next == nullptr) {
+      back_ = node;
+    } else {
+      next->prev = node;
+    }
+    size_++;
+  }
+
+  void DoublyLinkedList::Unlink(DoubleNode* node) {
+    if (node->prev == nullptr) {
+      front_ = node->next;
+    } else {
+      node->prev->next = node->next;
+    }
+    if (node->next == nullptr) {
+      back_ = node->prev;
+    } else {
+      node->next->prev = node->prev;
+    }
+  }
+
+  void DoublyLinkedList::Swap(DoublyLinkedList& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(front_, other.front_);
+    std::swap(back_, other.back_);
+    pool_.Swap(other.pool_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> DoublyLinkedList::toVector() const {
+    std::vector<int> values;
+    values.reserve(static_cast<std::size_t>(size_));
+    for (const DoubleNode* node = front_; node != nullptr; node = node->next) {
+      values.push_back(node->value);
+    }
+    return values;
+  }
+
+}  // namespace assignment
@@ -1,81 +1,270 @@
 #include "assignment/dynamic_array.hpp"
 
-#include <algorithm>  // copy, fill
-#include <stdexcept>  // invalid_argument (НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ)
+#include <algorithm>   // copy, fill, max
+#include <cstring>     // memmove
+#include <functional>  // less, less_equal
+#include <memory>      // unique_ptr
+#include <new>         // placement new
+#include <stdexcept>   // invalid_argument (НЕЛЬЗЯ ИСПОЛЬЗОВАТЬ)
+#include <utility>     // move, swap
+
+#include "assignment/binary_format.hpp"  // Writer, Reader, Mapping
+#include "assignment/hash_index.hpp"     // HashIndex
+#include "assignment/parallel_scan.hpp"  // FindFirst, Count
+#include "assignment/simd.hpp"           // FindFirst, Count, Gather
 
 namespace assignment {
-  DynamicArray::DynamicArray(int capacity) {
+
+  namespace {
+
+    // указатель ptr находится внутри блока памяти [begin, end)
+    bool PointsInto(const int* ptr, const int* begin, const int* end) {
+      return std::less_equal<const int*>{}(begin, ptr) && std::less<const int*>{}(ptr, end);
+    }
+
+    // все индексы находятся в пределах [0, size) (проверка без ветвлений, векторизуется)
+    bool IndicesInRange(const int* indices, int count, int size) {
+      bool out_of_range = false;
+      for (int i = 0; i < count; i++) {
+        out_of_range |= static_cast<unsigned>(indices[i]) >= static_cast<unsigned>(size);
+      }
+      return !out_of_range;
+    }
+
+    // на сколько индексов вперед запрашивается предвыборка ячеек при изменении по индексам
+    constexpr int kScatterPrefetchDistance = 16;
+
+    inline void PrefetchForWrite([[maybe_unused]] int* address) {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(address, 1);
+#endif
+    }
+
+  }  // namespace
+
+  static_assert(DynamicArray::kCapacityGrowthCoefficient == GrowthPolicy::kDefaultIncrement,
+                "default additive growth must match kCapacityGrowthCoefficient");
+
+  DynamicArray::DynamicArray(int capacity) : DynamicArray(capacity, GrowthPolicy::Default()) {}
+
+  DynamicArray::DynamicArray(int capacity, GrowthPolicy growth_policy)
+      : DynamicArray(capacity, std::move(growth_policy), std::pmr::get_default_resource()) {}
+
+  DynamicArray::DynamicArray(int capacity, std::pmr::memory_resource* resource)
+      : DynamicArray(capacity, GrowthPolicy::Default(), resource) {}
+
+  DynamicArray::DynamicArray(int capacity, GrowthPolicy growth_policy, std::pmr::memory_resource* resource)
+      : growth_policy_{std::move(growth_policy)}, resource_{resource} {
     if (capacity <= 0) {
       throw std::invalid_argument("capacity is not positive");
     }
+    if (resource == nullptr) {
+      throw std::invalid_argument("memory resource is null");
+    }
     size_ = 0;
     capacity_ = capacity;
-    data_ = new int[capacity_];
+    data_ = Allocate(capacity_);
     std::fill(data_,data_+capacity_,0);
 
   }
 
+  DynamicArray::DynamicArray(const DynamicArray& other)
+      : List(),
+        size_{other.size_},
+        capacity_{other.capacity_},
+        growth_policy_{other.growth_policy_},
+        shrink_policy_{other.shrink_policy_},
+        resource_{other.resource_},
+        thread_pool_{other.thread_pool_},
+        parallel_min_size_{other.parallel_min_size_} {
+    if (other.data_ != nullptr) {
+      data_ = Allocate(capacity_);
+      std::copy(other.data_, other.data_ + capacity_, data_);
+    }
+    if (other.hash_index_ != nullptr) {
+      hash_index_ = new HashIndex(*other.hash_index_);
+    }
+  }
+
+  DynamicArray::DynamicArray(const DynamicArray& other, SnapshotTag)
+      : List(),
+        size_{other.size_},
+        capacity_{other.capacity_},
+        data_{other.data_},
+        growth_policy_{other.growth_policy_},
+        shrink_policy_{other.shrink_policy_},
+        resource_{other.resource_},
+        shared_refs_{other.shared_refs_.load(std::memory_order_acquire)},
+        mapping_{other.mapping_},
+        thread_pool_{other.thread_pool_},
+        parallel_min_size_{other.parallel_min_size_} {}
+
+  DynamicArray::DynamicArray(DynamicArray&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  DynamicArray& DynamicArray::operator=(const DynamicArray& other) {
+    if (this != &other) {
+      DynamicArray copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  DynamicArray& DynamicArray::operator=(DynamicArray&& other) noexcept {
+    if (this != &other) {
+      DynamicArray moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
   DynamicArray::~DynamicArray() {
     size_ = 0;
+    ReleaseBuffer();
     capacity_ = 0;
-
-    delete[] data_;
     data_ = nullptr;
+    delete hash_index_;
+  }
+
+  DynamicArray DynamicArray::Snapshot() const {
+    std::atomic<int>* refs = shared_refs_.load(std::memory_order_acquire);
+    if (refs == nullptr) {
+      // снимки могут создаваться из нескольких потоков: устанавливается только один счетчик
+      void* memory = resource_->allocate(sizeof(std::atomic<int>), alignof(std::atomic<int>));
+      auto* created = new (memory) std::atomic<int>(1);
+      if (shared_refs_.compare_exchange_strong(refs, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        refs = created;
+      } else {
+        created->~atomic();
+        resource_->deallocate(created, sizeof(std::atomic<int>), alignof(std::atomic<int>));
+      }
+    }
+    refs->fetch_add(1, std::memory_order_relaxed);
+
+    return DynamicArray(*this, SnapshotTag{});
+  }
+
+  bool DynamicArray::IsShared() const {
+    const std::atomic<int>* refs = shared_refs_.load(std::memory_order_acquire);
+    return (refs != nullptr)&&(refs->load(std::memory_order_acquire) > 1);
   }
 
   void DynamicArray::Add(int value) {
     if (size_ == capacity_) {
-      int* new_data = new int[capacity_ + kCapacityGrowthCoefficient];
-      for (int i = 0; i < size_; i++) {
-        new_data[i] = data_[i];
-      }
-      new_data[size_] = value;
-      delete[] data_;
-      data_ = new_data;
-      size_++;
-      capacity_ = capacity_ + kCapacityGrowthCoefficient;
-    } else {
-      data_[size_] = value;
-      size_++;
+      Resize(growth_policy_.NextCapacity(capacity_, size_ + 1));
     }
+    MakeUnique();
+    data_[size_] = value;
+    size_++;
+    IndexInserted(size_ - 1, 1);
   }
 
   bool DynamicArray::Insert(int index, int value) {
     if ((index < 0)||(index > size_)) {
       return false;
     }
-    if ((size_ == 0)||(index == size_)||((size_ == 1)&&(index == 1))) {
-      Add(value);
-      return true;
+    *OpenGap(index, 1) = value;
+    IndexInserted(index, 1);
+    return true;
+  }
+
+  bool DynamicArray::AddRange(const int* values, int count) {
+    return InsertRange(size_, values, count);
+  }
+
+  bool DynamicArray::InsertRange(int index, const int* values, int count) {
+    if ((index < 0)||(index > size_)||(count < 0)||((values == nullptr)&&(count > 0))) {
+      return false;
     }
-    if ((size_ == 1)&&(index == 0)) {
-      Add(data_[0]);
-      data_[0] = value;
+    if (count == 0) {
       return true;
     }
-    if (size_ == capacity_) {
-      int* new_array = new int[capacity_+kCapacityGrowthCoefficient];
-      for (int i = 0; i <= size_; i++) {
-        if (i < index) {
-          new_array[i] = data_[i];
+
+    // последовательность внутри буфера массива будет перемещена при сдвиге/расширении - копируем заранее
+    std::unique_ptr<int[]> aliased;
+    if (PointsInto(values, data_, data_ + capacity_)) {
+      aliased.reset(new int[static_cast<std::size_t>(count)]);
+      std::copy(values, values + count, aliased.get());
+      values = aliased.get();
+    }
+
+    std::copy(values, values + count, OpenGap(index, count));
+    IndexInserted(index, count);
+    return true;
+  }
+
+  bool DynamicArray::RemoveRange(int index, int count) {
+    if ((index < 0)||(count < 0)||(index > size_ - count)) {
+      return false;
+    }
+    MakeUnique();
+    const int removed = count == 1 ? data_[index] : 0;
+    const int tail = size_ - index - count;
+    std::memmove(data_ + index, data_ + index + count, static_cast<std::size_t>(tail) * sizeof(int));
+    size_ -= count;
+
+    if ((hash_index_ != nullptr)&&(count > 0)) {
+      if ((count > 1)||(hash_index_->stale())) {
+        RebuildHashIndex();
+      } else {
+        // удален элемент с первым вхождением значения - первым становится следующее вхождение
+        const bool was_first = hash_index_->Find(removed) == index;
+        if (was_first) {
+          hash_index_->Erase(removed);
         }
-        if (i == index) {
-          new_array[i] = value;
+        if (tail > 0) {
+          hash_index_->Shift(index + 1, -1);
         }
-        if (i > index) {
-          new_array[i] = data_[i-1];
+        if (was_first) {
+          const int next = simd::FindFirst(data_ + index, tail, removed);
+          if (next >= 0) {
+            hash_index_->Assign(removed, index + next);
+          }
         }
       }
-      size_++;
-      capacity_ = capacity_+kCapacityGrowthCoefficient;
-      data_ = new_array;
+    }
+
+    ShrinkIfNeeded();
+    return true;
+  }
+
+  bool DynamicArray::Assign(const int* values, int count) {
+    if ((count < 0)||((values == nullptr)&&(count > 0))) {
+      return false;
+    }
+    // при копировании разделяемого буфера последовательность остается в старом буфере (его держат снимки)
+    MakeUnique();
+    if (PointsInto(values, data_, data_ + capacity_)) {
+      // последовательность внутри буфера не превышает емкости - расширение не потребуется
+      std::memmove(data_, values, static_cast<std::size_t>(count) * sizeof(int));
+      size_ = count;
+      RebuildHashIndex();
       return true;
     }
-    for (int i = size_; i > index; i--) {
-      data_[i] = data_[i-1];
+    size_ = 0;
+    std::copy(values, values + count, OpenGap(0, count));
+    RebuildHashIndex();
+    return true;
+  }
+
+  bool DynamicArray::Assign(int count, int value) {
+    if (count < 0) {
+      return false;
     }
-    data_[index] = value;
-    size_++;
+    size_ = 0;
+    std::fill_n(OpenGap(0, count), count, value);
+    RebuildHashIndex();
+    return true;
+  }
+
+  bool DynamicArray::Fill(int index, int count, int value) {
+    if ((index < 0)||(count < 0)||(index > size_ - count)) {
+      return false;
+    }
+    MakeUnique();
+    std::fill_n(data_ + index, count, value);
+    InvalidateHashIndex();
     return true;
   }
 
@@ -83,9 +272,42 @@ namespace assignment {
     if ((size_ == 0)||(index >= size_)||(index < 0)) {
       return false;
     }
+    MakeUnique();
+    const int old_value = data_[index];
     data_[index] = new_value;
+
+    if ((hash_index_ != nullptr)&&(hash_index_->stale())) {
+      RebuildHashIndex();
+    } else if ((hash_index_ != nullptr)&&(old_value != new_value)) {
+      // перезаписано первое вхождение прежнего значения - первым становится следующее вхождение
+      if (hash_index_->Find(old_value) == index) {
+        hash_index_->Erase(old_value);
+        const int next = simd::FindFirst(data_ + index + 1, size_ - index - 1, old_value);
+        if (next >= 0) {
+          hash_index_->Assign(old_value, index + 1 + next);
+        }
+      }
+      hash_index_->Add(new_value, index);
+    }
     return true;
+  }
 
+  bool DynamicArray::SetMany(const int* indices, const int* values, int count) {
+    if ((count < 0)||((count > 0)&&((indices == nullptr)||(values == nullptr)))) {
+      return false;
+    }
+    if (!IndicesInRange(indices, count, size_)) {
+      return false;
+    }
+    MakeUnique();
+    for (int i = 0; i < count; i++) {
+      if (i + kScatterPrefetchDistance < count) {
+        PrefetchForWrite(data_ + indices[i + kScatterPrefetchDistance]);
+      }
+      data_[indices[i]] = values[i];
+    }
+    InvalidateHashIndex();
+    return true;
   }
 
   std::optional<int> DynamicArray::Remove(int index) {
@@ -93,20 +315,16 @@ namespace assignment {
       return std::nullopt;
     }
     int deleted_element = data_[index];
-    if ((size_ == 1)||(index == size_-1)) {
-      data_[index] = 0;
-      size_--;
-      return deleted_element;
-    }
-    for (int i = index; i < size_-1; i++) {
-      data_[i] = data_[i+1];
-    }
-    size_--;
+    RemoveRange(index, 1);
     return deleted_element;
   }
 
   void DynamicArray::Clear() {
     size_ = 0;
+    if (hash_index_ != nullptr) {
+      hash_index_->Clear();
+    }
+    ShrinkIfNeeded();
   }
 
   std::optional<int> DynamicArray::Get(int index) const {
@@ -119,22 +337,34 @@ namespace assignment {
     }
   }
 
+  bool DynamicArray::GetMany(const int* indices, int count, int* out) const {
+    if ((count < 0)||((count > 0)&&((indices == nullptr)||(out == nullptr)))) {
+      return false;
+    }
+    if (!IndicesInRange(indices, count, size_)) {
+      return false;
+    }
+    simd::Gather(data_, indices, count, out);
+    return true;
+  }
+
   std::optional<int> DynamicArray::IndexOf(int value) const {
-    for (int i = 0; i < size_; i++) {
-      if (data_[i] == value) {
-        return i;
-      }
+    const int index = FindFirst(value);
+    if (index < 0) {
+      return std::nullopt;
     }
-    return std::nullopt;
+    return index;
   }
 
   bool DynamicArray::Contains(int value) const {
-    for (int i = 0; i < size_; i++) {
-      if (data_[i] == value) {
-        return true;
-      }
+    return FindFirst(value) >= 0;
+  }
+
+  int DynamicArray::Count(int value) const {
+    if ((thread_pool_ != nullptr)&&(size_ >= parallel_min_size_)) {
+      return parallel::Count(*thread_pool_, data_, size_, value);
     }
-    return false;
+    return simd::Count(data_, size_, value);
   }
 
   bool DynamicArray::IsEmpty() const {
@@ -153,12 +383,273 @@ namespace assignment {
     if (new_capacity <= capacity_) {
       return false;
     }
-    int* new_arr = new int[new_capacity];
-    std::copy(data_,data_+size_,new_arr);
-    delete[] data_;
+    Reallocate(new_capacity);
+    return true;
+  }
+
+  const GrowthPolicy& DynamicArray::growth_policy() const {
+    return growth_policy_;
+  }
+
+  void DynamicArray::set_growth_policy(GrowthPolicy growth_policy) {
+    growth_policy_ = std::move(growth_policy);
+  }
+
+  bool DynamicArray::ShrinkToFit() {
+    const int new_capacity = std::max(size_, 1);
+    if (new_capacity >= capacity_) {
+      return false;
+    }
+    reclaimed_bytes_ += static_cast<std::size_t>(capacity_ - new_capacity) * sizeof(int);
+    Reallocate(new_capacity);
+    return true;
+  }
+
+  const ShrinkPolicy& DynamicArray::shrink_policy() const {
+    return shrink_policy_;
+  }
+
+  void DynamicArray::set_shrink_policy(ShrinkPolicy shrink_policy) {
+    shrink_policy_ = shrink_policy;
+    ShrinkIfNeeded();
+  }
+
+  std::size_t DynamicArray::reclaimed_bytes() const {
+    return reclaimed_bytes_;
+  }
+
+  std::pmr::memory_resource* DynamicArray::resource() const {
+    return resource_;
+  }
+
+  void DynamicArray::set_thread_pool(ThreadPool* thread_pool, int min_size) {
+    thread_pool_ = thread_pool;
+    parallel_min_size_ = min_size;
+  }
+
+  ThreadPool* DynamicArray::thread_pool() const {
+    return thread_pool_;
+  }
+
+  void DynamicArray::EnableHashIndex() {
+    if (hash_index_ == nullptr) {
+      hash_index_ = new HashIndex(resource_);
+    }
+    hash_index_->Build(data_, size_);
+  }
+
+  void DynamicArray::DisableHashIndex() {
+    delete hash_index_;
+    hash_index_ = nullptr;
+  }
+
+  bool DynamicArray::has_hash_index() const {
+    return hash_index_ != nullptr;
+  }
+
+  std::size_t DynamicArray::hash_index_memory_usage() const {
+    return hash_index_ != nullptr ? hash_index_->memory_usage() : 0;
+  }
+
+  DynamicArray::iterator DynamicArray::begin() {
+    MakeUnique();
+    InvalidateHashIndex();
+    return data_;
+  }
+
+  DynamicArray::iterator DynamicArray::end() {
+    MakeUnique();
+    InvalidateHashIndex();
+    return data_ + size_;
+  }
+
+  DynamicArray::const_iterator DynamicArray::begin() const {
+    return data_;
+  }
+
+  DynamicArray::const_iterator DynamicArray::end() const {
+    return data_ + size_;
+  }
+
+  DynamicArray::const_iterator DynamicArray::cbegin() const {
+    return data_;
+  }
+
+  DynamicArray::const_iterator DynamicArray::cend() const {
+    return data_ + size_;
+  }
+
+  Span<int> DynamicArray::span() {
+    MakeUnique();
+    InvalidateHashIndex();
+    return {data_, size_};
+  }
+
+  Span<const int> DynamicArray::span() const {
+    return {data_, size_};
+  }
+
+  void DynamicArray::Save(int fd) const {
+    binary::Writer writer(fd, binary::Kind::kDynamicArray, size_);
+    writer.Write(data_, size_);
+    writer.Finish();
+  }
+
+  void DynamicArray::Load(int fd) {
+    binary::Reader reader(fd, binary::Kind::kDynamicArray);
+    const int count = reader.count();
+
+    // буфер собирается в отдельном массиве, текущий буфер заменяется только после проверки записи
+    DynamicArray loaded(1, growth_policy_, resource_);
+    if (binary::Mapping* mapping = reader.Map(); mapping != nullptr) {
+      loaded.ReleaseBuffer();
+      loaded.mapping_ = mapping;
+      loaded.data_ = mapping->data;
+      loaded.capacity_ = count;
+    } else {
+      if (count > loaded.capacity_) {
+        loaded.Reallocate(count);
+      }
+      reader.Read(loaded.data_, count);
+      reader.Finish();
+    }
+    loaded.size_ = count;
+
+    std::swap(size_, loaded.size_);
+    std::swap(capacity_, loaded.capacity_);
+    std::swap(data_, loaded.data_);
+    SwapSharedRefs(loaded);
+    std::swap(mapping_, loaded.mapping_);
+    RebuildHashIndex();
+  }
+
+  int DynamicArray::FindFirst(int value) const {
+    // устаревший индекс не перестраивается при поиске (константный поиск не изменяет массив) - просмотр
+    if ((hash_index_ != nullptr)&&(!hash_index_->stale())) {
+      return hash_index_->Find(value);
+    }
+    if ((thread_pool_ != nullptr)&&(size_ >= parallel_min_size_)) {
+      return parallel::FindFirst(*thread_pool_, data_, size_, value);
+    }
+    return simd::FindFirst(data_, size_, value);
+  }
+
+  int* DynamicArray::Allocate(int capacity) {
+    return static_cast<int*>(resource_->allocate(static_cast<std::size_t>(capacity) * sizeof(int), alignof(int)));
+  }
+
+  void DynamicArray::Deallocate(int* data, int capacity) {
+    if ((mapping_ != nullptr)&&(data == mapping_->data)) {
+      delete mapping_;
+      mapping_ = nullptr;
+      return;
+    }
+    if (data != nullptr) {
+      resource_->deallocate(data, static_cast<std::size_t>(capacity) * sizeof(int), alignof(int));
+    }
+  }
+
+  void DynamicArray::Reallocate(int new_capacity) {
+    int* new_arr = Allocate(new_capacity);
+    std::copy(data_, data_ + size_, new_arr);
+    ReleaseBuffer();
     data_ = new_arr;
     capacity_ = new_capacity;
-    return true;
+  }
+
+  void DynamicArray::ReleaseBuffer() {
+    if (std::atomic<int>* refs = shared_refs_.exchange(nullptr, std::memory_order_acq_rel); refs != nullptr) {
+      if (refs->fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        mapping_ = nullptr;  // отображение снимет последний владелец
+        return;  // буфер остается у других владельцев
+      }
+      refs->~atomic();
+      resource_->deallocate(refs, sizeof(std::atomic<int>), alignof(std::atomic<int>));
+    }
+    Deallocate(data_, capacity_);
+  }
+
+  void DynamicArray::MakeUnique() {
+    std::atomic<int>* refs = shared_refs_.load(std::memory_order_acquire);
+    if (refs == nullptr) {
+      return;
+    }
+    if (refs->load(std::memory_order_acquire) == 1) {
+      // остальные владельцы уже уничтожены
+      shared_refs_.store(nullptr, std::memory_order_release);
+      refs->~atomic();
+      resource_->deallocate(refs, sizeof(std::atomic<int>), alignof(std::atomic<int>));
+      return;
+    }
+    Reallocate(capacity_);
+  }
+
+  void DynamicArray::Swap(DynamicArray& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+    std::swap(growth_policy_, other.growth_policy_);
+    std::swap(shrink_policy_, other.shrink_policy_);
+    std::swap(reclaimed_bytes_, other.reclaimed_bytes_);
+    std::swap(resource_, other.resource_);
+    SwapSharedRefs(other);
+    std::swap(mapping_, other.mapping_);
+    std::swap(thread_pool_, other.thread_pool_);
+    std::swap(parallel_min_size_, other.parallel_min_size_);
+    std::swap(hash_index_, other.hash_index_);
+  }
+
+  void DynamicArray::SwapSharedRefs(DynamicArray& other) noexcept {
+    std::atomic<int>* refs = shared_refs_.load(std::memory_order_acquire);
+    shared_refs_.store(other.shared_refs_.exchange(refs, std::memory_order_acq_rel), std::memory_order_release);
+  }
+
+  void DynamicArray::ShrinkIfNeeded() {
+    const int new_capacity = shrink_policy_.ShrinkCapacity(size_, capacity_);
+    if (new_capacity < capacity_) {
+      reclaimed_bytes_ += static_cast<std::size_t>(capacity_ - new_capacity) * sizeof(int);
+      Reallocate(new_capacity);
+    }
+  }
+
+  int* DynamicArray::OpenGap(int index, int count) {
+    if (count > capacity_ - size_) {
+      Resize(growth_policy_.NextCapacity(capacity_, size_ + count));
+    }
+    MakeUnique();
+    const int tail = size_ - index;
+    std::memmove(data_ + index + count, data_ + index, static_cast<std::size_t>(tail) * sizeof(int));
+    size_ += count;
+    return data_ + index;
+  }
+
+  void DynamicArray::IndexInserted(int index, int count) {
+    if ((hash_index_ == nullptr)||(count == 0)) {
+      return;
+    }
+    if (hash_index_->stale()) {
+      RebuildHashIndex();
+      return;
+    }
+    // элементы вставлены не в конец - позиции следующих за ними значений сдвигаются
+    if (index + count < size_) {
+      hash_index_->Shift(index, count);
+    }
+    for (int i = index; i < index + count; i++) {
+      hash_index_->Add(data_[i], i);
+    }
+  }
+
+  void DynamicArray::InvalidateHashIndex() {
+    if (hash_index_ != nullptr) {
+      hash_index_->Invalidate();
+    }
+  }
+
+  void DynamicArray::RebuildHashIndex() {
+    if (hash_index_ != nullptr) {
+      hash_index_->Build(data_, size_);
+    }
   }
 
   // ДЛЯ ТЕСТИРОВАНИЯ
@@ -167,7 +658,8 @@ namespace assignment {
     size_ = static_cast<int>(values.size());
     capacity_ = capacity;
 
-    data_ = new int[capacity]{};
+    data_ = Allocate(capacity);
+    std::fill(data_, data_ + capacity, 0);
 
     std::copy(values.data(), values.data() + size_, data_);
   }
@@ -0,0 +1,201 @@
+#include "assignment/gap_buffer.hpp"
+
+#include <algorithm>  // copy
+#include <cstring>    // memmove
+#include <stdexcept>  // invalid_argument
+#include <utility>    // move, swap
+
+#include "assignment/simd.hpp"  // FindFirst
+
+namespace assignment {
+
+  GapBuffer::GapBuffer(int capacity, GrowthPolicy growth_policy) : growth_policy_{std::move(growth_policy)} {
+    if (capacity <= 0) {
+      throw std::invalid_argument("capacity is not positive");
+    }
+    data_ = new int[capacity];
+    capacity_ = capacity;
+    gap_begin_ = 0;
+    gap_end_ = capacity;
+  }
+
+  GapBuffer::GapBuffer(const GapBuffer& other)
+      : List(),
+        data_{new int[other.capacity_]},
+        capacity_{other.capacity_},
+        gap_begin_{other.gap_begin_},
+        gap_end_{other.gap_end_},
+        growth_policy_{other.growth_policy_} {
+    std::copy(other.data_, other.data_ + other.gap_begin_, data_);
+    std::copy(other.data_ + other.gap_end_, other.data_ + other.capacity_, data_ + gap_end_);
+  }
+
+  GapBuffer::GapBuffer(GapBuffer&& other) noexcept : List(), growth_policy_{other.growth_policy_} {
+    Swap(other);
+  }
+
+  GapBuffer& GapBuffer::operator=(const GapBuffer& other) {
+    if (this != &other) {
+      GapBuffer copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  GapBuffer& GapBuffer::operator=(GapBuffer&& other) noexcept {
+    if (this != &other) {
+      GapBuffer moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  GapBuffer::~GapBuffer() {
+    delete[] data_;
+    data_ = nullptr;
+    capacity_ = 0;
+    gap_begin_ = 0;
+    gap_end_ = 0;
+  }
+
+  void GapBuffer::Add(int value) {
+    Insert(size(), value);
+  }
+
+  bool GapBuffer::Insert(int index, int value) {
+    if ((index < 0)||(index > size())) {
+      return false;
+    }
+    if (GapSize() == 0) {
+      Grow();
+    }
+    MoveGap(index);
+    data_[gap_begin_] = value;
+    gap_begin_++;
+    return true;
+  }
+
+  bool GapBuffer::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size())) {
+      return false;
+    }
+    data_[Physical(index)] = new_value;
+    return true;
+  }
+
+  std::optional<int> GapBuffer::Remove(int index) {
+    if ((index < 0)||(index >= size())) {
+      return std::nullopt;
+    }
+    MoveGap(index);
+    const int removed = data_[gap_end_];
+    gap_end_++;
+    return removed;
+  }
+
+  void GapBuffer::Clear() {
+    gap_begin_ = 0;
+    gap_end_ = capacity_;
+  }
+
+  std::optional<int> GapBuffer::Get(int index) const {
+    if ((index < 0)||(index >= size())) {
+      return std::nullopt;
+    }
+    return data_[Physical(index)];
+  }
+
+  std::optional<int> GapBuffer::IndexOf(int value) const {
+    const int front = simd::FindFirst(data_, gap_begin_, value);
+    if (front >= 0) {
+      return front;
+    }
+    const int back = simd::FindFirst(data_ + gap_end_, capacity_ - gap_end_, value);
+    if (back >= 0) {
+      return gap_begin_ + back;
+    }
+    return std::nullopt;
+  }
+
+  bool GapBuffer::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool GapBuffer::IsEmpty() const {
+    return size() == 0;
+  }
+
+  int GapBuffer::size() const {
+    return capacity_ - GapSize();
+  }
+
+  int GapBuffer::capacity() const {
+    return capacity_;
+  }
+
+  int GapBuffer::cursor() const {
+    return gap_begin_;
+  }
+
+  bool GapBuffer::MoveCursor(int index) {
+    if ((index < 0)||(index > size())) {
+      return false;
+    }
+    MoveGap(index);
+    return true;
+  }
+
+  int GapBuffer::GapSize() const {
+    return gap_end_ - gap_begin_;
+  }
+
+  int GapBuffer::Physical(int index) const {
+    return index < gap_begin_ ? index : index + GapSize();
+  }
+
+  void GapBuffer::MoveGap(int index) {
+    if (index < gap_begin_) {
+      // элементы [index, gap_begin) переносятся за разрыв
+      const int count = gap_begin_ - index;
+      std::memmove(data_ + gap_end_ - count, data_ + index, static_cast<std::size_t>(count) * sizeof(int));
+      gap_begin_ -= count;
+      gap_end_ -= count;
+    } else if (index > gap_begin_) {
+      // элементы после разрыва переносятся перед разрывом
+      const int count = index - gap_begin_;
+      std::memmove(data_ + gap_begin_, data_ + gap_end_, static_cast<std::size_t>(count) * sizeof(int));
+      gap_begin_ += count;
+      gap_end_ += count;
+    }
+  }
+
+  void GapBuffer::Grow() {
+    const int new_capacity = growth_policy_.NextCapacity(capacity_, size() + 1);
+    const int back = capacity_ - gap_end_;
+
+    int* new_data = new int[new_capacity];
+    std::copy(data_, data_ + gap_begin_, new_data);
+    std::copy(data_ + gap_end_, data_ + capacity_, new_data + new_capacity - back);
+    delete[] data_;
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+    gap_end_ = new_capacity - back;
+  }
+
+  void GapBuffer::Swap(GapBuffer& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(gap_begin_, other.gap_begin_);
+    std::swap(gap_end_, other.gap_end_);
+    std::swap(growth_policy_, other.growth_policy_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> GapBuffer::toVector() const {
+    std::vector<int> values(data_, data_ + gap_begin_);
+    values.insert(values.end(), data_ + gap_end_, data_ + capacity_);
+    return values;
+  }
+
+}  // namespace assignment
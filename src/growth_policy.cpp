@@ -0,0 +1,81 @@
+#include "assignment/growth_policy.hpp"
+
+#include <algorithm>  // max, min
+#include <climits>    // INT_MAX
+#include <cstdint>    // int64_t
+#include <stdexcept>  // invalid_argument
+#include <utility>    // move
+
+namespace assignment {
+
+  GrowthPolicy GrowthPolicy::Additive(int increment) {
+    if (increment <= 0) {
+      throw std::invalid_argument("increment is not positive");
+    }
+    GrowthPolicy policy;
+    policy.kind_ = Kind::kAdditive;
+    policy.increment_ = increment;
+    return policy;
+  }
+
+  GrowthPolicy GrowthPolicy::Geometric15() {
+    GrowthPolicy policy;
+    policy.kind_ = Kind::kGeometric15;
+    return policy;
+  }
+
+  GrowthPolicy GrowthPolicy::Geometric2() {
+    GrowthPolicy policy;
+    policy.kind_ = Kind::kGeometric2;
+    return policy;
+  }
+
+  GrowthPolicy GrowthPolicy::Custom(Function function) {
+    if (!function) {
+      throw std::invalid_argument("growth function is empty");
+    }
+    GrowthPolicy policy;
+    policy.kind_ = Kind::kCustom;
+    policy.function_ = std::move(function);
+    return policy;
+  }
+
+  GrowthPolicy GrowthPolicy::Default() {
+#if defined(ASSIGNMENT_GROWTH_POLICY_GEOMETRIC2)
+    return Geometric2();
+#elif defined(ASSIGNMENT_GROWTH_POLICY_GEOMETRIC15)
+    return Geometric15();
+#else
+    return Additive();
+#endif
+  }
+
+  int GrowthPolicy::NextCapacity(int capacity, int min_capacity) const {
+    // вычисления в 64 битах, чтобы избежать переполнения int
+    const auto current = static_cast<std::int64_t>(capacity);
+    std::int64_t next = current;
+
+    switch (kind_) {
+      case Kind::kAdditive:
+        next = current + increment_;
+        break;
+      case Kind::kGeometric15:
+        next = current + current / 2;
+        break;
+      case Kind::kGeometric2:
+        next = current * 2;
+        break;
+      case Kind::kCustom:
+        next = function_(capacity);
+        break;
+    }
+
+    next = std::max({next, current + 1, static_cast<std::int64_t>(min_capacity)});
+    return static_cast<int>(std::min(next, static_cast<std::int64_t>(INT_MAX)));
+  }
+
+  GrowthPolicy::Kind GrowthPolicy::kind() const {
+    return kind_;
+  }
+
+}  // namespace assignment
@@ -0,0 +1,164 @@
+#include "assignment/hash_index.hpp"
+
+#include <algorithm>  // copy
+#include <cstdint>    // uint32_t
+#include <stdexcept>  // invalid_argument
+
+namespace assignment {
+
+  HashIndex::HashIndex(std::pmr::memory_resource* resource) : resource_{resource} {
+    if (resource == nullptr) {
+      throw std::invalid_argument("memory resource is null");
+    }
+  }
+
+  HashIndex::HashIndex(const HashIndex& other)
+      : size_{other.size_}, capacity_{other.capacity_}, stale_{other.stale_}, resource_{other.resource_} {
+    if (other.slots_ != nullptr) {
+      slots_ = static_cast<Slot*>(resource_->allocate(static_cast<std::size_t>(capacity_) * sizeof(Slot), alignof(Slot)));
+      std::copy(other.slots_, other.slots_ + capacity_, slots_);
+    }
+  }
+
+  HashIndex::~HashIndex() {
+    if (slots_ != nullptr) {
+      resource_->deallocate(slots_, static_cast<std::size_t>(capacity_) * sizeof(Slot), alignof(Slot));
+    }
+  }
+
+  void HashIndex::Build(const int* values, int count) {
+    Clear();
+    // емкость растет по мере добавления: кол-во различных значений может быть много меньше count
+    for (int i = 0; i < count; i++) {
+      Add(values[i], i);
+    }
+  }
+
+  int HashIndex::Find(int key) const {
+    if (size_ == 0) {
+      return kEmpty;
+    }
+    return slots_[Probe(key)].index;
+  }
+
+  void HashIndex::Add(int key, int index) {
+    Reserve(size_ + 1);
+    Slot& slot = slots_[Probe(key)];
+    if (slot.index == kEmpty) {
+      slot = Slot{key, index};
+      size_++;
+    } else if (index < slot.index) {
+      slot.index = index;
+    }
+  }
+
+  void HashIndex::Assign(int key, int index) {
+    Reserve(size_ + 1);
+    Slot& slot = slots_[Probe(key)];
+    if (slot.index == kEmpty) {
+      size_++;
+    }
+    slot = Slot{key, index};
+  }
+
+  bool HashIndex::Erase(int key) {
+    if (size_ == 0) {
+      return false;
+    }
+    const int mask = capacity_ - 1;
+    int hole = Probe(key);
+    if (slots_[hole].index == kEmpty) {
+      return false;
+    }
+
+    // обратный сдвиг: значения цепочки, которые не могут стоять до дыры, переносятся в нее
+    for (int next = (hole + 1) & mask; slots_[next].index != kEmpty; next = (next + 1) & mask) {
+      const int home = Home(slots_[next].key);
+      const bool stays = hole <= next ? (hole < home)&&(home <= next) : (hole < home)||(home <= next);
+      if (!stays) {
+        slots_[hole] = slots_[next];
+        hole = next;
+      }
+    }
+    slots_[hole].index = kEmpty;
+    size_--;
+    return true;
+  }
+
+  void HashIndex::Shift(int index, int delta) {
+    for (int i = 0; i < capacity_; i++) {
+      if (slots_[i].index >= index) {
+        slots_[i].index += delta;
+      }
+    }
+  }
+
+  void HashIndex::Clear() {
+    for (int i = 0; i < capacity_; i++) {
+      slots_[i].index = kEmpty;
+    }
+    size_ = 0;
+    stale_ = false;
+  }
+
+  void HashIndex::Invalidate() {
+    stale_ = true;
+  }
+
+  bool HashIndex::stale() const {
+    return stale_;
+  }
+
+  int HashIndex::size() const {
+    return size_;
+  }
+
+  std::size_t HashIndex::memory_usage() const {
+    return static_cast<std::size_t>(capacity_) * sizeof(Slot);
+  }
+
+  int HashIndex::Probe(int key) const {
+    const int mask = capacity_ - 1;
+    int i = Home(key);
+    while ((slots_[i].index != kEmpty)&&(slots_[i].key != key)) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void HashIndex::Reserve(int count) {
+    // заполненность не больше 1/2
+    if (count <= capacity_ / 2) {
+      return;
+    }
+    int new_capacity = capacity_ == 0 ? kMinCapacity : capacity_;
+    while (count > new_capacity / 2) {
+      new_capacity *= 2;
+    }
+
+    Slot* old_slots = slots_;
+    const int old_capacity = capacity_;
+    slots_ = static_cast<Slot*>(resource_->allocate(static_cast<std::size_t>(new_capacity) * sizeof(Slot), alignof(Slot)));
+    capacity_ = new_capacity;
+    for (int i = 0; i < capacity_; i++) {
+      slots_[i].index = kEmpty;
+    }
+
+    for (int i = 0; i < old_capacity; i++) {
+      if (old_slots[i].index != kEmpty) {
+        slots_[Probe(old_slots[i].key)] = old_slots[i];
+      }
+    }
+    if (old_slots != nullptr) {
+      resource_->deallocate(old_slots, static_cast<std::size_t>(old_capacity) * sizeof(Slot), alignof(Slot));
+    }
+  }
+
+  int HashIndex::Home(int key) const {
+    // мультипликативное хеширование (золотое сечение), старшие биты произведения перемешиваются с младшими
+    std::uint32_t hash = static_cast<std::uint32_t>(key) * 0x9E3779B9u;
+    hash ^= hash >> 16;
+    return static_cast<int>(hash & static_cast<std::uint32_t>(capacity_ - 1));
+  }
+
+}  // namespace assignment
@@ -1,7 +1,70 @@
 #include "assignment/linked_list.hpp"
 
+#include <algorithm>  // is_sorted, stable_sort
+#include <cstddef>    // size_t
+#include <memory>     // unique_ptr, make_unique
+#include <new>        // placement new
+#include <numeric>    // iota
+#include <utility>    // swap
+
+#include "assignment/binary_format.hpp"  // SaveNodes, LoadNodes, Reader
+
 namespace assignment {
 
+  namespace {
+
+    // Порядок обхода набора индексов по возрастанию.
+    // Сортировка устойчивая: для равных индексов сохраняется порядок в наборе.
+    std::unique_ptr<int[]> AscendingOrder(const int* indices, int count) {
+      auto order = std::make_unique<int[]>(static_cast<std::size_t>(count));
+      std::iota(order.get(), order.get() + count, 0);
+      if (!std::is_sorted(indices, indices + count)) {
+        std::stable_sort(order.get(), order.get() + count, [indices](int a, int b) {
+          return indices[a] < indices[b];
+        });
+      }
+      return order;
+    }
+
+  }  // namespace
+
+  LinkedList::LinkedList(std::pmr::memory_resource* resource) : pool_{resource} {}
+
+  LinkedList::LinkedList(const LinkedList& other) : List(), pool_{other.pool_.resource()} {
+    if (other.size_ == 0) {
+      return;
+    }
+    Node* block = pool_.NewBlock(other.size_);
+    const Node* source = other.front_;
+    for (int i = 0; i < other.size_; i++) {
+      new (block + i) Node(source->value, i + 1 < other.size_ ? block + i + 1 : nullptr);
+      source = source->next;
+    }
+    size_ = other.size_;
+    front_ = block;
+    back_ = block + size_ - 1;
+  }
+
+  LinkedList& LinkedList::operator=(const LinkedList& other) {
+    if (this != &other) {
+      LinkedList copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  LinkedList::LinkedList(LinkedList&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  LinkedList& LinkedList::operator=(LinkedList&& other) noexcept {
+    if (this != &other) {
+      LinkedList moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
   LinkedList::~LinkedList() {
 
     // эквивалентно очистке списка
@@ -10,11 +73,11 @@ namespace assignment {
 
   void LinkedList::Add(int value) {
     if (IsEmpty()) {
-      back_ = new Node(value, nullptr);
+      back_ = pool_.New(value, nullptr);
       front_ = back_;
       size_++;
     } else {
-      Node* new_node = new Node(value, nullptr);
+      Node* new_node = pool_.New(value, nullptr);
       back_->next = new_node;
       back_ = new_node;
       size_++;
@@ -25,26 +88,21 @@ namespace assignment {
     if ((index < 0)||(index > size_)||(IsEmpty()&&(index > 0))) {
       return false;
     }
-    if ((size_ == 1)&&(index == 0)) {
-      Node* new_node = new Node(value,back_);
-      front_ = new_node;
-      size_++;
-      return true;
-    }
     if (IsEmpty()||(index == size_)||((size_ == 1)&&(index == 1))) {
       Add(value);
       return true;
     }
     if (index == 0) {
-      Node* new_node = new Node(value, front_);
+      Node* new_node = pool_.New(value, front_);
       front_ = new_node;
       size_++;
+      if (finger_node_ != nullptr) {
+        finger_index_++;
+      }
       return true;
     }
-    Node* new_node = new Node(value, FindNode(index));
-    Node* first_before_inserted = FindNode(index-1);
-    first_before_inserted->next = new_node;
-    size_++;
+    // один проход до предшествующего узла: следующий за ним узел - текущий узел с индексом index
+    InsertAfterNode(FindNode(index - 1), index - 1, value);
     return true;
   }
 
@@ -52,12 +110,7 @@ namespace assignment {
     if (IsEmpty()||(index < 0)||(index >= size_)) {
       return false;
     }
-    Node* changed_node = front_;
-    for (int i = 0; i < index; i++) {
-      Node* next_node = changed_node->next;
-      changed_node = next_node;
-    }
-    changed_node->value = new_value;
+    FindNode(index)->value = new_value;
     return true;
   }
 
@@ -65,76 +118,104 @@ namespace assignment {
     if (IsEmpty() || (index < 0) || (index >= size_)) {
       return std::nullopt;
     }
-    int deleted_value;
-    if (index == 0) {
-      deleted_value = front_->value;
-      front_ = front_->next;
-      size_--;
-      return deleted_value;
+    if (index > 0) {
+      return RemoveAfterNode(FindNode(index - 1), index - 1);
     }
-    Node* search_node = front_;
-    for (int i = 0; i < index; i++) {
-      if ((index == size_-1)&&(i == index-1)) {
-        deleted_value = back_->value;
-        search_node->next = nullptr;
-        back_ = search_node;
-        size_--;
-        return deleted_value;
-      }
-      if (i == index-1) {
-        deleted_value = search_node->next->value;
-        search_node->next = search_node->next->next;
-        size_--;
-        return deleted_value;
-      }
-      search_node = search_node->next;
+
+    Node* deleted_node = front_;
+    front_ = front_->next;
+    if (front_ == nullptr) {
+      back_ = nullptr;
+    }
+    if (finger_index_ == 0) {
+      ResetFinger();
+    } else if (finger_node_ != nullptr) {
+      finger_index_--;
     }
+    const int deleted_value = deleted_node->value;
+    pool_.Delete(deleted_node);
+    size_--;
+    return deleted_value;
   }
 
-
   void LinkedList::Clear() {
       size_ = 0;
       front_ = nullptr;
       back_ = nullptr;
+      ResetFinger();
+      pool_.Reset();
   }
 
   std::optional<int> LinkedList::Get(int index) const {
     if (IsEmpty()||(index < 0)||(index >= size_)) {
       return std::nullopt;
     }
-    Node* search_node = front_;
-    for (int i = 0; i < index; i++) {
-      Node* next_node = search_node->next;
-      search_node = next_node;
-    }
-    return search_node->value;
+    return FindNode(index)->value;
   }
 
-  std::optional<int> LinkedList::IndexOf(int value) const {
-    Node* search_node = front_;
-    for (int i = 0; i < size_-1; i++) {
-      Node* next_node = search_node->next;
-      if (search_node->value == value) {
-        return i;
+  bool LinkedList::GetMany(const int* indices, int count, int* out) const {
+    if ((count < 0)||((count > 0)&&((indices == nullptr)||(out == nullptr)))) {
+      return false;
+    }
+    if (count == 0) {
+      return true;
+    }
+    const auto sorted = AscendingOrder(indices, count);
+    const int* order = sorted.get();
+    if ((indices[order[0]] < 0)||(indices[order[count - 1]] >= size_)) {
+      return false;
+    }
+
+    const Node* node = front_;
+    int position = 0;
+    for (int k = 0; k < count; k++) {
+      const int i = order[k];
+      for (; position < indices[i]; position++) {
+        node = node->next;
       }
-      search_node = next_node;
+      out[i] = node->value;
     }
-    if (search_node->value == value) {
-      return size_-1;
+    return true;
+  }
+
+  bool LinkedList::SetMany(const int* indices, const int* values, int count) {
+    if ((count < 0)||((count > 0)&&((indices == nullptr)||(values == nullptr)))) {
+      return false;
+    }
+    if (count == 0) {
+      return true;
+    }
+    const auto sorted = AscendingOrder(indices, count);
+    const int* order = sorted.get();
+    if ((indices[order[0]] < 0)||(indices[order[count - 1]] >= size_)) {
+      return false;
+    }
+
+    Node* node = front_;
+    int position = 0;
+    for (int k = 0; k < count; k++) {
+      const int i = order[k];
+      for (; position < indices[i]; position++) {
+        node = node->next;
+      }
+      node->value = values[i];
     }
-    return false;
+    return true;
   }
 
-  bool LinkedList::Contains(int value) const {
-    Node* search_node = front_;
-    for (int i = 0; i < size_-1; i++) {
-      Node* next_node = search_node->next;
+  std::optional<int> LinkedList::IndexOf(int value) const {
+    int index = 0;
+    for (const Node* search_node = front_; search_node != nullptr; search_node = search_node->next) {
       if (search_node->value == value) {
-        return true;
+        return index;
       }
-      search_node = next_node;
+      index++;
     }
-    return search_node->value == value;
+    return std::nullopt;
+  }
+
+  bool LinkedList::Contains(int value) const {
+    return IndexOf(value).has_value();
   }
 
   bool LinkedList::IsEmpty() const {
@@ -145,6 +226,10 @@ namespace assignment {
     return size_;
   }
 
+  const NodePool<Node>& LinkedList::pool() const {
+    return pool_;
+  }
+
   std::optional<int> LinkedList::front() const {
     if (IsEmpty()) {
       return std::nullopt;
@@ -163,14 +248,169 @@ namespace assignment {
     if (IsEmpty()||(index < 0)||(index >= size_)) {
       return nullptr;
     }
+    if (index == size_ - 1) {
+      return back_;
+    }
+
+    // поиск от пальца, если искомый узел не раньше него, иначе от начала списка
     Node* search_node = front_;
-    for (int i = 0; i < index; i++) {
-      Node* next_node = search_node->next;
-      search_node = next_node;
+    int position = 0;
+    if ((finger_node_ != nullptr)&&(finger_index_ <= index)) {
+      search_node = finger_node_;
+      position = finger_index_;
     }
+    for (; position < index; position++) {
+      search_node = search_node->next;
+    }
+    finger_index_ = index;
+    finger_node_ = search_node;
     return search_node;
   }
 
+  LinkedList::Cursor LinkedList::cursor(int index) {
+    Node* node = FindNode(index);
+    return Cursor(this, node, node == nullptr ? size_ : index);
+  }
+
+  LinkedList::iterator LinkedList::begin() {
+    return iterator(front_);
+  }
+
+  LinkedList::iterator LinkedList::end() {
+    return iterator(nullptr);
+  }
+
+  LinkedList::const_iterator LinkedList::begin() const {
+    return const_iterator(front_);
+  }
+
+  LinkedList::const_iterator LinkedList::end() const {
+    return const_iterator(nullptr);
+  }
+
+  LinkedList::const_iterator LinkedList::cbegin() const {
+    return const_iterator(front_);
+  }
+
+  LinkedList::const_iterator LinkedList::cend() const {
+    return const_iterator(nullptr);
+  }
+
+  void LinkedList::Save(int fd) const {
+    binary::SaveNodes(fd, binary::Kind::kLinkedList, front_, size_);
+  }
+
+  void LinkedList::Load(int fd) {
+    binary::Reader reader(fd, binary::Kind::kLinkedList);
+
+    // узлы создаются в пуле отдельного списка, текущий список заменяется только после проверки записи
+    LinkedList loaded(pool_.resource());
+    Node* block = binary::LoadNodes(reader, loaded.pool_);
+    loaded.size_ = reader.count();
+    if (loaded.size_ > 0) {
+      loaded.front_ = block;
+      loaded.back_ = block + loaded.size_ - 1;
+    }
+    Swap(loaded);
+  }
+
+  void LinkedList::InsertAfterNode(Node* node, int index, int value) {
+    node->next = pool_.New(value, node->next);
+    if (node == back_) {
+      back_ = node->next;
+    }
+    if (index < 0) {
+      ResetFinger();
+    } else if (finger_index_ > index) {
+      finger_index_++;
+    }
+    size_++;
+  }
+
+  int LinkedList::RemoveAfterNode(Node* node, int index) {
+    Node* deleted_node = node->next;
+    node->next = deleted_node->next;
+    if (deleted_node == back_) {
+      back_ = node;
+    }
+    if (index < 0) {
+      ResetFinger();
+    } else if (finger_index_ == index + 1) {
+      finger_index_ = index;
+      finger_node_ = node;
+    } else if (finger_index_ > index + 1) {
+      finger_index_--;
+    }
+    const int deleted_value = deleted_node->value;
+    pool_.Delete(deleted_node);
+    size_--;
+    return deleted_value;
+  }
+
+  void LinkedList::ResetFinger() const {
+    finger_index_ = -1;
+    finger_node_ = nullptr;
+  }
+
+  void LinkedList::Swap(LinkedList& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(front_, other.front_);
+    std::swap(back_, other.back_);
+    std::swap(finger_index_, other.finger_index_);
+    std::swap(finger_node_, other.finger_node_);
+    pool_.Swap(other.pool_);
+  }
+
+  LinkedList::Cursor::Cursor(LinkedList* list, Node* node, int index) : list_{list}, node_{node}, index_{index} {}
+
+  bool LinkedList::Cursor::IsEnd() const {
+    return node_ == nullptr;
+  }
+
+  int LinkedList::Cursor::index() const {
+    return index_;
+  }
+
+  std::optional<int> LinkedList::Cursor::value() const {
+    if (node_ == nullptr) {
+      return std::nullopt;
+    }
+    return node_->value;
+  }
+
+  bool LinkedList::Cursor::Set(int new_value) {
+    if (node_ == nullptr) {
+      return false;
+    }
+    node_->value = new_value;
+    return true;
+  }
+
+  bool LinkedList::Cursor::Next() {
+    if (node_ == nullptr) {
+      return false;
+    }
+    node_ = node_->next;
+    index_++;
+    return node_ != nullptr;
+  }
+
+  bool LinkedList::Cursor::InsertAfter(int value) {
+    if (node_ == nullptr) {
+      return false;
+    }
+    // индекс курсора мог устареть после изменений перед его узлом: палец не сдвигается, а сбрасывается
+    list_->InsertAfterNode(node_, -1, value);
+    return true;
+  }
+
+  std::optional<int> LinkedList::Cursor::RemoveAfter() {
+    if ((node_ == nullptr)||(node_->next == nullptr)) {
+      return std::nullopt;
+    }
+    return list_->RemoveAfterNode(node_, -1);
+  }
+
   // ДЛЯ ТЕСТИРОВАНИЯ
   LinkedList::LinkedList(const std::vector<int>& values) {
 
@@ -178,18 +418,18 @@ namespace assignment {
       return;
     }
 
-    auto* curr_node = new Node(values.front());
+    auto* curr_node = pool_.New(values.front());
     front_ = curr_node;
 
     for (int index = 1; index < values.size() - 1; ++index) {
-      curr_node->next = new Node(values[index]);
+      curr_node->next = pool_.New(values[index]);
       curr_node = curr_node->next;
     }
 
     if (values.size() == 1) {
       back_ = front_;
     } else {
-      curr_node->next = new Node(values.back());
+      curr_node->next = pool_.New(values.back());
       back_ = curr_node->next;
     }
 
@@ -1,7 +1,49 @@
 #include "assignment/linked_queue.hpp"
 
+#include <new>      // placement new
+#include <utility>  // swap
+
+#include "assignment/binary_format.hpp"  // SaveNodes, LoadNodes, Reader
+
 namespace assignment {
 
+  LinkedQueue::LinkedQueue(std::pmr::memory_resource* resource) : pool_{resource} {}
+
+  LinkedQueue::LinkedQueue(const LinkedQueue& other) : Queue(), pool_{other.pool_.resource()} {
+    if (other.size_ == 0) {
+      return;
+    }
+    Node* block = pool_.NewBlock(other.size_);
+    const Node* source = other.front_;
+    for (int i = 0; i < other.size_; i++) {
+      new (block + i) Node(source->value, i + 1 < other.size_ ? block + i + 1 : nullptr);
+      source = source->next;
+    }
+    size_ = other.size_;
+    front_ = block;
+    back_ = block + size_ - 1;
+  }
+
+  LinkedQueue& LinkedQueue::operator=(const LinkedQueue& other) {
+    if (this != &other) {
+      LinkedQueue copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  LinkedQueue::LinkedQueue(LinkedQueue&& other) noexcept : Queue() {
+    Swap(other);
+  }
+
+  LinkedQueue& LinkedQueue::operator=(LinkedQueue&& other) noexcept {
+    if (this != &other) {
+      LinkedQueue moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
   LinkedQueue::~LinkedQueue() {
 
     // эквивалентно очистке очереди
@@ -10,12 +52,12 @@ namespace assignment {
 
   void LinkedQueue::Enqueue(int value) {
     if (IsEmpty()) {
-      Node* new_node = new Node(value, nullptr);
+      Node* new_node = pool_.New(value, nullptr);
       front_ = new_node;
       back_= front_;
       size_++;
     } else {
-      Node* new_node = new Node(value, nullptr);
+      Node* new_node = pool_.New(value, nullptr);
       back_->next = new_node;
       back_ = new_node;
       size_++;
@@ -26,8 +68,12 @@ namespace assignment {
     if (IsEmpty()) {
       return false;
     }
-    front_->value = 0;
+    Node* dequeued = front_;
     front_ = front_->next;
+    if (front_ == nullptr) {
+      back_ = nullptr;
+    }
+    pool_.Delete(dequeued);
     size_--;
     return true;
   }
@@ -36,6 +82,7 @@ namespace assignment {
     size_ = 0;
     front_ = nullptr;
     back_ = nullptr;
+    pool_.Reset();
   }
 
   std::optional<int> LinkedQueue::front() const {
@@ -60,6 +107,43 @@ namespace assignment {
     return size_;
   }
 
+  const NodePool<Node>& LinkedQueue::pool() const {
+    return pool_;
+  }
+
+  LinkedQueue::const_iterator LinkedQueue::begin() const {
+    return const_iterator(front_);
+  }
+
+  LinkedQueue::const_iterator LinkedQueue::end() const {
+    return const_iterator(nullptr);
+  }
+
+  void LinkedQueue::Save(int fd) const {
+    binary::SaveNodes(fd, binary::Kind::kLinkedQueue, front_, size_);
+  }
+
+  void LinkedQueue::Load(int fd) {
+    binary::Reader reader(fd, binary::Kind::kLinkedQueue);
+
+    // узлы создаются в пуле отдельной очереди, текущая очередь заменяется только после проверки записи
+    LinkedQueue loaded(pool_.resource());
+    Node* block = binary::LoadNodes(reader, loaded.pool_);
+    loaded.size_ = reader.count();
+    if (loaded.size_ > 0) {
+      loaded.front_ = block;
+      loaded.back_ = block + loaded.size_ - 1;
+    }
+    Swap(loaded);
+  }
+
+  void LinkedQueue::Swap(LinkedQueue& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(front_, other.front_);
+    std::swap(back_, other.back_);
+    pool_.Swap(other.pool_);
+  }
+
   // ДЛЯ ТЕСТИРОВАНИЯ
   LinkedQueue::LinkedQueue(const std::vector<int>& values) {
 
@@ -67,18 +151,18 @@ namespace assignment {
       return;
     }
 
-    auto* curr_node = new Node(values.front());
+    auto* curr_node = pool_.New(values.front());
     front_ = curr_node;
 
     for (int index = 1; index < values.size() - 1; ++index) {
-      curr_node->next = new Node(values[index]);
+      curr_node->next = pool_.New(values[index]);
       curr_node = curr_node->next;
     }
 
     if (values.size() == 1) {
       back_ = front_;
     } else {
-      curr_node->next = new Node(values.back());
+      curr_node->next = pool_.New(values.back());
       back_ = curr_node->next;
     }
 
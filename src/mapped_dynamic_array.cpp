@@ -0,0 +1,256 @@
+#include "assignment/mapped_dynamic_array.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>     // open, O_*
+#include <sys/mman.h>  // mmap, msync, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, ftruncate
+
+#include <cerrno>        // errno
+#include <climits>       // INT_MAX
+#include <cstring>       // memmove
+#include <stdexcept>     // invalid_argument, runtime_error
+#include <system_error>  // system_error, generic_category
+#include <utility>       // move
+
+#include "assignment/simd.hpp"  // FindFirst
+
+namespace assignment {
+
+  namespace {
+
+    static_assert(MappedDynamicArray::kDataOffset % alignof(int) == 0, "cells must be aligned");
+
+    [[noreturn]] void ThrowSystemError(const std::string& what) {
+      throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    std::int64_t FileSize(std::int64_t capacity) {
+      return MappedDynamicArray::kDataOffset + capacity * static_cast<std::int64_t>(sizeof(int));
+    }
+
+  }  // namespace
+
+  MappedDynamicArray::MappedDynamicArray(const std::string& path, int capacity, GrowthPolicy growth_policy)
+      : path_{path}, growth_policy_{std::move(growth_policy)} {
+    if (capacity <= 0) {
+      throw std::invalid_argument("capacity is not positive");
+    }
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      ThrowSystemError("open " + path);
+    }
+
+    try {
+      struct stat file_stat {};
+      if (::fstat(fd_, &file_stat) != 0) {
+        ThrowSystemError("fstat " + path);
+      }
+
+      if (file_stat.st_size == 0) {
+        // новый файл
+        Truncate(capacity);
+        Map(FileSize(capacity));
+        header_->magic = kMagic;
+        header_->version = kVersion;
+        header_->size = 0;
+        header_->capacity = capacity;
+        return;
+      }
+
+      // существующий файл: отображается как есть, элементы не читаются
+      const std::int64_t file_size = file_stat.st_size;
+      if (file_size < kDataOffset) {
+        throw std::runtime_error("file is too small: " + path);
+      }
+      Map(file_size);
+
+      if ((header_->magic != kMagic)||(header_->version != kVersion)) {
+        throw std::runtime_error("unknown file format or version: " + path);
+      }
+      if ((header_->capacity <= 0)||(header_->capacity > INT_MAX)||(FileSize(header_->capacity) > file_size)||
+          (header_->size < 0)||(header_->size > header_->capacity)) {
+        throw std::runtime_error("corrupted header: " + path);
+      }
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  MappedDynamicArray::~MappedDynamicArray() {
+    Close();
+  }
+
+  void MappedDynamicArray::Add(int value) {
+    const int size = this->size();
+    if (size == capacity()) {
+      Resize(growth_policy_.NextCapacity(capacity(), size + 1));
+    }
+    data_[size] = value;
+    header_->size = size + 1;
+  }
+
+  bool MappedDynamicArray::Insert(int index, int value) {
+    const int size = this->size();
+    if ((index < 0)||(index > size)) {
+      return false;
+    }
+    if (size == capacity()) {
+      Resize(growth_policy_.NextCapacity(capacity(), size + 1));
+    }
+    std::memmove(data_ + index + 1, data_ + index, static_cast<std::size_t>(size - index) * sizeof(int));
+    data_[index] = value;
+    header_->size = size + 1;
+    return true;
+  }
+
+  bool MappedDynamicArray::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size())) {
+      return false;
+    }
+    data_[index] = new_value;
+    return true;
+  }
+
+  std::optional<int> MappedDynamicArray::Remove(int index) {
+    const int size = this->size();
+    if ((index < 0)||(index >= size)) {
+      return std::nullopt;
+    }
+    const int removed = data_[index];
+    std::memmove(data_ + index, data_ + index + 1, static_cast<std::size_t>(size - index - 1) * sizeof(int));
+    header_->size = size - 1;
+    return removed;
+  }
+
+  void MappedDynamicArray::Clear() {
+    header_->size = 0;
+  }
+
+  std::optional<int> MappedDynamicArray::Get(int index) const {
+    if ((index < 0)||(index >= size())) {
+      return std::nullopt;
+    }
+    return data_[index];
+  }
+
+  std::optional<int> MappedDynamicArray::IndexOf(int value) const {
+    const int index = simd::FindFirst(data_, size(), value);
+    if (index < 0) {
+      return std::nullopt;
+    }
+    return index;
+  }
+
+  bool MappedDynamicArray::Contains(int value) const {
+    return simd::FindFirst(data_, size(), value) >= 0;
+  }
+
+  bool MappedDynamicArray::IsEmpty() const {
+    return header_->size == 0;
+  }
+
+  int MappedDynamicArray::size() const {
+    return static_cast<int>(header_->size);
+  }
+
+  int MappedDynamicArray::capacity() const {
+    return static_cast<int>(header_->capacity);
+  }
+
+  bool MappedDynamicArray::Resize(int new_capacity) {
+    if (new_capacity <= capacity()) {
+      return false;
+    }
+    Truncate(new_capacity);
+
+    // новое отображение создается до снятия старого: при ошибке массив остается рабочим
+    void* old_mapping = mapping_;
+    const std::int64_t old_mapping_size = mapping_size_;
+    Map(FileSize(new_capacity));
+    ::munmap(old_mapping, static_cast<std::size_t>(old_mapping_size));
+
+    header_->capacity = new_capacity;
+    return true;
+  }
+
+  void MappedDynamicArray::Sync() {
+    if (::msync(mapping_, static_cast<std::size_t>(mapping_size_), MS_SYNC) != 0) {
+      ThrowSystemError("msync " + path_);
+    }
+  }
+
+  const std::string& MappedDynamicArray::path() const {
+    return path_;
+  }
+
+  MappedDynamicArray::iterator MappedDynamicArray::begin() {
+    return data_;
+  }
+
+  MappedDynamicArray::iterator MappedDynamicArray::end() {
+    return data_ + size();
+  }
+
+  MappedDynamicArray::const_iterator MappedDynamicArray::begin() const {
+    return data_;
+  }
+
+  MappedDynamicArray::const_iterator MappedDynamicArray::end() const {
+    return data_ + size();
+  }
+
+  Span<int> MappedDynamicArray::span() {
+    return {data_, size()};
+  }
+
+  Span<const int> MappedDynamicArray::span() const {
+    return {data_, size()};
+  }
+
+  void MappedDynamicArray::Truncate(std::int64_t capacity) {
+    if (::ftruncate(fd_, FileSize(capacity)) != 0) {
+      ThrowSystemError("ftruncate " + path_);
+    }
+  }
+
+  void MappedDynamicArray::Map(std::int64_t bytes) {
+    void* mapping = ::mmap(nullptr, static_cast<std::size_t>(bytes), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      ThrowSystemError("mmap " + path_);
+    }
+    mapping_ = mapping;
+    mapping_size_ = bytes;
+    header_ = static_cast<Header*>(mapping);
+    data_ = reinterpret_cast<int*>(static_cast<char*>(mapping) + kDataOffset);
+  }
+
+  void MappedDynamicArray::Unmap() {
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, static_cast<std::size_t>(mapping_size_));
+    }
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    header_ = nullptr;
+    data_ = nullptr;
+  }
+
+  void MappedDynamicArray::Close() noexcept {
+    Unmap();
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+    fd_ = -1;
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> MappedDynamicArray::toVector() const {
+    return {data_, data_ + size()};
+  }
+
+}  // namespace assignment
+
+#endif  // defined(__unix__) || defined(__APPLE__)
@@ -4,6 +4,6 @@ namespace assignment {
 
   Node::Node(int value, Node *next) : value{value}, next{next} {}
 
-  DoubleNode::DoubleNode(int value, Node *prev, Node *next) : value{value}, prev{prev}, next{next} {}
+  DoubleNode::DoubleNode(int value, DoubleNode *prev, DoubleNode *next) : value{value}, prev{prev}, next{next} {}
 
 }  // namespace classwork
\ No newline at end of file
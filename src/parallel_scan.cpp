@@ -0,0 +1,54 @@
+#include "assignment/parallel_scan.hpp"
+
+#include <algorithm>  // min
+#include <atomic>     // atomic
+#include <climits>    // INT_MAX
+
+#include "assignment/simd.hpp"  // FindFirst, Count
+
+namespace assignment::parallel {
+
+  namespace {
+
+    int ChunkCount(int size) {
+      return size / kChunkSize + (size % kChunkSize == 0 ? 0 : 1);
+    }
+
+  }  // namespace
+
+  int FindFirst(ThreadPool& pool, const int* data, int size, int value) {
+    std::atomic<int> found{INT_MAX};
+
+    pool.ParallelFor(ChunkCount(size), [&](int chunk) {
+      const int begin = chunk * kChunkSize;
+      if (begin > found.load(std::memory_order_relaxed)) {
+        return;  // вхождение уже найдено в одном из предыдущих блоков
+      }
+
+      const int index = simd::FindFirst(data + begin, std::min(kChunkSize, size - begin), value);
+      if (index < 0) {
+        return;
+      }
+
+      int current = found.load(std::memory_order_relaxed);
+      while ((begin + index < current)&&
+             !found.compare_exchange_weak(current, begin + index, std::memory_order_relaxed)) {
+      }
+    });
+
+    const int index = found.load(std::memory_order_relaxed);
+    return index == INT_MAX ? -1 : index;
+  }
+
+  int Count(ThreadPool& pool, const int* data, int size, int value) {
+    std::atomic<int> count{0};
+
+    pool.ParallelFor(ChunkCount(size), [&](int chunk) {
+      const int begin = chunk * kChunkSize;
+      count.fetch_add(simd::Count(data + begin, std::min(kChunkSize, size - begin), value), std::memory_order_relaxed);
+    });
+
+    return count.load(std::memory_order_relaxed);
+  }
+
+}  // namespace assignment::parallel
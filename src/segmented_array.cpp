@@ -0,0 +1,197 @@
+#include "assignment/segmented_array.hpp"
+
+#include <algorithm>  // copy, max, min
+#include <cstring>    // memmove
+#include <utility>    // move, swap
+
+#include "assignment/simd.hpp"  // FindFirst
+
+namespace assignment {
+
+  SegmentedArray::SegmentedArray(const SegmentedArray& other) : List() {
+    while (capacity() < other.size_) {
+      AddChunk();
+    }
+    for (int chunk = 0; chunk * kChunkSize < other.size_; chunk++) {
+      const int count = std::min(kChunkSize, other.size_ - chunk * kChunkSize);
+      std::copy(other.chunks_[chunk], other.chunks_[chunk] + count, chunks_[chunk]);
+    }
+    size_ = other.size_;
+  }
+
+  SegmentedArray::SegmentedArray(SegmentedArray&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  SegmentedArray& SegmentedArray::operator=(const SegmentedArray& other) {
+    if (this != &other) {
+      SegmentedArray copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  SegmentedArray& SegmentedArray::operator=(SegmentedArray&& other) noexcept {
+    if (this != &other) {
+      SegmentedArray moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  SegmentedArray::~SegmentedArray() {
+    for (int chunk = 0; chunk < chunk_count_; chunk++) {
+      delete[] chunks_[chunk];
+    }
+    delete[] chunks_;
+    chunks_ = nullptr;
+    chunk_count_ = 0;
+    directory_capacity_ = 0;
+    size_ = 0;
+  }
+
+  void SegmentedArray::Add(int value) {
+    if (size_ == capacity()) {
+      AddChunk();
+    }
+    chunks_[size_ >> kChunkShift][size_ & kChunkMask] = value;
+    size_++;
+  }
+
+  bool SegmentedArray::Insert(int index, int value) {
+    if ((index < 0)||(index > size_)) {
+      return false;
+    }
+    Add(value);
+
+    // сдвиг [index, size - 1) на одну ячейку вправо, от последнего блока к первому
+    const int first = index >> kChunkShift;
+    const int last = (size_ - 1) >> kChunkShift;
+    for (int chunk = last; chunk >= first; chunk--) {
+      int* cells = chunks_[chunk];
+      const int begin = chunk == first ? index & kChunkMask : 0;
+      const int end = chunk == last ? (size_ - 1) & kChunkMask : kChunkMask;
+
+      std::memmove(cells + begin + 1, cells + begin, static_cast<std::size_t>(end - begin) * sizeof(int));
+      if (chunk > first) {
+        cells[0] = chunks_[chunk - 1][kChunkMask];
+      }
+    }
+    chunks_[first][index & kChunkMask] = value;
+    return true;
+  }
+
+  bool SegmentedArray::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size_)) {
+      return false;
+    }
+    chunks_[index >> kChunkShift][index & kChunkMask] = new_value;
+    return true;
+  }
+
+  std::optional<int> SegmentedArray::Remove(int index) {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    const int removed = chunks_[index >> kChunkShift][index & kChunkMask];
+
+    // сдвиг (index, size) на одну ячейку влево, от первого блока к последнему
+    const int first = index >> kChunkShift;
+    const int last = (size_ - 1) >> kChunkShift;
+    for (int chunk = first; chunk <= last; chunk++) {
+      int* cells = chunks_[chunk];
+      const int begin = chunk == first ? index & kChunkMask : 0;
+      const int end = chunk == last ? (size_ - 1) & kChunkMask : kChunkMask;
+
+      std::memmove(cells + begin, cells + begin + 1, static_cast<std::size_t>(end - begin) * sizeof(int));
+      if (chunk < last) {
+        cells[kChunkMask] = chunks_[chunk + 1][0];
+      }
+    }
+    size_--;
+    return removed;
+  }
+
+  void SegmentedArray::Clear() {
+    size_ = 0;
+  }
+
+  std::optional<int> SegmentedArray::Get(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    return chunks_[index >> kChunkShift][index & kChunkMask];
+  }
+
+  std::optional<int> SegmentedArray::IndexOf(int value) const {
+    for (int chunk = 0; chunk * kChunkSize < size_; chunk++) {
+      const int count = std::min(kChunkSize, size_ - chunk * kChunkSize);
+      const int index = simd::FindFirst(chunks_[chunk], count, value);
+      if (index >= 0) {
+        return chunk * kChunkSize + index;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool SegmentedArray::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool SegmentedArray::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int SegmentedArray::size() const {
+    return size_;
+  }
+
+  int SegmentedArray::capacity() const {
+    return chunk_count_ * kChunkSize;
+  }
+
+  int* SegmentedArray::At(int index) {
+    if ((index < 0)||(index >= size_)) {
+      return nullptr;
+    }
+    return chunks_[index >> kChunkShift] + (index & kChunkMask);
+  }
+
+  const int* SegmentedArray::At(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return nullptr;
+    }
+    return chunks_[index >> kChunkShift] + (index & kChunkMask);
+  }
+
+  void SegmentedArray::AddChunk() {
+    if (chunk_count_ == directory_capacity_) {
+      const int new_capacity = std::max(2 * directory_capacity_, 8);
+      int** directory = new int*[new_capacity];
+      std::copy(chunks_, chunks_ + chunk_count_, directory);
+      delete[] chunks_;
+      chunks_ = directory;
+      directory_capacity_ = new_capacity;
+    }
+    chunks_[chunk_count_] = new int[kChunkSize];
+    chunk_count_++;
+  }
+
+  void SegmentedArray::Swap(SegmentedArray& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(chunk_count_, other.chunk_count_);
+    std::swap(directory_capacity_, other.directory_capacity_);
+    std::swap(chunks_, other.chunks_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> SegmentedArray::toVector() const {
+    std::vector<int> values;
+    values.reserve(static_cast<std::size_t>(size_));
+    for (int index = 0; index < size_; index++) {
+      values.push_back(chunks_[index >> kChunkShift][index & kChunkMask]);
+    }
+    return values;
+  }
+
+}  // namespace assignment
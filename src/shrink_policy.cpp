@@ -0,0 +1,45 @@
+#include "assignment/shrink_policy.hpp"
+
+#include <algorithm>  // max, min
+#include <stdexcept>  // invalid_argument
+
+namespace assignment {
+
+  ShrinkPolicy ShrinkPolicy::None() {
+    return {};
+  }
+
+  ShrinkPolicy ShrinkPolicy::Hysteresis(int threshold, int factor, int min_capacity) {
+    if (factor < 2) {
+      throw std::invalid_argument("shrink factor is less than 2");
+    }
+    if (threshold <= factor) {
+      throw std::invalid_argument("shrink threshold does not exceed shrink factor");
+    }
+    if (min_capacity <= 0) {
+      throw std::invalid_argument("min capacity is not positive");
+    }
+    ShrinkPolicy policy;
+    policy.enabled_ = true;
+    policy.threshold_ = threshold;
+    policy.factor_ = factor;
+    policy.min_capacity_ = min_capacity;
+    return policy;
+  }
+
+  int ShrinkPolicy::ShrinkCapacity(int size, int capacity) const {
+    if (!enabled_) {
+      return capacity;
+    }
+    int new_capacity = capacity;
+    while ((new_capacity > min_capacity_)&&(size < new_capacity / threshold_)) {
+      new_capacity /= factor_;
+    }
+    return std::min(capacity, std::max({new_capacity, min_capacity_, size}));
+  }
+
+  bool ShrinkPolicy::enabled() const {
+    return enabled_;
+  }
+
+}  // namespace assignment
@@ -0,0 +1,592 @@
+#include "assignment/simd.hpp"
+
+#include <array>             // array
+#include <atomic>            // atomic
+#include <cstddef>           // size_t
+#include <initializer_list>  // initializer_list
+#include <utility>           // integer_sequence
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define ASSIGNMENT_SIMD_X86 1
+  #include <immintrin.h>
+#endif
+
+namespace assignment::simd {
+
+  namespace {
+
+    using FindFn = int (*)(const int*, int, int);
+    using CountFn = int (*)(const int*, int, int);
+    using GatherFn = void (*)(const int*, const int*, int, int*);
+    using UnpackFn = void (*)(const std::uint32_t*, int, int, int*);
+    using CountPackedFn = int (*)(const std::uint32_t*, int, int, int);
+
+    // вычислительные ядра одного набора инструкций
+    struct Kernels {
+      FindFn find;
+      CountFn count;
+      GatherFn gather;
+      UnpackFn unpack;
+      CountPackedFn count_packed;
+    };
+
+    // кол-во полос упакованного блока и значений в одной полосе
+    constexpr int kPackedLanes = 4;
+    constexpr int kLaneSize = kPackedBlockSize / kPackedLanes;
+
+    constexpr std::uint32_t LowBitsMask(int bits) {
+      return bits == 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+    }
+
+    // смещение значения от опорного (разность по модулю 2^32)
+    std::uint32_t PackedDelta(const std::uint32_t* packed, int bits, int index) {
+      const int lane = index % kPackedLanes;
+      const int bit = (index / kPackedLanes) * bits;
+      const int word = bit / 32;
+      const int shift = bit % 32;
+
+      std::uint64_t window = packed[word * kPackedLanes + lane];
+      if (shift + bits > 32) {
+        window |= static_cast<std::uint64_t>(packed[(word + 1) * kPackedLanes + lane]) << 32;
+      }
+      return static_cast<std::uint32_t>(window >> shift) & LowBitsMask(bits);
+    }
+
+    // на сколько индексов вперед запрашивается предвыборка ячеек при выборке по индексам
+    constexpr int kGatherPrefetchDistance = 16;
+
+    inline void Prefetch([[maybe_unused]] const int* address) {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(address);
+#endif
+    }
+
+    int CountScalar(const int* data, int size, int value) {
+      int count = 0;
+      for (int i = 0; i < size; i++) {
+        count += data[i] == value ? 1 : 0;
+      }
+      return count;
+    }
+
+    int FindFirstScalar(const int* data, int size, int value) {
+      for (int i = 0; i < size; i++) {
+        if (data[i] == value) {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    void GatherScalar(const int* data, const int* indices, int count, int* out) {
+      for (int i = 0; i < count; i++) {
+        if (i + kGatherPrefetchDistance < count) {
+          Prefetch(data + indices[i + kGatherPrefetchDistance]);
+        }
+        out[i] = data[indices[i]];
+      }
+    }
+
+    // значение представимо смещением от опорного в bits бит
+    bool FitsPacked(int bits, int reference, int value) {
+      const std::uint32_t delta = static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(reference);
+      return delta <= LowBitsMask(bits);
+    }
+
+    int CountPackedScalar(const std::uint32_t* packed, int bits, int reference, int value) {
+      if (!FitsPacked(bits, reference, value)) {
+        return 0;
+      }
+      if (bits == 0) {
+        return kPackedBlockSize;
+      }
+      const std::uint32_t delta = static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(reference);
+      int count = 0;
+      for (int i = 0; i < kPackedBlockSize; i++) {
+        count += PackedDelta(packed, bits, i) == delta ? 1 : 0;
+      }
+      return count;
+    }
+
+    void UnpackScalar(const std::uint32_t* packed, int bits, int reference, int* out) {
+      const auto base = static_cast<std::uint32_t>(reference);
+      for (int i = 0; i < kPackedBlockSize; i++) {
+        out[i] = static_cast<int>(base + (bits == 0 ? 0u : PackedDelta(packed, bits, i)));
+      }
+    }
+
+#if defined(ASSIGNMENT_SIMD_X86)
+
+    // Ядра обрабатывают по 4 вектора за итерацию (сравнения независимы друг от друга),
+    // при наличии совпадения точная позиция определяется по маске первого совпавшего вектора.
+
+    __attribute__((target("sse2"))) int FindFirstSse2(const int* data, int size, int value) {
+      const __m128i needle = _mm_set1_epi32(value);
+      int i = 0;
+
+      for (; i + 16 <= size; i += 16) {
+        const __m128i eq0 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+        const __m128i eq1 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), needle);
+        const __m128i eq2 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 8)), needle);
+        const __m128i eq3 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12)), needle);
+
+        const __m128i any = _mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3));
+        if (_mm_movemask_epi8(any) != 0) {
+          const __m128i eqs[] = {eq0, eq1, eq2, eq3};
+          for (int k = 0; k < 4; k++) {
+            const int mask = _mm_movemask_ps(_mm_castsi128_ps(eqs[k]));
+            if (mask != 0) {
+              return i + 4 * k + __builtin_ctz(static_cast<unsigned>(mask));
+            }
+          }
+        }
+      }
+
+      for (; i + 4 <= size; i += 4) {
+        const __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+        const int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0) {
+          return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+      }
+
+      const int tail = FindFirstScalar(data + i, size - i, value);
+      return tail < 0 ? -1 : i + tail;
+    }
+
+    __attribute__((target("avx2"))) int FindFirstAvx2(const int* data, int size, int value) {
+      const __m256i needle = _mm256_set1_epi32(value);
+      int i = 0;
+
+      for (; i + 32 <= size; i += 32) {
+        const __m256i eq0 =
+            _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        const __m256i eq1 =
+            _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)), needle);
+        const __m256i eq2 =
+            _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16)), needle);
+        const __m256i eq3 =
+            _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 24)), needle);
+
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+        if (!_mm256_testz_si256(any, any)) {
+          const __m256i eqs[] = {eq0, eq1, eq2, eq3};
+          for (int k = 0; k < 4; k++) {
+            const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eqs[k]));
+            if (mask != 0) {
+              return i + 8 * k + __builtin_ctz(static_cast<unsigned>(mask));
+            }
+          }
+        }
+      }
+
+      for (; i + 8 <= size; i += 8) {
+        const __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0) {
+          return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+      }
+
+      const int tail = FindFirstScalar(data + i, size - i, value);
+      return tail < 0 ? -1 : i + tail;
+    }
+
+    __attribute__((target("avx512f"))) int FindFirstAvx512(const int* data, int size, int value) {
+      const __m512i needle = _mm512_set1_epi32(value);
+      int i = 0;
+
+      for (; i + 64 <= size; i += 64) {
+        const __mmask16 eq0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+        const __mmask16 eq1 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 16), needle);
+        const __mmask16 eq2 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 32), needle);
+        const __mmask16 eq3 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 48), needle);
+
+        if ((eq0 | eq1 | eq2 | eq3) != 0) {
+          const __mmask16 eqs[] = {eq0, eq1, eq2, eq3};
+          for (int k = 0; k < 4; k++) {
+            if (eqs[k] != 0) {
+              return i + 16 * k + __builtin_ctz(static_cast<unsigned>(eqs[k]));
+            }
+          }
+        }
+      }
+
+      // хвост обрабатывается маскированной загрузкой (без выхода за границы последовательности)
+      for (; i < size; i += 16) {
+        const int rest = size - i < 16 ? size - i : 16;
+        const auto load_mask = static_cast<__mmask16>((1U << rest) - 1U);
+        const __m512i chunk = _mm512_maskz_loadu_epi32(load_mask, data + i);
+        const __mmask16 eq = _mm512_mask_cmpeq_epi32_mask(load_mask, chunk, needle);
+        if (eq != 0) {
+          return i + __builtin_ctz(static_cast<unsigned>(eq));
+        }
+      }
+      return -1;
+    }
+
+    // Ядра подсчета накапливают маски совпадений (-1 на совпадение) в векторных счетчиках,
+    // горизонтальное сложение выполняется один раз в конце.
+
+    __attribute__((target("sse2"))) int CountSse2(const int* data, int size, int value) {
+      const __m128i needle = _mm_set1_epi32(value);
+      __m128i acc0 = _mm_setzero_si128();
+      __m128i acc1 = _mm_setzero_si128();
+      int i = 0;
+
+      for (; i + 8 <= size; i += 8) {
+        acc0 = _mm_sub_epi32(acc0, _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle));
+        acc1 = _mm_sub_epi32(acc1,
+                             _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), needle));
+      }
+
+      alignas(16) int lanes[4];
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi32(acc0, acc1));
+      return lanes[0] + lanes[1] + lanes[2] + lanes[3] + CountScalar(data + i, size - i, value);
+    }
+
+    __attribute__((target("avx2"))) int CountAvx2(const int* data, int size, int value) {
+      const __m256i needle = _mm256_set1_epi32(value);
+      __m256i acc0 = _mm256_setzero_si256();
+      __m256i acc1 = _mm256_setzero_si256();
+      int i = 0;
+
+      for (; i + 16 <= size; i += 16) {
+        acc0 = _mm256_sub_epi32(
+            acc0, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle));
+        acc1 = _mm256_sub_epi32(
+            acc1, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)), needle));
+      }
+
+      alignas(32) int lanes[8];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi32(acc0, acc1));
+      int count = 0;
+      for (int lane : lanes) {
+        count += lane;
+      }
+      return count + CountScalar(data + i, size - i, value);
+    }
+
+    __attribute__((target("avx512f,popcnt"))) int CountAvx512(const int* data, int size, int value) {
+      const __m512i needle = _mm512_set1_epi32(value);
+      int count = 0;
+      int i = 0;
+
+      for (; i + 16 <= size; i += 16) {
+        const __mmask16 eq = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+        count += __builtin_popcount(static_cast<unsigned>(eq));
+      }
+
+      if (i < size) {
+        const auto load_mask = static_cast<__mmask16>((1U << (size - i)) - 1U);
+        const __m512i chunk = _mm512_maskz_loadu_epi32(load_mask, data + i);
+        const __mmask16 eq = _mm512_mask_cmpeq_epi32_mask(load_mask, chunk, needle);
+        count += __builtin_popcount(static_cast<unsigned>(eq));
+      }
+      return count;
+    }
+
+    // Выборка по индексам: аппаратная инструкция gather (8 ячеек за инструкцию)
+    // и предвыборка ячеек для индексов на kGatherPrefetchDistance позиций вперед.
+    // В SSE2 инструкции gather нет, используется скалярное ядро. Для AVX-512 используется ядро AVX2:
+    // 16-элементный gather выполняется процессором как два 8-элементных и не дает выигрыша.
+
+    __attribute__((target("avx2"))) void GatherAvx2(const int* data, const int* indices, int count, int* out) {
+      int i = 0;
+      for (; i + 8 <= count; i += 8) {
+        if (i + kGatherPrefetchDistance + 8 <= count) {
+          for (int k = 0; k < 8; k++) {
+            Prefetch(data + indices[i + kGatherPrefetchDistance + k]);
+          }
+        }
+        const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi32(data, index, 4));
+      }
+      GatherScalar(data, indices + i, count - i, out + i);
+    }
+
+    // Распаковка: один вектор SSE2 содержит по одному слову каждой из 4 полос, поэтому все полосы
+    // распаковываются одними и теми же сдвигами. Ширина значения - параметр шаблона: сдвиги и моменты
+    // загрузки следующего слова известны при компиляции, цикл разворачивается полностью.
+    // Подсчет выполняется над смещениями без сохранения распакованных значений в память.
+    // Более широкие наборы инструкций используют эти же ядра (блок укладывается в 4-полосную раскладку).
+
+    // Проход по смещениям блока: sink(pos, delta) получает смещения значений [4 * pos, 4 * pos + 4).
+    template <int Bits, typename Sink>
+    __attribute__((target("sse2"))) inline void ForEachPackedSse2(const std::uint32_t* packed, Sink& sink) {
+      if constexpr (Bits == 0) {
+        for (int pos = 0; pos < kLaneSize; pos++) {
+          sink(pos, _mm_setzero_si128());
+        }
+      } else {
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(LowBitsMask(Bits)));
+        const auto* src = reinterpret_cast<const __m128i*>(packed);
+        __m128i word = _mm_loadu_si128(src);
+
+#pragma GCC unroll 32
+        for (int pos = 0; pos < kLaneSize; pos++) {
+          const int shift = (pos * Bits) % 32;
+          __m128i delta = _mm_srli_epi32(word, shift);
+          if ((shift + Bits >= 32)&&(pos + 1 < kLaneSize)) {
+            // слово исчерпано, остаток значения - в младших битах следующего слова
+            src++;
+            word = _mm_loadu_si128(src);
+            if (shift + Bits > 32) {
+              delta = _mm_or_si128(delta, _mm_slli_epi32(word, 32 - shift));
+            }
+          }
+          if constexpr (Bits < 32) {
+            delta = _mm_and_si128(delta, mask);
+          }
+          sink(pos, delta);
+        }
+      }
+    }
+
+    // сохранение значений (смещение + опорное значение)
+    struct StoreSink {
+      __m128i base;
+      __m128i* dst;
+
+      __attribute__((target("sse2"))) void operator()(int pos, __m128i delta) {
+        _mm_storeu_si128(dst + pos, _mm_add_epi32(delta, base));
+      }
+    };
+
+    // подсчет смещений, равных искомому (сравнение дает -1 в совпавших полосах)
+    struct CountSink {
+      __m128i needle;
+      __m128i matches;
+
+      __attribute__((target("sse2"))) void operator()(int, __m128i delta) {
+        matches = _mm_sub_epi32(matches, _mm_cmpeq_epi32(delta, needle));
+      }
+    };
+
+    template <int Bits>
+    __attribute__((target("sse2"))) void UnpackSse2Bits(const std::uint32_t* packed, int reference, int* out) {
+      StoreSink sink{_mm_set1_epi32(reference), reinterpret_cast<__m128i*>(out)};
+      ForEachPackedSse2<Bits>(packed, sink);
+    }
+
+    template <int Bits>
+    __attribute__((target("sse2"))) int CountPackedSse2Bits(const std::uint32_t* packed, std::uint32_t delta) {
+      CountSink sink{_mm_set1_epi32(static_cast<int>(delta)), _mm_setzero_si128()};
+      ForEachPackedSse2<Bits>(packed, sink);
+
+      alignas(16) int lanes[kPackedLanes];
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes), sink.matches);
+      return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    using UnpackBitsFn = void (*)(const std::uint32_t*, int, int*);
+    using CountPackedBitsFn = int (*)(const std::uint32_t*, std::uint32_t);
+
+    template <int... Bits>
+    constexpr auto MakeUnpackTable(std::integer_sequence<int, Bits...>) {
+      return std::array<UnpackBitsFn, sizeof...(Bits)>{UnpackSse2Bits<Bits>...};
+    }
+
+    template <int... Bits>
+    constexpr auto MakeCountPackedTable(std::integer_sequence<int, Bits...>) {
+      return std::array<CountPackedBitsFn, sizeof...(Bits)>{CountPackedSse2Bits<Bits>...};
+    }
+
+    constexpr auto kUnpackSse2Table = MakeUnpackTable(std::make_integer_sequence<int, 33>{});
+    constexpr auto kCountPackedSse2Table = MakeCountPackedTable(std::make_integer_sequence<int, 33>{});
+
+    void UnpackSse2(const std::uint32_t* packed, int bits, int reference, int* out) {
+      kUnpackSse2Table[static_cast<std::size_t>(bits)](packed, reference, out);
+    }
+
+    int CountPackedSse2(const std::uint32_t* packed, int bits, int reference, int value) {
+      if (!FitsPacked(bits, reference, value)) {
+        return 0;
+      }
+      const std::uint32_t delta = static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(reference);
+      return kCountPackedSse2Table[static_cast<std::size_t>(bits)](packed, delta);
+    }
+
+#endif  // ASSIGNMENT_SIMD_X86
+
+    constexpr Kernels kScalarKernels{FindFirstScalar, CountScalar, GatherScalar, UnpackScalar, CountPackedScalar};
+#if defined(ASSIGNMENT_SIMD_X86)
+    constexpr Kernels kSse2Kernels{FindFirstSse2, CountSse2, GatherScalar, UnpackSse2, CountPackedSse2};
+    constexpr Kernels kAvx2Kernels{FindFirstAvx2, CountAvx2, GatherAvx2, UnpackSse2, CountPackedSse2};
+    constexpr Kernels kAvx512Kernels{FindFirstAvx512, CountAvx512, GatherAvx2, UnpackSse2, CountPackedSse2};
+#endif
+
+    const Kernels* KernelsFor(Isa isa) {
+      if (!IsSupported(isa)) {
+        return &kScalarKernels;
+      }
+      switch (isa) {
+#if defined(ASSIGNMENT_SIMD_X86)
+        case Isa::kSse2:
+          return &kSse2Kernels;
+        case Isa::kAvx2:
+          return &kAvx2Kernels;
+        case Isa::kAvx512:
+          return &kAvx512Kernels;
+#endif
+        default:
+          return &kScalarKernels;
+      }
+    }
+
+    Isa DetectIsa() {
+      for (Isa isa : {Isa::kAvx512, Isa::kAvx2, Isa::kSse2}) {
+        if (IsSupported(isa)) {
+          return isa;
+        }
+      }
+      return Isa::kScalar;
+    }
+
+    int ResolveAndFindFirst(const int* data, int size, int value);
+    int ResolveAndCount(const int* data, int size, int value);
+    void ResolveAndGather(const int* data, const int* indices, int count, int* out);
+    void ResolveAndUnpack(const std::uint32_t* packed, int bits, int reference, int* out);
+    int ResolveAndCountPacked(const std::uint32_t* packed, int bits, int reference, int value);
+
+    constexpr Kernels kResolvingKernels{ResolveAndFindFirst, ResolveAndCount, ResolveAndGather, ResolveAndUnpack,
+                                        ResolveAndCountPacked};
+
+    // Указатель на выбранные ядра. Инициализируется константой (до любой динамической инициализации),
+    // поэтому FindFirst и Count корректны и при вызове из статических конструкторов других единиц трансляции.
+    std::atomic<const Kernels*> active_kernels{&kResolvingKernels};
+
+    const Kernels* Resolve() {
+      const Kernels* kernels = KernelsFor(DetectIsa());
+      active_kernels.store(kernels, std::memory_order_relaxed);
+      return kernels;
+    }
+
+    int ResolveAndFindFirst(const int* data, int size, int value) {
+      return Resolve()->find(data, size, value);
+    }
+
+    int ResolveAndCount(const int* data, int size, int value) {
+      return Resolve()->count(data, size, value);
+    }
+
+    void ResolveAndGather(const int* data, const int* indices, int count, int* out) {
+      Resolve()->gather(data, indices, count, out);
+    }
+
+    void ResolveAndUnpack(const std::uint32_t* packed, int bits, int reference, int* out) {
+      Resolve()->unpack(packed, bits, reference, out);
+    }
+
+    int ResolveAndCountPacked(const std::uint32_t* packed, int bits, int reference, int value) {
+      return Resolve()->count_packed(packed, bits, reference, value);
+    }
+
+    // выбор ядер при загрузке программы
+    [[maybe_unused]] const bool kernels_resolved = Resolve() != nullptr;
+
+  }  // namespace
+
+  int FindFirst(const int* data, int size, int value) {
+    return active_kernels.load(std::memory_order_relaxed)->find(data, size, value);
+  }
+
+  int FindFirst(Isa isa, const int* data, int size, int value) {
+    return KernelsFor(isa)->find(data, size, value);
+  }
+
+  int Count(const int* data, int size, int value) {
+    return active_kernels.load(std::memory_order_relaxed)->count(data, size, value);
+  }
+
+  int Count(Isa isa, const int* data, int size, int value) {
+    return KernelsFor(isa)->count(data, size, value);
+  }
+
+  void Gather(const int* data, const int* indices, int count, int* out) {
+    active_kernels.load(std::memory_order_relaxed)->gather(data, indices, count, out);
+  }
+
+  void Gather(Isa isa, const int* data, const int* indices, int count, int* out) {
+    KernelsFor(isa)->gather(data, indices, count, out);
+  }
+
+  void Pack(const int* values, int bits, int reference, std::uint32_t* packed) {
+    const int words = kPackedLanes * bits;
+    for (int i = 0; i < words; i++) {
+      packed[i] = 0;
+    }
+    const auto base = static_cast<std::uint32_t>(reference);
+    for (int i = 0; (bits > 0)&&(i < kPackedBlockSize); i++) {
+      const std::uint32_t delta = static_cast<std::uint32_t>(values[i]) - base;
+      const int lane = i % kPackedLanes;
+      const int bit = (i / kPackedLanes) * bits;
+      const int word = bit / 32;
+      const int shift = bit % 32;
+
+      packed[word * kPackedLanes + lane] |= delta << shift;
+      if (shift + bits > 32) {
+        packed[(word + 1) * kPackedLanes + lane] |= delta >> (32 - shift);
+      }
+    }
+  }
+
+  void Unpack(const std::uint32_t* packed, int bits, int reference, int* out) {
+    active_kernels.load(std::memory_order_relaxed)->unpack(packed, bits, reference, out);
+  }
+
+  void Unpack(Isa isa, const std::uint32_t* packed, int bits, int reference, int* out) {
+    KernelsFor(isa)->unpack(packed, bits, reference, out);
+  }
+
+  int CountPacked(const std::uint32_t* packed, int bits, int reference, int value) {
+    return active_kernels.load(std::memory_order_relaxed)->count_packed(packed, bits, reference, value);
+  }
+
+  int CountPacked(Isa isa, const std::uint32_t* packed, int bits, int reference, int value) {
+    return KernelsFor(isa)->count_packed(packed, bits, reference, value);
+  }
+
+  int UnpackAt(const std::uint32_t* packed, int bits, int reference, int index) {
+    const std::uint32_t delta = bits == 0 ? 0u : PackedDelta(packed, bits, index);
+    return static_cast<int>(static_cast<std::uint32_t>(reference) + delta);
+  }
+
+  bool IsSupported(Isa isa) {
+    switch (isa) {
+      case Isa::kScalar:
+        return true;
+#if defined(ASSIGNMENT_SIMD_X86)
+      case Isa::kSse2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+      case Isa::kAvx2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+      case Isa::kAvx512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+#endif
+      default:
+        return false;
+    }
+  }
+
+  Isa ActiveIsa() {
+    return DetectIsa();
+  }
+
+  const char* ToString(Isa isa) {
+    switch (isa) {
+      case Isa::kSse2:
+        return "sse2";
+      case Isa::kAvx2:
+        return "avx2";
+      case Isa::kAvx512:
+        return "avx512";
+      default:
+        return "scalar";
+    }
+  }
+
+}  // namespace assignment::simd
@@ -0,0 +1,306 @@
+#include "assignment/skip_list.hpp"
+
+#include <algorithm>  // max, swap_ranges
+#include <new>        // placement new
+#include <stdexcept>  // invalid_argument
+#include <utility>    // move, swap
+
+namespace assignment {
+
+  SkipList::SkipList(std::pmr::memory_resource* resource) : resource_{resource} {
+    if (resource == nullptr) {
+      throw std::invalid_argument("memory resource is null");
+    }
+  }
+
+  SkipList::SkipList(const SkipList& other) : List(), resource_{other.resource_} {
+    for (const SkipNode* node = other.head_[0].next; node != nullptr; node = other.Links(node)[0].next) {
+      Add(node->value);
+    }
+  }
+
+  SkipList& SkipList::operator=(const SkipList& other) {
+    if (this != &other) {
+      SkipList copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  SkipList::SkipList(SkipList&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  SkipList& SkipList::operator=(SkipList&& other) noexcept {
+    if (this != &other) {
+      SkipList moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  SkipList::~SkipList() {
+    SkipList::Clear();
+  }
+
+  void SkipList::Add(int value) {
+    SkipNode* node = CreateNode(value);
+    const int rank = size_ + 1;
+
+    // новый узел становится последним на каждом своем уровне (неиспользуемые уровни заканчиваются в начале списка)
+    level_ = std::max(level_, node->height);
+    for (int level = 0; level < node->height; level++) {
+      Link& prev = Links(tails_[level])[level];
+      prev.next = node;
+      prev.span = rank - tail_ranks_[level];
+      tails_[level] = node;
+      tail_ranks_[level] = rank;
+    }
+    size_++;
+  }
+
+  bool SkipList::Insert(int index, int value) {
+    if ((index < 0)||(index > size_)) {
+      return false;
+    }
+    if (index == size_) {
+      Add(value);
+      return true;
+    }
+
+    SkipNode* update[kMaxLevel];
+    int ranks[kMaxLevel];
+    FindPredecessors(index, update, ranks);
+
+    SkipNode* node = CreateNode(value);
+    for (int level = level_; level < node->height; level++) {
+      update[level] = nullptr;
+      ranks[level] = 0;
+    }
+    level_ = std::max(level_, node->height);
+
+    // последние узлы уровней после позиции вставки сдвигаются на одну позицию
+    for (int level = 0; level < level_; level++) {
+      if (tail_ranks_[level] > index) {
+        tail_ranks_[level]++;
+      }
+    }
+
+    Link* links = Links(node);
+    for (int level = 0; level < level_; level++) {
+      Link& prev = Links(update[level])[level];
+      if (level >= node->height) {
+        // связь перескакивает через новый узел
+        prev.span++;
+        continue;
+      }
+      links[level].next = prev.next;
+      links[level].span = prev.span - (index - ranks[level]);
+      prev.next = node;
+      prev.span = index - ranks[level] + 1;
+      if (links[level].next == nullptr) {
+        tails_[level] = node;
+        tail_ranks_[level] = index + 1;
+      }
+    }
+    size_++;
+    return true;
+  }
+
+  bool SkipList::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size_)) {
+      return false;
+    }
+    FindNode(index)->value = new_value;
+    return true;
+  }
+
+  std::optional<int> SkipList::Remove(int index) {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+
+    SkipNode* update[kMaxLevel];
+    int ranks[kMaxLevel];
+    FindPredecessors(index, update, ranks);
+
+    SkipNode* node = Links(update[0])[0].next;
+    const Link* links = Links(node);
+    for (int level = 0; level < level_; level++) {
+      Link& prev = Links(update[level])[level];
+      if (prev.next == node) {
+        prev.next = links[level].next;
+        prev.span += links[level].span - 1;
+      } else {
+        prev.span--;
+      }
+
+      if (tails_[level] == node) {
+        tails_[level] = update[level];
+        tail_ranks_[level] = ranks[level];
+      } else if (tail_ranks_[level] > index + 1) {
+        tail_ranks_[level]--;
+      }
+    }
+
+    while ((level_ > 1)&&(head_[level_ - 1].next == nullptr)) {
+      level_--;
+    }
+
+    const int removed = node->value;
+    DestroyNode(node);
+    size_--;
+    return removed;
+  }
+
+  void SkipList::Clear() {
+    SkipNode* node = head_[0].next;
+    while (node != nullptr) {
+      SkipNode* next = Links(node)[0].next;
+      DestroyNode(node);
+      node = next;
+    }
+    for (int level = 0; level < kMaxLevel; level++) {
+      head_[level] = Link{nullptr, 0};
+      tails_[level] = nullptr;
+      tail_ranks_[level] = 0;
+    }
+    size_ = 0;
+    level_ = 1;
+  }
+
+  std::optional<int> SkipList::Get(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    return FindNode(index)->value;
+  }
+
+  std::optional<int> SkipList::IndexOf(int value) const {
+    int index = 0;
+    for (const SkipNode* node = head_[0].next; node != nullptr; node = Links(node)[0].next) {
+      if (node->value == value) {
+        return index;
+      }
+      index++;
+    }
+    return std::nullopt;
+  }
+
+  bool SkipList::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool SkipList::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int SkipList::size() const {
+    return size_;
+  }
+
+  int SkipList::level() const {
+    return level_;
+  }
+
+  std::optional<int> SkipList::front() const {
+    if (head_[0].next == nullptr) {
+      return std::nullopt;
+    }
+    return head_[0].next->value;
+  }
+
+  std::optional<int> SkipList::back() const {
+    if (tails_[0] == nullptr) {
+      return std::nullopt;
+    }
+    return tails_[0]->value;
+  }
+
+  std::size_t SkipList::NodeBytes(int height) {
+    return sizeof(SkipNode) + static_cast<std::size_t>(height) * sizeof(Link);
+  }
+
+  SkipList::Link* SkipList::Links(SkipNode* node) {
+    return node == nullptr ? head_ : reinterpret_cast<Link*>(node + 1);
+  }
+
+  const SkipList::Link* SkipList::Links(const SkipNode* node) const {
+    return node == nullptr ? head_ : reinterpret_cast<const Link*>(node + 1);
+  }
+
+  SkipList::SkipNode* SkipList::FindNode(int index) const {
+    SkipNode* node = nullptr;
+    int rank = 0;
+    for (int level = level_ - 1; level >= 0; level--) {
+      const Link* links = Links(node);
+      while ((links[level].next != nullptr)&&(rank + links[level].span <= index + 1)) {
+        rank += links[level].span;
+        node = links[level].next;
+        links = Links(node);
+      }
+    }
+    return node;
+  }
+
+  void SkipList::FindPredecessors(int index, SkipNode** update, int* ranks) const {
+    SkipNode* node = nullptr;
+    int rank = 0;
+    for (int level = level_ - 1; level >= 0; level--) {
+      const Link* links = Links(node);
+      while ((links[level].next != nullptr)&&(rank + links[level].span <= index)) {
+        rank += links[level].span;
+        node = links[level].next;
+        links = Links(node);
+      }
+      update[level] = node;
+      ranks[level] = rank;
+    }
+  }
+
+  SkipList::SkipNode* SkipList::CreateNode(int value) {
+    // xorshift32: каждая пара младших нулевых битов - следующий уровень (вероятность 1/4)
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    std::uint32_t bits = random_state_;
+    int height = 1;
+    while ((height < kMaxLevel)&&((bits & 3u) == 0)) {
+      height++;
+      bits >>= 2;
+    }
+
+    void* memory = resource_->allocate(NodeBytes(height), alignof(Link));
+    auto* node = new (memory) SkipNode{value, height};
+    Link* links = Links(node);
+    for (int level = 0; level < height; level++) {
+      new (links + level) Link{nullptr, 0};
+    }
+    return node;
+  }
+
+  void SkipList::DestroyNode(SkipNode* node) {
+    resource_->deallocate(node, NodeBytes(node->height), alignof(Link));
+  }
+
+  void SkipList::Swap(SkipList& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(level_, other.level_);
+    std::swap_ranges(head_, head_ + kMaxLevel, other.head_);
+    std::swap_ranges(tails_, tails_ + kMaxLevel, other.tails_);
+    std::swap_ranges(tail_ranks_, tail_ranks_ + kMaxLevel, other.tail_ranks_);
+    std::swap(random_state_, other.random_state_);
+    std::swap(resource_, other.resource_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> SkipList::toVector() const {
+    std::vector<int> values;
+    values.reserve(static_cast<std::size_t>(size_));
+    for (const SkipNode* node = head_[0].next; node != nullptr; node = Links(node)[0].next) {
+      values.push_back(node->value);
+    }
+    return values;
+  }
+
+}  // namespace assignment
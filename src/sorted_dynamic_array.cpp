@@ -0,0 +1,169 @@
+#include "assignment/sorted_dynamic_array.hpp"
+
+#include <algorithm>   // copy, inplace_merge, max, sort
+#include <functional>  // less, less_equal
+#include <memory>      // unique_ptr
+#include <utility>     // move
+
+namespace assignment {
+
+  namespace {
+
+    // указатель ptr находится внутри блока памяти [begin, end)
+    bool PointsInto(const int* ptr, const int* begin, const int* end) {
+      return std::less_equal<const int*>{}(begin, ptr) && std::less<const int*>{}(ptr, end);
+    }
+
+    // наименьшая длина диапазона поиска, при которой подгружаются середины следующего шага
+    // (в более коротком диапазоне обе середины лежат в уже загруженных кэш-линиях)
+    constexpr int kPrefetchMinLength = 64;
+
+    /**
+     * Двоичный поиск первого элемента, для которого less(element, value) ложно ~ O(log n).
+     *
+     * На каждом шаге диапазон уменьшается вдвое условной пересылкой указателя (без ветвления),
+     * кол-во итераций зависит только от размера последовательности.
+     * Пока диапазон не короче kPrefetchMinLength, заранее подгружаются обе возможные середины следующего шага
+     * (последовательности короче kPrefetchMinLength просматриваются без подгрузки).
+     */
+    template <typename Less>
+    int BranchlessBound(const int* data, int size, int value, Less less) {
+      if (size == 0) {
+        return 0;
+      }
+      const int* base = data;
+      int length = size;
+      while (length > 1) {
+        const int half = length / 2;
+#if defined(__GNUC__) || defined(__clang__)
+        if (length >= kPrefetchMinLength) {
+          __builtin_prefetch(base + half / 2);
+          __builtin_prefetch(base + half + half / 2);
+        }
+#endif
+        base = less(base[half], value) ? base + half : base;
+        length -= half;
+      }
+      return static_cast<int>(base - data) + (less(*base, value) ? 1 : 0);
+    }
+
+  }  // namespace
+
+  SortedDynamicArray::SortedDynamicArray(int capacity, GrowthPolicy growth_policy)
+      : data_{capacity, std::move(growth_policy)} {}
+
+  int SortedDynamicArray::InsertSorted(int value) {
+    const int index = UpperBound(value);
+    data_.Insert(index, value);
+    return index;
+  }
+
+  bool SortedDynamicArray::InsertSorted(const int* values, int count) {
+    if ((count < 0)||((values == nullptr) && (count > 0))) {
+      return false;
+    }
+    // последовательность внутри буфера массива будет высвобождена при расширении - копируем заранее
+    std::unique_ptr<int[]> aliased;
+    if ((count > 0) && PointsInto(values, data_.data(), data_.data() + data_.capacity())) {
+      aliased.reset(new int[static_cast<std::size_t>(count)]);
+      std::copy(values, values + count, aliased.get());
+      values = aliased.get();
+    }
+
+    const int middle = data_.size();
+    if (count > data_.capacity() - middle) {
+      data_.Resize(middle + count);
+    }
+    for (int i = 0; i < count; i++) {
+      data_.Add(values[i]);
+    }
+    int* first = data_.data();
+    std::sort(first + middle, first + data_.size());
+    std::inplace_merge(first, first + middle, first + data_.size());
+    return true;
+  }
+
+  std::optional<int> SortedDynamicArray::Remove(int index) {
+    return data_.Remove(index);
+  }
+
+  bool SortedDynamicArray::RemoveValue(int value) {
+    const auto index = IndexOf(value);
+    if (!index.has_value()) {
+      return false;
+    }
+    data_.Remove(index.value());
+    return true;
+  }
+
+  void SortedDynamicArray::Clear() {
+    data_.Clear();
+  }
+
+  int SortedDynamicArray::LowerBound(int value) const {
+    return BranchlessBound(data_.data(), data_.size(), value, [](int element, int v) {
+      return element < v;
+    });
+  }
+
+  int SortedDynamicArray::UpperBound(int value) const {
+    return BranchlessBound(data_.data(), data_.size(), value, [](int element, int v) {
+      return element <= v;
+    });
+  }
+
+  std::optional<int> SortedDynamicArray::Get(int index) const {
+    return data_.Get(index);
+  }
+
+  std::optional<int> SortedDynamicArray::IndexOf(int value) const {
+    const int index = LowerBound(value);
+    if ((index == data_.size())||(data_[index] != value)) {
+      return std::nullopt;
+    }
+    return index;
+  }
+
+  bool SortedDynamicArray::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool SortedDynamicArray::IsEmpty() const {
+    return data_.IsEmpty();
+  }
+
+  int SortedDynamicArray::size() const {
+    return data_.size();
+  }
+
+  int SortedDynamicArray::capacity() const {
+    return data_.capacity();
+  }
+
+  const int* SortedDynamicArray::data() const {
+    return data_.data();
+  }
+
+  SortedDynamicArray::const_iterator SortedDynamicArray::begin() const {
+    return data_.begin();
+  }
+
+  SortedDynamicArray::const_iterator SortedDynamicArray::end() const {
+    return data_.end();
+  }
+
+  Span<const int> SortedDynamicArray::span() const {
+    return data_.span();
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  SortedDynamicArray::SortedDynamicArray(const std::vector<int>& values)
+      : SortedDynamicArray(std::max(static_cast<int>(values.size()), 1)) {
+    InsertSorted(values.data(), static_cast<int>(values.size()));
+  }
+
+  std::vector<int> SortedDynamicArray::toVector() const {
+    return {data_.data(), data_.data() + data_.size()};
+  }
+
+}  // namespace assignment
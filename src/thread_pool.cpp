@@ -0,0 +1,94 @@
+#include "assignment/thread_pool.hpp"
+
+#include <stdexcept>  // invalid_argument
+
+namespace assignment {
+
+  ThreadPool::ThreadPool(int threads) {
+    if (threads <= 0) {
+      throw std::invalid_argument("thread count is not positive");
+    }
+    workers_.reserve(static_cast<std::size_t>(threads - 1));
+    for (int i = 1; i < threads; i++) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  ThreadPool::~ThreadPool() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void ThreadPool::ParallelFor(int count, const Task& task) {
+    if (count <= 0) {
+      return;
+    }
+    if ((workers_.empty())||(count == 1)) {
+      for (int i = 0; i < count; i++) {
+        task(i);
+      }
+      return;
+    }
+
+    const std::lock_guard<std::mutex> run_lock(run_mutex_);
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      task_ = &task;
+      tasks_ = count;
+      next_.store(0, std::memory_order_relaxed);
+      active_ = static_cast<int>(workers_.size());
+      generation_++;
+    }
+    wake_.notify_all();
+
+    RunTasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    task_ = nullptr;
+  }
+
+  int ThreadPool::size() const {
+    return static_cast<int>(workers_.size()) + 1;
+  }
+
+  int ThreadPool::DefaultThreads() {
+    const unsigned threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : static_cast<int>(threads);
+  }
+
+  void ThreadPool::RunTasks() {
+    for (int i = next_.fetch_add(1, std::memory_order_relaxed); i < tasks_;
+         i = next_.fetch_add(1, std::memory_order_relaxed)) {
+      (*task_)(i);
+    }
+  }
+
+  void ThreadPool::WorkerLoop() {
+    unsigned seen_generation = 0;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [&] { return stop_ || (generation_ != seen_generation); });
+      if (stop_) {
+        return;
+      }
+      seen_generation = generation_;
+
+      lock.unlock();
+      RunTasks();
+      lock.lock();
+
+      if (--active_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+
+}  // namespace assignment
@@ -0,0 +1,251 @@
+#include "assignment/tiered_vector.hpp"
+
+#include <algorithm>  // copy, max, min
+#include <utility>    // move, swap
+
+#include "assignment/simd.hpp"  // FindFirst
+
+namespace assignment {
+
+  TieredVector::TieredVector(const TieredVector& other) : List() {
+    shift_ = other.shift_;
+    for (int index = 0; index < other.size_; index++) {
+      Add(other.At(index));
+    }
+  }
+
+  TieredVector::TieredVector(TieredVector&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  TieredVector& TieredVector::operator=(const TieredVector& other) {
+    if (this != &other) {
+      TieredVector copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  TieredVector& TieredVector::operator=(TieredVector&& other) noexcept {
+    if (this != &other) {
+      TieredVector moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  TieredVector::~TieredVector() {
+    Release();
+  }
+
+  void TieredVector::Add(int value) {
+    Reserve();
+    At(size_) = value;
+    size_++;
+  }
+
+  bool TieredVector::Insert(int index, int value) {
+    if ((index < 0)||(index > size_)) {
+      return false;
+    }
+    Reserve();
+
+    const int mask = (1 << shift_) - 1;
+    const int first = index >> shift_;
+    const int last = size_ >> shift_;
+
+    // последний элемент каждого полного блока переносится в начало следующего блока
+    for (int k = last; k > first; k--) {
+      const Block& prev = blocks_[k - 1];
+      Block& block = blocks_[k];
+      block.head = (block.head - 1) & mask;
+      block.data[block.head] = prev.data[(prev.head + mask) & mask];
+    }
+
+    // сдвиг внутри блока в сторону ближайшего края
+    Block& block = blocks_[first];
+    const int count = first < last ? mask : size_ - (first << shift_);
+    const int pos = index & mask;
+    if (pos < count - pos) {
+      block.head = (block.head - 1) & mask;
+      for (int j = 0; j < pos; j++) {
+        block.data[(block.head + j) & mask] = block.data[(block.head + j + 1) & mask];
+      }
+    } else {
+      for (int j = count; j > pos; j--) {
+        block.data[(block.head + j) & mask] = block.data[(block.head + j - 1) & mask];
+      }
+    }
+    block.data[(block.head + pos) & mask] = value;
+    size_++;
+    return true;
+  }
+
+  bool TieredVector::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size_)) {
+      return false;
+    }
+    At(index) = new_value;
+    return true;
+  }
+
+  std::optional<int> TieredVector::Remove(int index) {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    const int mask = (1 << shift_) - 1;
+    const int first = index >> shift_;
+    const int last = (size_ - 1) >> shift_;
+
+    // сдвиг внутри блока со стороны ближайшего края
+    Block& block = blocks_[first];
+    const int count = first < last ? mask + 1 : size_ - (first << shift_);
+    const int pos = index & mask;
+    const int removed = block.data[(block.head + pos) & mask];
+    if (pos < count - 1 - pos) {
+      for (int j = pos; j > 0; j--) {
+        block.data[(block.head + j) & mask] = block.data[(block.head + j - 1) & mask];
+      }
+      block.head = (block.head + 1) & mask;
+    } else {
+      for (int j = pos; j < count - 1; j++) {
+        block.data[(block.head + j) & mask] = block.data[(block.head + j + 1) & mask];
+      }
+    }
+
+    // первый элемент каждого следующего блока переносится в конец предыдущего блока
+    for (int k = first + 1; k <= last; k++) {
+      Block& prev = blocks_[k - 1];
+      Block& next = blocks_[k];
+      prev.data[(prev.head + mask) & mask] = next.data[next.head];
+      next.head = (next.head + 1) & mask;
+    }
+    size_--;
+
+    // не более одного запасного блока
+    const int used = (size_ + mask) >> shift_;
+    if (block_count_ > used + 1) {
+      block_count_--;
+      delete[] blocks_[block_count_].data;
+    }
+
+    if ((shift_ > kMinBlockShift)&&(static_cast<long long>(size_) < (1LL << (2 * shift_)) / 8)) {
+      Rebuild(shift_ - 1);
+    }
+    return removed;
+  }
+
+  void TieredVector::Clear() {
+    Release();
+    shift_ = kMinBlockShift;
+  }
+
+  std::optional<int> TieredVector::Get(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    return At(index);
+  }
+
+  std::optional<int> TieredVector::IndexOf(int value) const {
+    const int block_size = 1 << shift_;
+    for (int k = 0; (k << shift_) < size_; k++) {
+      const Block& block = blocks_[k];
+      const int count = std::min(block_size, size_ - (k << shift_));
+      const int head_count = std::min(count, block_size - block.head);
+
+      int found = simd::FindFirst(block.data + block.head, head_count, value);
+      if (found < 0) {
+        found = simd::FindFirst(block.data, count - head_count, value);
+        if (found >= 0) {
+          found += head_count;
+        }
+      }
+      if (found >= 0) {
+        return (k << shift_) + found;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool TieredVector::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool TieredVector::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int TieredVector::size() const {
+    return size_;
+  }
+
+  int TieredVector::block_size() const {
+    return 1 << shift_;
+  }
+
+  int& TieredVector::At(int index) const {
+    const int mask = (1 << shift_) - 1;
+    const Block& block = blocks_[index >> shift_];
+    return block.data[(block.head + (index & mask)) & mask];
+  }
+
+  void TieredVector::Reserve() {
+    // кол-во блоков не превышает 2B
+    if (static_cast<long long>(size_) >= (2LL << (2 * shift_))) {
+      Rebuild(shift_ + 1);
+    }
+    if (size_ < (block_count_ << shift_)) {
+      return;
+    }
+    if (block_count_ == directory_capacity_) {
+      const int new_capacity = std::max(2 * directory_capacity_, 8);
+      auto* directory = new Block[new_capacity];
+      std::copy(blocks_, blocks_ + block_count_, directory);
+      delete[] blocks_;
+      blocks_ = directory;
+      directory_capacity_ = new_capacity;
+    }
+    blocks_[block_count_] = Block{new int[1 << shift_], 0};
+    block_count_++;
+  }
+
+  void TieredVector::Rebuild(int new_shift) {
+    TieredVector rebuilt;
+    rebuilt.shift_ = new_shift;
+    for (int index = 0; index < size_; index++) {
+      rebuilt.Add(At(index));
+    }
+    Swap(rebuilt);
+  }
+
+  void TieredVector::Release() {
+    for (int k = 0; k < block_count_; k++) {
+      delete[] blocks_[k].data;
+    }
+    delete[] blocks_;
+    blocks_ = nullptr;
+    block_count_ = 0;
+    directory_capacity_ = 0;
+    size_ = 0;
+  }
+
+  void TieredVector::Swap(TieredVector& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(shift_, other.shift_);
+    std::swap(block_count_, other.block_count_);
+    std::swap(directory_capacity_, other.directory_capacity_);
+    std::swap(blocks_, other.blocks_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> TieredVector::toVector() const {
+    std::vector<int> values;
+    values.reserve(static_cast<std::size_t>(size_));
+    for (int index = 0; index < size_; index++) {
+      values.push_back(At(index));
+    }
+    return values;
+  }
+
+}  // namespace assignment
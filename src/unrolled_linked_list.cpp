@@ -0,0 +1,271 @@
+#include "assignment/unrolled_linked_list.hpp"
+
+#include <algorithm>  // copy, min
+#include <cstring>    // memmove
+#include <utility>    // move, swap
+
+#include "assignment/simd.hpp"  // FindFirst
+
+namespace assignment {
+
+  UnrolledLinkedList::UnrolledLinkedList(std::pmr::memory_resource* resource) : pool_{resource} {}
+
+  UnrolledLinkedList::UnrolledLinkedList(const UnrolledLinkedList& other) : List(), pool_{other.pool_.resource()} {
+    for (const Chunk* chunk = other.front_; chunk != nullptr; chunk = chunk->next) {
+      for (int i = 0; i < chunk->size; i++) {
+        Add(chunk->values[i]);
+      }
+    }
+  }
+
+  UnrolledLinkedList& UnrolledLinkedList::operator=(const UnrolledLinkedList& other) {
+    if (this != &other) {
+      UnrolledLinkedList copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  UnrolledLinkedList::UnrolledLinkedList(UnrolledLinkedList&& other) noexcept : List() {
+    Swap(other);
+  }
+
+  UnrolledLinkedList& UnrolledLinkedList::operator=(UnrolledLinkedList&& other) noexcept {
+    if (this != &other) {
+      UnrolledLinkedList moved(std::move(other));
+      Swap(moved);
+    }
+    return *this;
+  }
+
+  UnrolledLinkedList::~UnrolledLinkedList() {
+    // узлы высвобождаются вместе с пулом
+    size_ = 0;
+    chunk_count_ = 0;
+    front_ = nullptr;
+    back_ = nullptr;
+  }
+
+  void UnrolledLinkedList::Add(int value) {
+    if ((back_ == nullptr)||(back_->size == kNodeCapacity)) {
+      InsertChunkAfter(back_);
+    }
+    back_->values[back_->size] = value;
+    back_->size++;
+    size_++;
+  }
+
+  bool UnrolledLinkedList::Insert(int index, int value) {
+    if ((index < 0)||(index > size_)) {
+      return false;
+    }
+    if (index == size_) {
+      Add(value);
+      return true;
+    }
+
+    Chunk* chunk = FindChunk(index);
+    if (chunk->size == kNodeCapacity) {
+      // деление заполненного узла: вторая половина значений переносится в новый узел
+      Chunk* half = InsertChunkAfter(chunk);
+      half->size = kNodeCapacity - kMinNodeSize;
+      std::copy(chunk->values + kMinNodeSize, chunk->values + kNodeCapacity, half->values);
+      chunk->size = kMinNodeSize;
+      if (index > kMinNodeSize) {
+        chunk = half;
+        index -= kMinNodeSize;
+      }
+    }
+
+    std::memmove(chunk->values + index + 1, chunk->values + index,
+                 static_cast<std::size_t>(chunk->size - index) * sizeof(int));
+    chunk->values[index] = value;
+    chunk->size++;
+    size_++;
+    return true;
+  }
+
+  bool UnrolledLinkedList::Set(int index, int new_value) {
+    if ((index < 0)||(index >= size_)) {
+      return false;
+    }
+    Chunk* chunk = FindChunk(index);
+    chunk->values[index] = new_value;
+    return true;
+  }
+
+  std::optional<int> UnrolledLinkedList::Remove(int index) {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    Chunk* prev = nullptr;
+    Chunk* chunk = FindChunk(index, &prev);
+    const int removed = chunk->values[index];
+
+    std::memmove(chunk->values + index, chunk->values + index + 1,
+                 static_cast<std::size_t>(chunk->size - index - 1) * sizeof(int));
+    chunk->size--;
+    size_--;
+    Rebalance(chunk, prev);
+    return removed;
+  }
+
+  void UnrolledLinkedList::Clear() {
+    pool_.Reset();
+    size_ = 0;
+    chunk_count_ = 0;
+    front_ = nullptr;
+    back_ = nullptr;
+  }
+
+  std::optional<int> UnrolledLinkedList::Get(int index) const {
+    if ((index < 0)||(index >= size_)) {
+      return std::nullopt;
+    }
+    const Chunk* chunk = FindChunk(index);
+    return chunk->values[index];
+  }
+
+  std::optional<int> UnrolledLinkedList::IndexOf(int value) const {
+    int offset = 0;
+    for (const Chunk* chunk = front_; chunk != nullptr; chunk = chunk->next) {
+      const int index = simd::FindFirst(chunk->values, chunk->size, value);
+      if (index >= 0) {
+        return offset + index;
+      }
+      offset += chunk->size;
+    }
+    return std::nullopt;
+  }
+
+  bool UnrolledLinkedList::Contains(int value) const {
+    return IndexOf(value).has_value();
+  }
+
+  bool UnrolledLinkedList::IsEmpty() const {
+    return size_ == 0;
+  }
+
+  int UnrolledLinkedList::size() const {
+    return size_;
+  }
+
+  int UnrolledLinkedList::chunk_count() const {
+    return chunk_count_;
+  }
+
+  const NodePool<UnrolledLinkedList::Chunk, 4>& UnrolledLinkedList::pool() const {
+    return pool_;
+  }
+
+  std::optional<int> UnrolledLinkedList::front() const {
+    if (front_ == nullptr) {
+      return std::nullopt;
+    }
+    return front_->values[0];
+  }
+
+  std::optional<int> UnrolledLinkedList::back() const {
+    if (back_ == nullptr) {
+      return std::nullopt;
+    }
+    return back_->values[back_->size - 1];
+  }
+
+  UnrolledLinkedList::Chunk* UnrolledLinkedList::FindChunk(int& index, Chunk** prev) const {
+    Chunk* before = nullptr;
+    Chunk* chunk = front_;
+    while (index >= chunk->size) {
+      index -= chunk->size;
+      before = chunk;
+      chunk = chunk->next;
+    }
+    if (prev != nullptr) {
+      *prev = before;
+    }
+    return chunk;
+  }
+
+  UnrolledLinkedList::Chunk* UnrolledLinkedList::InsertChunkAfter(Chunk* chunk) {
+    Chunk* created = pool_.New();
+    created->size = 0;
+    if (chunk == nullptr) {
+      created->next = nullptr;
+      if (back_ != nullptr) {
+        back_->next = created;
+      } else {
+        front_ = created;
+      }
+      back_ = created;
+    } else {
+      created->next = chunk->next;
+      chunk->next = created;
+      if (chunk == back_) {
+        back_ = created;
+      }
+    }
+    chunk_count_++;
+    return created;
+  }
+
+  void UnrolledLinkedList::RemoveChunkAfter(Chunk* prev) {
+    Chunk* removed = prev == nullptr ? front_ : prev->next;
+    if (prev == nullptr) {
+      front_ = removed->next;
+    } else {
+      prev->next = removed->next;
+    }
+    if (removed == back_) {
+      back_ = prev;
+    }
+    pool_.Delete(removed);
+    chunk_count_--;
+  }
+
+  void UnrolledLinkedList::Rebalance(Chunk* chunk, Chunk* prev) {
+    if (chunk->size >= kMinNodeSize) {
+      return;
+    }
+    Chunk* next = chunk->next;
+    if (next == nullptr) {
+      // конечный узел может быть заполнен меньше чем наполовину, удаляется только пустой
+      if (chunk->size == 0) {
+        RemoveChunkAfter(prev);
+      }
+      return;
+    }
+
+    if (chunk->size + next->size <= kNodeCapacity) {
+      // объединение со следующим узлом
+      std::copy(next->values, next->values + next->size, chunk->values + chunk->size);
+      chunk->size += next->size;
+      RemoveChunkAfter(chunk);
+    } else {
+      // перенос начала следующего узла: оба узла остаются заполненными не меньше чем наполовину
+      const int moved = (next->size - chunk->size) / 2;
+      std::copy(next->values, next->values + moved, chunk->values + chunk->size);
+      std::memmove(next->values, next->values + moved, static_cast<std::size_t>(next->size - moved) * sizeof(int));
+      chunk->size += moved;
+      next->size -= moved;
+    }
+  }
+
+  void UnrolledLinkedList::Swap(UnrolledLinkedList& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(chunk_count_, other.chunk_count_);
+    std::swap(front_, other.front_);
+    std::swap(back_, other.back_);
+    pool_.Swap(other.pool_);
+  }
+
+  // ДЛЯ ТЕСТИРОВАНИЯ
+  std::vector<int> UnrolledLinkedList::toVector() const {
+    std::vector<int> values;
+    values.reserve(static_cast<std::size_t>(size_));
+    for (const Chunk* chunk = front_; chunk != nullptr; chunk = chunk->next) {
+      values.insert(values.end(), chunk->values, chunk->values + chunk->size);
+    }
+    return values;
+  }
+
+}  // namespace assignment
@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>  // uintptr_t
+
+#include "utils.hpp"  // CountingResource
+
+#include "assignment/arena.hpp"  // MonotonicArena
+
+using assignment::MonotonicArena;
+using utils::CountingResource;
+
+SCENARIO("MonotonicArena::MonotonicArena") {
+
+  WHEN("creating arena with zero chunk size or null upstream") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(MonotonicArena(0));
+      CHECK_THROWS(MonotonicArena(64, nullptr));
+    }
+  }
+
+  AND_WHEN("creating arena") {
+    CountingResource upstream;
+    const MonotonicArena arena(64, &upstream);
+
+    THEN("memory should not be requested until the first allocation") {
+      CHECK(upstream.allocations == 0);
+      CHECK(arena.bytes_allocated() == 0);
+    }
+  }
+}
+
+SCENARIO("MonotonicArena::allocate") {
+
+  GIVEN("arena over a counting upstream resource") {
+    CountingResource upstream;
+    auto arena = MonotonicArena(256, &upstream);
+
+    WHEN("allocating blocks of different alignment") {
+      const std::size_t alignment = GENERATE(1u, 2u, 4u, 8u, 16u, 64u);
+
+      static_cast<void>(arena.allocate(1, 1));
+      void* ptr = arena.allocate(24, alignment);
+
+      THEN("block should be aligned") {
+        CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+      }
+    }
+
+    AND_WHEN("allocating many small blocks") {
+      for (int i = 0; i < 1000; i++) {
+        static_cast<void>(arena.allocate(sizeof(int), alignof(int)));
+      }
+
+      THEN("upstream should be asked for geometrically growing chunks") {
+        CHECK(upstream.allocations > 0);
+        CHECK(upstream.allocations <= 6);
+        CHECK(arena.bytes_allocated() == 1000 * sizeof(int));
+      }
+
+      AND_WHEN("deallocating a block") {
+        void* ptr = arena.allocate(sizeof(int), alignof(int));
+        arena.deallocate(ptr, sizeof(int), alignof(int));
+
+        THEN("memory should not be returned upstream") {
+          CHECK(upstream.deallocations == 0);
+        }
+      }
+
+      AND_WHEN("resetting the arena") {
+        const int allocations = upstream.allocations;
+        arena.Reset();
+
+        THEN("only the last chunk should be kept") {
+          CHECK(upstream.deallocations == allocations - 1);
+          CHECK(arena.bytes_allocated() == 0);
+        }
+
+        AND_WHEN("repeating the same allocations") {
+          for (int i = 0; i < 1000; i++) {
+            static_cast<void>(arena.allocate(sizeof(int), alignof(int)));
+          }
+          arena.Reset();
+          const int steady_allocations = upstream.allocations;
+
+          for (int i = 0; i < 1000; i++) {
+            static_cast<void>(arena.allocate(sizeof(int), alignof(int)));
+          }
+
+          THEN("upstream should not be asked for memory again") {
+            CHECK(upstream.allocations == steady_allocations);
+          }
+        }
+      }
+
+      AND_WHEN("releasing the arena") {
+        arena.Release();
+
+        THEN("all chunks should be returned upstream") {
+          CHECK(upstream.deallocations == upstream.allocations);
+          CHECK(arena.bytes_allocated() == 0);
+        }
+      }
+    }
+
+    AND_WHEN("allocating a block larger than the chunk size") {
+      void* ptr = arena.allocate(10'000, 8);
+
+      THEN("block should fit into a dedicated chunk") {
+        CHECK(ptr != nullptr);
+        CHECK(upstream.allocations == 1);
+      }
+    }
+  }
+
+  AND_GIVEN("destroyed arena") {
+    CountingResource upstream;
+    {
+      auto arena = MonotonicArena(64, &upstream);
+      for (int i = 0; i < 100; i++) {
+        static_cast<void>(arena.allocate(16, 8));
+      }
+    }
+
+    THEN("all chunks should be returned upstream") {
+      CHECK(upstream.allocations > 0);
+      CHECK(upstream.deallocations == upstream.allocations);
+    }
+  }
+}
@@ -2,6 +2,7 @@
 
 #include "utils.hpp"  // rand_array
 
+#include "assignment/arena.hpp"        // MonotonicArena
 #include "assignment/array_stack.hpp"  // ArrayStack
 
 using assignment::ArrayStack;
@@ -314,3 +315,227 @@ SCENARIO("ArrayStack::Clear") {
     }
   }
 }
+
+SCENARIO("ArrayStack::GrowthPolicy") {
+
+  GIVEN("stack full of elements with a geometric growth policy") {
+    const int capacity = GENERATE(range(2, 11));
+    const auto elems = utils::rand_array(capacity, 0, 100, true);
+
+    auto stack = ArrayStack(elems, capacity);
+    stack.set_growth_policy(assignment::GrowthPolicy::Geometric15());
+
+    REQUIRE(stack.size() == capacity);
+
+    WHEN("pushing an element") {
+      stack.Push(-1);
+
+      THEN("stack capacity should grow by half") {
+        CHECK(stack.capacity() == capacity + capacity / 2);
+      }
+
+      AND_THEN("previous elements should be present") {
+        CHECK_THAT(stack.toVector(capacity), Equals(elems));
+      }
+
+      AND_THEN("top should be equal to the pushed element") {
+        CHECK(stack.Peek() == -1);
+      }
+    }
+  }
+
+  AND_GIVEN("empty stack with a doubling growth policy") {
+    auto stack = ArrayStack(1, assignment::GrowthPolicy::Geometric2());
+
+    WHEN("pushing many elements") {
+      const auto elems = utils::rand_array(1000, 0, 100);
+
+      for (int elem : elems) {
+        stack.Push(elem);
+      }
+
+      THEN("capacity should be the closest power of two") {
+        CHECK(stack.capacity() == 1024);
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(stack.toVector(1000), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("ArrayStack::ShrinkPolicy") {
+
+  GIVEN("large stack with a hysteresis shrink policy") {
+    auto stack = ArrayStack(assignment::ShrinkPolicy::kDefaultMinCapacity, assignment::GrowthPolicy::Geometric2());
+    for (int i = 0; i < 1000; i++) {
+      stack.Push(i);
+    }
+    stack.set_shrink_policy(assignment::ShrinkPolicy::Hysteresis());
+
+    const int capacity = stack.capacity();
+
+    REQUIRE(capacity == 1280);
+
+    WHEN("popping elements until size < capacity / 4") {
+      while (stack.size() >= capacity / 4) {
+        stack.Pop();
+      }
+
+      THEN("capacity should be halved") {
+        CHECK(stack.capacity() == capacity / 2);
+        CHECK(stack.reclaimed_bytes() == static_cast<std::size_t>(capacity / 2) * sizeof(int));
+      }
+
+      AND_THEN("top should be preserved") {
+        CHECK(stack.Peek() == stack.size() - 1);
+      }
+
+      AND_WHEN("alternating push/pop around the shrink boundary") {
+        const int shrunk_capacity = stack.capacity();
+
+        for (int i = 0; i < 100; i++) {
+          stack.Push(i);
+          stack.Pop();
+        }
+
+        THEN("capacity should not be changed") {
+          CHECK(stack.capacity() == shrunk_capacity);
+        }
+      }
+    }
+
+    AND_WHEN("clearing the stack") {
+      stack.Clear();
+
+      THEN("capacity should drop to the minimal capacity") {
+        CHECK(stack.capacity() == assignment::ShrinkPolicy::kDefaultMinCapacity);
+      }
+    }
+  }
+
+  AND_GIVEN("stack with zero or more elements") {
+    const int capacity = GENERATE(range(1, 11));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto stack = ArrayStack(elems, capacity);
+
+    WHEN("shrinking the stack to fit") {
+      stack.ShrinkToFit();
+
+      THEN("capacity should be equal to size (at least 1)") {
+        CHECK(stack.capacity() == std::max(size, 1));
+        CHECK(stack.reclaimed_bytes() == static_cast<std::size_t>(capacity - stack.capacity()) * sizeof(int));
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(stack.toVector(size), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("ArrayStack::MemoryResource") {
+
+  WHEN("creating stack with a null memory resource") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(ArrayStack(10, nullptr));
+    }
+  }
+
+  AND_GIVEN("stack allocated from an arena") {
+    auto arena = assignment::MonotonicArena();
+    const auto elems = utils::rand_array(50, 0, 100);
+
+    auto stack = ArrayStack(5, &arena);
+    REQUIRE(stack.resource() == &arena);
+
+    WHEN("pushing elements past the capacity") {
+      for (int elem : elems) {
+        stack.Push(elem);
+      }
+
+      THEN("memory should be allocated from the arena") {
+        CHECK(arena.bytes_allocated() >= 50 * sizeof(int));
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(stack.toVector(stack.size()), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("ArrayStack copy and move") {
+
+  GIVEN("stack with zero or more elements") {
+    const int capacity = GENERATE(range(1, 8));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto stack = ArrayStack(elems, capacity);
+
+    WHEN("copying the stack") {
+      auto copy = stack;
+      copy.Push(-1);
+      stack.Clear();
+
+      THEN("copy should be independent") {
+        CHECK(copy.size() == size + 1);
+        CHECK(copy.Peek() == -1);
+        CHECK_THAT(copy.toVector(size), Equals(elems));
+      }
+    }
+
+    AND_WHEN("copy-assigning the stack") {
+      auto copy = ArrayStack();
+      copy = stack;
+
+      THEN("elements and capacity should be copied") {
+        CHECK_THAT(copy.toVector(), Equals(stack.toVector()));
+        CHECK(copy.capacity() == capacity);
+      }
+    }
+
+    AND_WHEN("moving the stack") {
+      auto moved = std::move(stack);
+
+      THEN("elements should be moved") {
+        CHECK_THAT(moved.toVector(size), Equals(elems));
+      }
+
+      AND_WHEN("reusing the moved-from stack") {
+        stack.Push(1);
+
+        THEN("it should behave as an empty stack") {
+          CHECK(stack.size() == 1);
+          CHECK(stack.Peek() == 1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("ArrayStack iterators") {
+
+  GIVEN("stack with zero or more elements") {
+    const int size = GENERATE(range(0, 11));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    const auto stack = ArrayStack(elems, size + 1);
+
+    WHEN("iterating over the stack") {
+      const std::vector<int> values(stack.begin(), stack.end());
+      const auto span = stack.span();
+
+      THEN("elements should be visited from bottom to top") {
+        CHECK_THAT(values, Equals(elems));
+        CHECK(span.size() == size);
+        CHECK(span.data() == stack.begin());
+      }
+    }
+  }
+}
@@ -0,0 +1,527 @@
+#include <catch2/catch.hpp>
+
+#include <memory>           // allocator, unique_ptr
+#include <memory_resource>  // polymorphic_allocator
+#include <stdexcept>        // runtime_error
+#include <string>           // string, to_string
+
+#include "utils.hpp"  // rand_array, CountingResource
+
+#include "assignment/basic_dynamic_array.hpp"  // BasicDynamicArray
+
+using assignment::BasicDynamicArray;
+using assignment::GrowthPolicy;
+using utils::CountingResource;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  // тип элементов, считающий копирования и перемещения
+  struct Tracked {
+    static inline int copies = 0;
+    static inline int moves = 0;
+    static inline int alive = 0;
+
+    int value{0};
+
+    explicit Tracked(int v) : value{v} {
+      alive++;
+    }
+
+    Tracked(const Tracked& other) : value{other.value} {
+      copies++;
+      alive++;
+    }
+
+    Tracked(Tracked&& other) noexcept : value{other.value} {
+      moves++;
+      alive++;
+    }
+
+    Tracked& operator=(const Tracked& other) {
+      value = other.value;
+      copies++;
+      return *this;
+    }
+
+    Tracked& operator=(Tracked&& other) noexcept {
+      value = other.value;
+      moves++;
+      return *this;
+    }
+
+    ~Tracked() {
+      alive--;
+    }
+
+    bool operator==(const Tracked& other) const {
+      return value == other.value;
+    }
+
+    static void Reset() {
+      copies = 0;
+      moves = 0;
+    }
+  };
+
+  // тип элементов, копирование и перемещение которого бросает исключение после заданного кол-ва операций
+  struct Throwing {
+    static inline int alive = 0;
+    static inline int countdown = -1;  // кол-во копирований/перемещений до исключения (-1 - без исключений)
+
+    int value{0};
+
+    explicit Throwing(int v) : value{v} {
+      alive++;
+    }
+
+    Throwing(const Throwing& other) : value{other.value} {
+      Tick();
+      alive++;
+    }
+
+    // перемещение не помечено noexcept: при расширении массива элементы копируются
+    Throwing(Throwing&& other) : value{other.value} {
+      Tick();
+      alive++;
+    }
+
+    Throwing& operator=(const Throwing& other) = default;
+
+    ~Throwing() {
+      alive--;
+    }
+
+    static void Tick() {
+      if (countdown == 0) {
+        throw std::runtime_error("copy failed");
+      }
+      if (countdown > 0) {
+        countdown--;
+      }
+    }
+  };
+
+  // аллокатор, считающий кол-во выделений памяти
+  template <typename T>
+  struct CountingAllocator {
+    using value_type = T;
+
+    int* allocations;
+
+    explicit CountingAllocator(int* counter) : allocations{counter} {}
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations{other.allocations} {}
+
+    T* allocate(std::size_t n) {
+      (*allocations)++;
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+      std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    bool operator==(const CountingAllocator& other) const {
+      return allocations == other.allocations;
+    }
+
+    bool operator!=(const CountingAllocator& other) const {
+      return allocations != other.allocations;
+    }
+  };
+
+  template <typename T, typename Allocator>
+  std::vector<int> Values(const BasicDynamicArray<T, Allocator>& array) {
+    std::vector<int> values;
+    for (int i = 0; i < array.size(); i++) {
+      values.push_back(array[i].value);
+    }
+    return values;
+  }
+
+}  // namespace
+
+SCENARIO("BasicDynamicArray::BasicDynamicArray") {
+
+  WHEN("creating array using default constructor") {
+    const auto array = BasicDynamicArray<std::string>();
+
+    THEN("array should be empty") {
+      CHECK(array.IsEmpty());
+    }
+
+    AND_THEN("array capacity should be equal to " << BasicDynamicArray<std::string>::kInitCapacity) {
+      CHECK(array.capacity() == BasicDynamicArray<std::string>::kInitCapacity);
+    }
+  }
+
+  AND_WHEN("creating array by specifying capacity <= 0") {
+    const int capacity = GENERATE(range(-5, 1));
+
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(BasicDynamicArray<int>(capacity));
+    }
+  }
+}
+
+SCENARIO("BasicDynamicArray::EmplaceBack") {
+
+  GIVEN("array of non-trivial elements") {
+    const int capacity = GENERATE(range(1, 6));
+    const auto elems = utils::rand_array(20, 0, 100);
+
+    auto array = BasicDynamicArray<Tracked>(capacity, GrowthPolicy::Geometric2());
+
+    WHEN("emplacing elements past the capacity") {
+      Tracked::Reset();
+
+      for (int elem : elems) {
+        array.EmplaceBack(elem);
+      }
+
+      THEN("elements should be preserved") {
+        CHECK_THAT(Values(array), Equals(elems));
+      }
+
+      AND_THEN("elements should never be copied") {
+        CHECK(Tracked::copies == 0);
+      }
+
+      AND_THEN("growth should move elements") {
+        CHECK(Tracked::moves > 0);
+      }
+    }
+
+    AND_WHEN("emplacing a copy of its own element at full capacity") {
+      for (int i = 0; i < capacity; i++) {
+        array.EmplaceBack(elems[i]);
+      }
+      REQUIRE(array.size() == array.capacity());
+
+      array.EmplaceBack(array[0]);
+
+      THEN("copy should have the value of the element") {
+        CHECK(array[capacity].value == elems[0]);
+      }
+    }
+  }
+
+  AND_GIVEN("array of move-only elements") {
+    auto array = BasicDynamicArray<std::unique_ptr<int>>(1);
+
+    WHEN("adding elements past the capacity") {
+      for (int i = 0; i < 50; i++) {
+        array.Add(std::make_unique<int>(i));
+      }
+
+      THEN("elements should be preserved") {
+        REQUIRE(array.size() == 50);
+        for (int i = 0; i < 50; i++) {
+          CHECK(*array[i] == i);
+        }
+      }
+
+      AND_THEN("removed element should be moved out") {
+        const auto removed = array.Remove(10);
+        REQUIRE(removed.has_value());
+        CHECK(**removed == 10);
+        CHECK(*array[10] == 11);
+      }
+    }
+  }
+}
+
+SCENARIO("BasicDynamicArray::Insert/Remove") {
+
+  GIVEN("array of strings") {
+    const int size = GENERATE(range(0, 8));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = BasicDynamicArray<std::string>(3);
+    auto expected = std::vector<std::string>();
+
+    for (int elem : elems) {
+      array.Add(std::to_string(elem));
+      expected.push_back(std::to_string(elem));
+    }
+
+    WHEN("inserting an element at index in [0, size]") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+
+      REQUIRE(array.Insert(index, "inserted"));
+      expected.insert(expected.begin() + index, "inserted");
+
+      THEN("element should be inserted at the specified index") {
+        REQUIRE(array.size() == size + 1);
+        for (int i = 0; i <= size; i++) {
+          CHECK(array.Get(i) == expected[static_cast<std::size_t>(i)]);
+        }
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      REQUIRE_FALSE(array.Insert(-1, "inserted"));
+      REQUIRE_FALSE(array.Insert(size + 1, "inserted"));
+
+      THEN("array should not be changed") {
+        CHECK(array.size() == size);
+      }
+    }
+
+    AND_WHEN("removing an element at index in [0, size)") {
+      const int index = GENERATE_COPY(range(0, std::max(size, 1)));
+
+      if (size > 0) {
+        const auto removed = array.Remove(index);
+
+        THEN("removed element should have correct value and be erased") {
+          CHECK(removed == expected[static_cast<std::size_t>(index)]);
+          expected.erase(expected.begin() + index);
+
+          REQUIRE(array.size() == size - 1);
+          for (int i = 0; i < size - 1; i++) {
+            CHECK(array.Get(i) == expected[static_cast<std::size_t>(i)]);
+          }
+        }
+      }
+    }
+
+    AND_WHEN("setting and finding elements") {
+      if (size > 0) {
+        REQUIRE(array.Set(size - 1, "last"));
+
+        THEN("element should be found by value") {
+          CHECK(array.IndexOf("last") == size - 1);
+          CHECK(array.Contains("last"));
+          CHECK_FALSE(array.Contains("missing"));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("BasicDynamicArray copy and move") {
+
+  GIVEN("array of non-trivial elements") {
+    const auto elems = utils::rand_array(10, 0, 100);
+
+    auto array = BasicDynamicArray<Tracked>(4);
+    for (int elem : elems) {
+      array.EmplaceBack(elem);
+    }
+
+    WHEN("copying the array") {
+      const auto copy = array;
+      array.Set(0, Tracked(-1));
+
+      THEN("copy should be independent") {
+        CHECK_THAT(Values(copy), Equals(elems));
+        CHECK(array[0].value == -1);
+      }
+    }
+
+    AND_WHEN("moving the array") {
+      Tracked::Reset();
+      const auto moved = std::move(array);
+
+      THEN("elements should not be copied or moved one by one") {
+        CHECK(Tracked::copies == 0);
+        CHECK(Tracked::moves == 0);
+        CHECK_THAT(Values(moved), Equals(elems));
+      }
+    }
+  }
+
+  AND_GIVEN("any number of arrays of non-trivial elements") {
+    WHEN("all arrays are destroyed") {
+      const int alive_before = Tracked::alive;
+      {
+        auto array = BasicDynamicArray<Tracked>(2);
+        for (int i = 0; i < 10; i++) {
+          array.EmplaceBack(i);
+        }
+        auto copy = array;
+        copy.Remove(3);
+        copy.Clear();
+        copy.EmplaceBack(1);
+      }
+
+      THEN("all elements should be destroyed") {
+        CHECK(Tracked::alive == alive_before);
+      }
+    }
+  }
+}
+
+SCENARIO("BasicDynamicArray::Allocator") {
+
+  GIVEN("array with a counting allocator") {
+    int allocations = 0;
+
+    auto array = BasicDynamicArray<int, CountingAllocator<int>>(1, GrowthPolicy::Geometric2(),
+                                                                 CountingAllocator<int>(&allocations));
+    REQUIRE(allocations == 1);
+
+    WHEN("adding elements past the capacity") {
+      for (int i = 0; i < 1024; i++) {
+        array.Add(i);
+      }
+
+      THEN("memory should be allocated through the allocator") {
+        // 1 -> 2 -> 4 -> ... -> 1024
+        CHECK(allocations == 11);
+      }
+
+      AND_THEN("elements should be preserved") {
+        for (int i = 0; i < 1024; i++) {
+          CHECK(array[i] == i);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("BasicDynamicArray exception safety") {
+  using ThrowingArray = BasicDynamicArray<Throwing, std::pmr::polymorphic_allocator<Throwing>>;
+
+  GIVEN("array of elements with throwing copy and move") {
+    CountingResource resource;
+    Throwing::countdown = -1;
+    const int alive_before = Throwing::alive;
+    {
+      auto array = ThrowingArray(4, std::pmr::polymorphic_allocator<Throwing>(&resource));
+      for (int i = 0; i < 4; i++) {
+        array.EmplaceBack(i);
+      }
+      REQUIRE(resource.allocations == 1);
+
+      WHEN("copying fails in the middle") {
+        Throwing::countdown = 2;
+
+        THEN("constructed elements should be destroyed and memory released") {
+          CHECK_THROWS_AS(ThrowingArray(array, std::pmr::polymorphic_allocator<Throwing>(&resource)),
+                          std::runtime_error);
+          CHECK(Throwing::alive == alive_before + 4);
+          CHECK(resource.allocations - resource.deallocations == 1);
+        }
+      }
+
+      AND_WHEN("growth fails in the middle") {
+        Throwing::countdown = 2;
+
+        THEN("array should be left unchanged") {
+          CHECK_THROWS_AS(array.EmplaceBack(4), std::runtime_error);
+          CHECK(array.size() == 4);
+          CHECK(array.capacity() == 4);
+          CHECK_THAT(Values(array), Equals(std::vector<int>{0, 1, 2, 3}));
+          CHECK(Throwing::alive == alive_before + 4);
+          CHECK(resource.allocations - resource.deallocations == 1);
+        }
+      }
+
+      AND_WHEN("constructing the new element fails") {
+        Throwing::countdown = 0;
+        const Throwing elem(4);
+
+        THEN("array should be left unchanged") {
+          CHECK_THROWS_AS(array.Add(elem), std::runtime_error);
+          CHECK_THAT(Values(array), Equals(std::vector<int>{0, 1, 2, 3}));
+          CHECK(resource.allocations - resource.deallocations == 1);
+        }
+      }
+
+      Throwing::countdown = -1;
+    }
+
+    // все элементы разрушены, память возвращена ресурсу
+    CHECK(Throwing::alive == alive_before);
+    CHECK(resource.allocations == resource.deallocations);
+  }
+}
+
+SCENARIO("BasicDynamicArray with polymorphic allocator") {
+  using PmrArray = BasicDynamicArray<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>>;
+
+  GIVEN("two arrays with different memory resources") {
+    CountingResource first_resource;
+    CountingResource second_resource;
+
+    std::vector<std::string> first_values;
+    std::vector<std::string> second_values;
+    for (int i = 0; i < 5; i++) {
+      // длинные строки размещаются в памяти ресурса массива
+      first_values.push_back(std::string(32, 'a') + std::to_string(i));
+      second_values.push_back(std::string(32, 'b') + std::to_string(i));
+    }
+
+    const auto strings = [](const PmrArray& array) {
+      std::vector<std::string> values;
+      for (const auto& value : array) {
+        values.emplace_back(value);
+      }
+      return values;
+    };
+
+    {
+      auto first = PmrArray(2, std::pmr::polymorphic_allocator<std::pmr::string>(&first_resource));
+      auto second = PmrArray(2, std::pmr::polymorphic_allocator<std::pmr::string>(&second_resource));
+      for (int i = 0; i < 5; i++) {
+        first.EmplaceBack(first_values[i]);
+        second.EmplaceBack(second_values[i]);
+      }
+
+      WHEN("copy assigning") {
+        second = first;
+
+        THEN("target should keep its resource") {
+          CHECK_THAT(strings(second), Equals(first_values));
+          CHECK(second.get_allocator().resource() == &second_resource);
+          CHECK(second[0].get_allocator().resource() == &second_resource);
+          CHECK_THAT(strings(first), Equals(first_values));
+        }
+      }
+
+      AND_WHEN("move assigning") {
+        second = std::move(first);
+
+        THEN("elements should be moved into the target resource") {
+          CHECK_THAT(strings(second), Equals(first_values));
+          CHECK(second.get_allocator().resource() == &second_resource);
+          CHECK(second[0].get_allocator().resource() == &second_resource);
+        }
+      }
+
+      AND_WHEN("swapping") {
+        first.Swap(second);
+
+        THEN("each array should keep its resource") {
+          CHECK_THAT(strings(first), Equals(second_values));
+          CHECK_THAT(strings(second), Equals(first_values));
+          CHECK(first.get_allocator().resource() == &first_resource);
+          CHECK(second.get_allocator().resource() == &second_resource);
+          CHECK(first[0].get_allocator().resource() == &first_resource);
+          CHECK(second[0].get_allocator().resource() == &second_resource);
+        }
+      }
+
+      AND_WHEN("move assigning with the same resource") {
+        auto third = PmrArray(2, std::pmr::polymorphic_allocator<std::pmr::string>(&first_resource));
+        const int allocations_before = first_resource.allocations;
+        third = std::move(first);
+
+        THEN("memory block should be taken over without allocations") {
+          CHECK_THAT(strings(third), Equals(first_values));
+          CHECK(first_resource.allocations == allocations_before);
+          CHECK(first.IsEmpty());
+        }
+      }
+    }
+
+    // память возвращена тому ресурсу, у которого была выделена
+    CHECK(first_resource.allocations == first_resource.deallocations);
+    CHECK(second_resource.allocations == second_resource.deallocations);
+  }
+}
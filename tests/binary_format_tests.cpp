@@ -0,0 +1,435 @@
+#include <catch2/catch.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <unistd.h>  // pipe, close, lseek, write, ftruncate
+
+#include <algorithm>  // max
+#include <cstdint>    // uintptr_t
+#include <stdexcept>  // runtime_error
+
+#include "utils.hpp"  // rand_array, TempFile
+
+#include "assignment/array_stack.hpp"    // ArrayStack
+#include "assignment/binary_format.hpp"  // Header, Checksum, kChecksumBlock
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/linked_list.hpp"    // LinkedList
+#include "assignment/linked_queue.hpp"   // LinkedQueue
+
+using assignment::ArrayStack;
+using assignment::DynamicArray;
+using assignment::LinkedList;
+using assignment::LinkedQueue;
+using utils::TempFile;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  // канал без произвольного доступа (значения читаются без отображения в память)
+  struct Pipe {
+    int fds[2]{-1, -1};
+
+    Pipe() {
+      REQUIRE(::pipe(fds) == 0);
+    }
+
+    ~Pipe() {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+
+    int in() const {
+      return fds[1];
+    }
+
+    int out() const {
+      return fds[0];
+    }
+  };
+
+  constexpr off_t kPayloadOffset = sizeof(assignment::binary::Header);
+
+  DynamicArray MakeArray(const std::vector<int>& elems) {
+    auto array = DynamicArray(1);
+    for (int elem : elems) {
+      array.Add(elem);
+    }
+    return array;
+  }
+
+  ArrayStack MakeStack(const std::vector<int>& elems) {
+    auto stack = ArrayStack(1);
+    for (int elem : elems) {
+      stack.Push(elem);
+    }
+    return stack;
+  }
+
+  LinkedList MakeList(const std::vector<int>& elems) {
+    auto list = LinkedList();
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+    return list;
+  }
+
+  LinkedQueue MakeQueue(const std::vector<int>& elems) {
+    auto queue = LinkedQueue();
+    for (int elem : elems) {
+      queue.Enqueue(elem);
+    }
+    return queue;
+  }
+
+}  // namespace
+
+SCENARIO("binary::Checksum") {
+
+  GIVEN("sequence of values") {
+    const int size = GENERATE(0, 1, 7, 8, 9, 100, 4099);
+    const auto elems = utils::rand_array(size, -1000, 1000);
+
+    WHEN("computing checksum in parts of whole blocks") {
+      auto whole = assignment::binary::Checksum();
+      whole.Update(elems.data(), size);
+
+      auto parts = assignment::binary::Checksum();
+      int begin = 0;
+      for (; begin + 2 * assignment::binary::kChecksumBlock <= size; begin += 2 * assignment::binary::kChecksumBlock) {
+        parts.Update(elems.data() + begin, 2 * assignment::binary::kChecksumBlock);
+      }
+      parts.Update(elems.data() + begin, size - begin);
+
+      THEN("checksum should not depend on partitioning") {
+        CHECK(parts.Digest() == whole.Digest());
+      }
+    }
+
+    AND_WHEN("changing a single value") {
+      if (size > 0) {
+        auto original = assignment::binary::Checksum();
+        original.Update(elems.data(), size);
+
+        auto changed_elems = elems;
+        changed_elems[static_cast<std::size_t>(size / 2)] ^= 1;
+        auto changed = assignment::binary::Checksum();
+        changed.Update(changed_elems.data(), size);
+
+        THEN("checksum should change") {
+          CHECK(changed.Digest() != original.Digest());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::Save/Load") {
+
+  GIVEN("array of elements saved to a file") {
+    const int size = GENERATE(0, 1, 7, 8, 9, 1000, 5000);
+    const auto elems = utils::rand_array(size, -1000, 1000);
+
+    TempFile file;
+    REQUIRE(file.Open() >= 0);
+    MakeArray(elems).Save(file.fd);
+
+    WHEN("loading the array from the file") {
+      file.Rewind();
+      auto array = DynamicArray(3);
+      array.Add(42);
+      array.Load(file.fd);
+
+      THEN("array should hold the saved elements") {
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(size), Equals(elems));
+        CHECK(array.capacity() >= std::max(size, 1));
+      }
+
+      AND_THEN("array should remain modifiable without changing the file") {
+        array.Add(-1);
+        if (size > 0) {
+          array.Set(0, -2);
+        }
+        CHECK(array.size() == size + 1);
+
+        file.Rewind();
+        auto reloaded = DynamicArray();
+        reloaded.Load(file.fd);
+        CHECK_THAT(reloaded.toVector(size), Equals(elems));
+      }
+
+      AND_THEN("snapshot of the loaded array should outlive it") {
+        auto snapshot = array.Snapshot();
+        array = DynamicArray();
+        CHECK_THAT(snapshot.toVector(size), Equals(elems));
+      }
+    }
+
+    AND_WHEN("loading the array from a pipe") {
+      // запись помещается в буфер канала
+      const Pipe pipe;
+      MakeArray(elems).Save(pipe.in());
+
+      auto array = DynamicArray();
+      array.Load(pipe.out());
+
+      THEN("array should hold the saved elements") {
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(size), Equals(elems));
+      }
+    }
+
+    AND_WHEN("loading a corrupted record") {
+      if (size > 0) {
+        REQUIRE(file.Corrupt(kPayloadOffset + static_cast<off_t>(sizeof(int)) * (size - 1)));
+        file.Rewind();
+
+        auto array = MakeArray({1, 2, 3});
+
+        THEN("load should throw and leave the array unchanged") {
+          CHECK_THROWS_AS(array.Load(file.fd), std::runtime_error);
+          CHECK_THAT(array.toVector(3), Equals(std::vector<int>{1, 2, 3}));
+        }
+      }
+    }
+
+    AND_WHEN("loading a record with a broken header") {
+      REQUIRE(file.Corrupt(0));
+      file.Rewind();
+
+      auto array = DynamicArray();
+
+      THEN("load should throw") {
+        CHECK_THROWS_AS(array.Load(file.fd), std::runtime_error);
+      }
+    }
+
+    AND_WHEN("loading the record into a container of another kind") {
+      file.Rewind();
+      auto stack = ArrayStack();
+
+      THEN("load should throw") {
+        CHECK_THROWS_AS(stack.Load(file.fd), std::runtime_error);
+      }
+    }
+  }
+}
+
+SCENARIO("ArrayStack::Save/Load") {
+
+  GIVEN("stack of elements") {
+    const int size = GENERATE(0, 1, 9, 1000);
+    const auto elems = utils::rand_array(size, -1000, 1000);
+
+    WHEN("saving and loading the stack through a file") {
+      TempFile file;
+      REQUIRE(file.Open() >= 0);
+      MakeStack(elems).Save(file.fd);
+      file.Rewind();
+
+      auto stack = ArrayStack();
+      stack.Push(42);
+      stack.Load(file.fd);
+
+      THEN("stack should hold the saved elements from bottom to top") {
+        CHECK(stack.size() == size);
+        CHECK_THAT(stack.toVector(size), Equals(elems));
+      }
+
+      AND_THEN("stack should remain modifiable") {
+        stack.Push(-1);
+        CHECK(stack.Peek() == -1);
+        CHECK(stack.Pop());
+        CHECK(stack.size() == size);
+      }
+    }
+
+    AND_WHEN("saving and loading the stack through a pipe") {
+      const Pipe pipe;
+      MakeStack(elems).Save(pipe.in());
+
+      auto stack = ArrayStack();
+      stack.Load(pipe.out());
+
+      THEN("stack should hold the saved elements from bottom to top") {
+        CHECK_THAT(stack.toVector(size), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedList::Save/Load") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(0, 1, 9, 4096, 5000);
+    const auto elems = utils::rand_array(size, -1000, 1000);
+
+    WHEN("saving and loading the list through a file") {
+      TempFile file;
+      REQUIRE(file.Open() >= 0);
+      MakeList(elems).Save(file.fd);
+      file.Rewind();
+
+      auto list = MakeList({1, 2, 3});
+      list.Load(file.fd);
+
+      THEN("list should hold the saved elements") {
+        CHECK(list.size() == size);
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+
+      AND_THEN("list should remain modifiable") {
+        list.Add(-1);
+        CHECK(list.Insert(0, -2));
+        CHECK(list.Remove(1) == (size > 0 ? elems[0] : -1));
+        CHECK(list.size() == size + 1);
+
+        list.Clear();
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("saving and loading the list through a pipe") {
+      const Pipe pipe;
+      MakeList(elems).Save(pipe.in());
+
+      auto list = LinkedList();
+      list.Load(pipe.out());
+
+      THEN("list should hold the saved elements") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("loading a corrupted record") {
+      if (size > 0) {
+        TempFile file;
+        REQUIRE(file.Open() >= 0);
+        MakeList(elems).Save(file.fd);
+        REQUIRE(file.Corrupt(kPayloadOffset));
+        file.Rewind();
+
+        auto list = MakeList({1, 2, 3});
+
+        THEN("load should throw and leave the list unchanged") {
+          CHECK_THROWS_AS(list.Load(file.fd), std::runtime_error);
+          CHECK_THAT(list.toVector(), Equals(std::vector<int>{1, 2, 3}));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedQueue::Save/Load") {
+
+  GIVEN("queue of elements") {
+    const int size = GENERATE(0, 1, 9, 1000);
+    const auto elems = utils::rand_array(size, -1000, 1000);
+
+    WHEN("saving and loading the queue through a file") {
+      TempFile file;
+      REQUIRE(file.Open() >= 0);
+      MakeQueue(elems).Save(file.fd);
+      file.Rewind();
+
+      auto queue = LinkedQueue();
+      queue.Load(file.fd);
+
+      THEN("queue should hold the saved elements from front to back") {
+        CHECK(queue.size() == size);
+        CHECK_THAT(queue.toVector(), Equals(elems));
+      }
+
+      AND_THEN("queue should remain usable") {
+        queue.Enqueue(-1);
+        if (size > 0) {
+          CHECK(queue.front() == elems[0]);
+          CHECK(queue.Dequeue());
+        }
+        CHECK(queue.back() == -1);
+      }
+    }
+
+    AND_WHEN("saving and loading the queue through a pipe") {
+      const Pipe pipe;
+      MakeQueue(elems).Save(pipe.in());
+
+      auto queue = LinkedQueue();
+      queue.Load(pipe.out());
+
+      THEN("queue should hold the saved elements from front to back") {
+        CHECK_THAT(queue.toVector(), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("Save/Load of several containers in one file") {
+
+  GIVEN("containers saved one after another") {
+    const auto elems = utils::rand_array(777, -1000, 1000);
+
+    TempFile file;
+    REQUIRE(file.Open() >= 0);
+    MakeArray(elems).Save(file.fd);
+    MakeStack(elems).Save(file.fd);
+    MakeList(elems).Save(file.fd);
+    MakeQueue(elems).Save(file.fd);
+
+    WHEN("loading containers in the same order") {
+      file.Rewind();
+
+      auto array = DynamicArray();
+      auto stack = ArrayStack();
+      auto list = LinkedList();
+      auto queue = LinkedQueue();
+      array.Load(file.fd);
+      stack.Load(file.fd);
+      list.Load(file.fd);
+      queue.Load(file.fd);
+
+      THEN("each container should hold its own record") {
+        CHECK_THAT(array.toVector(777), Equals(elems));
+        CHECK_THAT(stack.toVector(777), Equals(elems));
+        CHECK_THAT(list.toVector(), Equals(elems));
+        CHECK_THAT(queue.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("containers are saved after a 1-byte prefix") {
+      TempFile shifted;
+      REQUIRE(shifted.Open() >= 0);
+      const char prefix = 'x';
+      REQUIRE(::write(shifted.fd, &prefix, 1) == 1);
+      MakeArray(elems).Save(shifted.fd);
+      MakeStack(elems).Save(shifted.fd);
+
+      REQUIRE(::lseek(shifted.fd, 1, SEEK_SET) == 1);
+      auto array = DynamicArray();
+      auto stack = ArrayStack();
+      array.Load(shifted.fd);
+      stack.Load(shifted.fd);
+
+      THEN("values should be loaded into aligned memory") {
+        CHECK_THAT(array.toVector(777), Equals(elems));
+        CHECK_THAT(stack.toVector(777), Equals(elems));
+        CHECK(reinterpret_cast<std::uintptr_t>(array.span().data()) % alignof(int) == 0);
+        CHECK(reinterpret_cast<std::uintptr_t>(stack.span().data()) % alignof(int) == 0);
+      }
+    }
+
+    AND_WHEN("file is truncated") {
+      REQUIRE(::ftruncate(file.fd, kPayloadOffset + 10) == 0);
+      file.Rewind();
+
+      auto array = DynamicArray();
+
+      THEN("load should throw") {
+        CHECK_THROWS_AS(array.Load(file.fd), std::runtime_error);
+      }
+    }
+  }
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
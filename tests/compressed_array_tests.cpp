@@ -0,0 +1,188 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // count, find
+#include <iterator>   // distance
+#include <limits>     // numeric_limits
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/compressed_array.hpp"  // CompressedArray
+
+using assignment::CompressedArray;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  constexpr int kBlock = CompressedArray::kBlockSize;
+
+}  // namespace
+
+SCENARIO("CompressedArray::CompressedArray") {
+
+  WHEN("creating array using default constructor") {
+    const auto array = CompressedArray();
+
+    THEN("array should be empty") {
+      CHECK(array.IsEmpty());
+      CHECK(array.size() == 0);
+      CHECK_FALSE(array.Get(0).has_value());
+      CHECK_FALSE(array.Contains(0));
+    }
+  }
+}
+
+SCENARIO("CompressedArray::Add/Get") {
+
+  GIVEN("values of any range") {
+    const int size = GENERATE(1, kBlock - 1, kBlock, kBlock + 1, 10 * kBlock + 17);
+    const int range = GENERATE(0, 1, 100, 1 << 20);
+    const auto elems = utils::rand_array(size, -range, range);
+    CAPTURE(size, range);
+
+    WHEN("adding values one by one") {
+      auto array = CompressedArray();
+      for (int elem : elems) {
+        array.Add(elem);
+      }
+
+      THEN("values should be preserved in order") {
+        REQUIRE(array.size() == size);
+        CHECK_THAT(array.toVector(), Equals(elems));
+        for (int i = 0; i < size; i++) {
+          REQUIRE(array.Get(i) == elems[static_cast<std::size_t>(i)]);
+        }
+        CHECK_FALSE(array.Get(-1).has_value());
+        CHECK_FALSE(array.Get(size).has_value());
+      }
+    }
+
+    AND_WHEN("adding values as a range") {
+      auto array = CompressedArray();
+      REQUIRE(array.AddRange(elems.data(), size / 3));
+      REQUIRE(array.AddRange(elems.data() + size / 3, size - size / 3));
+
+      THEN("values should be preserved in order") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+  }
+
+  AND_GIVEN("values spanning the whole int range") {
+    auto elems = utils::rand_array(3 * kBlock, -100, 100);
+    elems[5] = std::numeric_limits<int>::min();
+    elems[6] = std::numeric_limits<int>::max();
+    elems[kBlock + 1] = std::numeric_limits<int>::max();
+
+    const auto array = CompressedArray(elems);
+
+    THEN("values should be preserved") {
+      CHECK_THAT(array.toVector(), Equals(elems));
+      CHECK(array.Get(5) == std::numeric_limits<int>::min());
+      CHECK(array.IndexOf(std::numeric_limits<int>::max()) == 6);
+    }
+  }
+
+  AND_GIVEN("invalid range") {
+    auto array = CompressedArray();
+
+    THEN("range should be rejected") {
+      CHECK_FALSE(array.AddRange(nullptr, 1));
+      CHECK_FALSE(array.AddRange(nullptr, -1));
+      CHECK(array.IsEmpty());
+    }
+  }
+}
+
+SCENARIO("CompressedArray::Decode") {
+
+  GIVEN("array of values") {
+    const int size = 5 * kBlock + 40;
+    const auto elems = utils::rand_array(size, -1000, 1000);
+    const auto array = CompressedArray(elems);
+
+    WHEN("decoding a range") {
+      const int index = GENERATE_COPY(0, 1, kBlock - 1, kBlock, 2 * kBlock + 3, size - 1);
+      const int count = GENERATE_COPY(0, 1, kBlock, 3 * kBlock + 5, size);
+
+      std::vector<int> out(static_cast<std::size_t>(count) + 1, 42);
+      const bool decoded = array.Decode(index, count, out.data());
+
+      THEN("range inside the array should be decoded") {
+        if (index + count <= size) {
+          REQUIRE(decoded);
+          for (int i = 0; i < count; i++) {
+            REQUIRE(out[static_cast<std::size_t>(i)] == elems[static_cast<std::size_t>(index + i)]);
+          }
+          CHECK(out.back() == 42);
+        } else {
+          CHECK_FALSE(decoded);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("CompressedArray::IndexOf/Contains/Count") {
+
+  GIVEN("array of values with repetitions") {
+    const int size = GENERATE(0, 7, kBlock, 4 * kBlock + 9);
+    const auto elems = utils::rand_array(size, 0, 50);
+    const auto array = CompressedArray(elems);
+
+    WHEN("searching for a value") {
+      const int value = GENERATE(range(-1, 52));
+
+      THEN("results should match a linear scan") {
+        const auto it = std::find(elems.cbegin(), elems.cend(), value);
+        if (it == elems.cend()) {
+          CHECK_FALSE(array.IndexOf(value).has_value());
+          CHECK_FALSE(array.Contains(value));
+        } else {
+          CHECK(array.IndexOf(value) == std::distance(elems.cbegin(), it));
+          CHECK(array.Contains(value));
+        }
+        CHECK(array.Count(value) == std::count(elems.cbegin(), elems.cend(), value));
+      }
+    }
+  }
+
+  AND_GIVEN("array of constant blocks") {
+    const auto array = CompressedArray(std::vector<int>(3 * kBlock + 1, 9));
+
+    THEN("constant blocks should be searched without unpacking") {
+      CHECK(array.IndexOf(9) == 0);
+      CHECK(array.Count(9) == 3 * kBlock + 1);
+      CHECK_FALSE(array.Contains(10));
+    }
+  }
+}
+
+SCENARIO("CompressedArray::Clear/ShrinkToFit/memory_usage") {
+
+  GIVEN("array of small-range values") {
+    const auto elems = utils::rand_array(100 * kBlock, 1000, 1255);
+    auto array = CompressedArray(elems);
+
+    WHEN("shrinking the storage") {
+      array.ShrinkToFit();
+
+      THEN("values should take about 8 bits each") {
+        CHECK(array.memory_usage() < elems.size() * sizeof(int) / 3);
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("clearing the array") {
+      array.Clear();
+
+      THEN("array should be empty and reusable") {
+        CHECK(array.IsEmpty());
+        CHECK_FALSE(array.Contains(elems[0]));
+
+        array.Add(-5);
+        CHECK(array.Get(0) == -5);
+      }
+    }
+  }
+}
@@ -0,0 +1,252 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // find
+#include <random>     // mt19937, uniform_int_distribution
+#include <vector>     // vector
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/doubly_linked_list.hpp"  // DoublyLinkedList
+#include "assignment/node.hpp"                // DoubleNode
+
+using assignment::DoubleNode;
+using assignment::DoublyLinkedList;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  DoublyLinkedList MakeList(const std::vector<int>& elems) {
+    auto list = DoublyLinkedList();
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+    return list;
+  }
+
+  // проход по ссылкам на предыдущие узлы от конца списка
+  std::vector<int> Backwards(const DoublyLinkedList& list) {
+    std::vector<int> values;
+    for (const DoubleNode* node = list.back_node(); node != nullptr; node = node->prev) {
+      values.insert(values.begin(), node->value);
+    }
+    return values;
+  }
+
+}  // namespace
+
+SCENARIO("DoublyLinkedList::Add/AddFront") {
+
+  GIVEN("empty list") {
+    const int size = GENERATE(0, 1, 2, 101);
+    const auto elems = utils::rand_array(size, -100, 100);
+
+    WHEN("adding elements to the back") {
+      const auto list = MakeList(elems);
+
+      THEN("elements should be linked in order in both directions") {
+        CHECK(list.size() == size);
+        CHECK_THAT(list.toVector(), Equals(elems));
+        CHECK_THAT(Backwards(list), Equals(elems));
+      }
+
+      AND_THEN("each element should be found by index from the nearest end") {
+        for (int i = 0; i < size; i++) {
+          REQUIRE(list.Get(i) == elems[static_cast<std::size_t>(i)]);
+        }
+        CHECK_FALSE(list.Get(-1).has_value());
+        CHECK_FALSE(list.Get(size).has_value());
+      }
+    }
+
+    AND_WHEN("adding elements to the front") {
+      auto list = DoublyLinkedList();
+      for (int elem : elems) {
+        list.AddFront(elem);
+      }
+      const auto reversed = std::vector<int>(elems.rbegin(), elems.rend());
+
+      THEN("elements should be in reverse order") {
+        CHECK_THAT(list.toVector(), Equals(reversed));
+        CHECK_THAT(Backwards(list), Equals(reversed));
+      }
+    }
+  }
+}
+
+SCENARIO("DoublyLinkedList::RemoveFront/RemoveBack") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(1, 2, 100);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto list = MakeList(elems);
+
+    WHEN("removing elements from both ends in turns") {
+      std::vector<int> removed;
+      for (int i = 0; !list.IsEmpty(); i++) {
+        removed.push_back(*(i % 2 == 0 ? list.RemoveBack() : list.RemoveFront()));
+      }
+
+      THEN("elements should be removed from the corresponding ends") {
+        std::vector<int> expected;
+        int low = 0;
+        int high = size - 1;
+        for (int i = 0; low <= high; i++) {
+          expected.push_back(elems[static_cast<std::size_t>(i % 2 == 0 ? high-- : low++)]);
+        }
+        CHECK_THAT(removed, Equals(expected));
+        CHECK_FALSE(list.RemoveBack().has_value());
+        CHECK_FALSE(list.RemoveFront().has_value());
+        CHECK(list.front_node() == nullptr);
+        CHECK(list.back_node() == nullptr);
+        CHECK(list.pool().live_count() == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("DoublyLinkedList::RemoveNode/MoveToFront") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(1, 2, 10);
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto list = MakeList(elems);
+    const int index = GENERATE_COPY(filter([=](int i) { return i < size; }, values({0, 1, size / 2, size - 1})));
+    DoubleNode* node = list.FindNode(index);
+
+    WHEN("removing a node by handle") {
+      const int removed = list.RemoveNode(node);
+
+      auto expected = elems;
+      expected.erase(expected.begin() + index);
+
+      THEN("node should be unlinked from both directions") {
+        CHECK(removed == elems[static_cast<std::size_t>(index)]);
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK_THAT(Backwards(list), Equals(expected));
+      }
+    }
+
+    AND_WHEN("moving a node to the front") {
+      list.MoveToFront(node);
+
+      auto expected = elems;
+      expected.erase(expected.begin() + index);
+      expected.insert(expected.begin(), elems[static_cast<std::size_t>(index)]);
+
+      THEN("node should become the first one and keep its identity") {
+        CHECK(list.front_node() == node);
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK_THAT(Backwards(list), Equals(expected));
+        CHECK(list.size() == size);
+      }
+    }
+  }
+}
+
+SCENARIO("DoublyLinkedList random modifications") {
+
+  GIVEN("list and a model of it") {
+    const int seed = GENERATE(1, 2, 3);
+    auto engine = std::mt19937(static_cast<std::uint32_t>(seed));
+    auto value = std::uniform_int_distribution<>(-50, 50);
+
+    auto list = DoublyLinkedList();
+    auto model = std::vector<int>();
+
+    WHEN("performing random insertions, removals and updates") {
+      for (int step = 0; step < 5000; step++) {
+        const int size = static_cast<int>(model.size());
+        const int position = static_cast<int>(engine() % static_cast<unsigned>(size + 1));
+        switch (engine() % 6) {
+          case 0:
+          case 1: {
+            const int inserted = value(engine);
+            REQUIRE(list.Insert(position, inserted));
+            model.insert(model.begin() + position, inserted);
+            break;
+          }
+          case 2:
+            if (size > 0) {
+              REQUIRE(list.Remove(position % size) == model[static_cast<std::size_t>(position % size)]);
+              model.erase(model.begin() + position % size);
+            }
+            break;
+          case 3:
+            if (size > 0) {
+              const int updated = value(engine);
+              REQUIRE(list.Set(position % size, updated));
+              model[static_cast<std::size_t>(position % size)] = updated;
+            }
+            break;
+          case 4:
+            if (size > 0) {
+              list.MoveToFront(list.FindNode(position % size));
+              const int moved = model[static_cast<std::size_t>(position % size)];
+              model.erase(model.begin() + position % size);
+              model.insert(model.begin(), moved);
+            }
+            break;
+          default: {
+            const int searched = value(engine);
+            const auto found = std::find(model.begin(), model.end(), searched);
+            REQUIRE(list.IndexOf(searched).value_or(-1) ==
+                    (found == model.end() ? -1 : static_cast<int>(found - model.begin())));
+          }
+        }
+        REQUIRE(list.size() == static_cast<int>(model.size()));
+      }
+
+      THEN("list should hold the same elements as the model in both directions") {
+        CHECK_THAT(list.toVector(), Equals(model));
+        CHECK_THAT(Backwards(list), Equals(model));
+      }
+    }
+  }
+}
+
+SCENARIO("DoublyLinkedList copy, move and clear") {
+
+  GIVEN("list of elements") {
+    const auto elems = utils::rand_array(100, 0, 100);
+    auto list = MakeList(elems);
+
+    WHEN("copying the list") {
+      auto copy = list;
+      list.Set(0, 1000);
+      copy.RemoveBack();
+
+      THEN("copy should be independent and linked in both directions") {
+        auto expected = elems;
+        expected.pop_back();
+        CHECK_THAT(copy.toVector(), Equals(expected));
+        CHECK_THAT(Backwards(copy), Equals(expected));
+        CHECK(list.Get(0) == 1000);
+        CHECK(list.size() == 100);
+      }
+    }
+
+    AND_WHEN("moving the list") {
+      auto moved = std::move(list);
+
+      THEN("moved-to list should own the elements, moved-from list should be empty") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("list should be empty and reusable") {
+        CHECK(list.IsEmpty());
+        CHECK(list.pool().slab_count() == 1);
+        list.AddFront(2);
+        list.AddFront(1);
+        CHECK(list.toVector() == std::vector<int>{1, 2});
+      }
+    }
+  }
+}
@@ -1,10 +1,19 @@
 #include <catch2/catch.hpp>
 
-#include <cmath>  // min
+#include <algorithm>  // count, find, sort
+#include <atomic>     // atomic
+#include <climits>    // INT_MAX
+#include <cmath>      // min
+#include <list>       // list
+#include <thread>     // thread
+#include <vector>     // vector
 
 #include "utils.hpp"  // rand_array
 
+#include "assignment/arena.hpp"          // MonotonicArena
 #include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/parallel_scan.hpp"  // kChunkSize
+#include "assignment/thread_pool.hpp"    // ThreadPool
 
 using assignment::DynamicArray;
 
@@ -619,3 +628,790 @@ SCENARIO("DynamicArray::Clear") {
     }
   }
 }
+
+SCENARIO("DynamicArray::GrowthPolicy") {
+
+  GIVEN("array full of elements with a geometric growth policy") {
+    const int capacity = GENERATE(range(2, 11));
+    const auto elems = utils::rand_array(capacity, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+    array.set_growth_policy(assignment::GrowthPolicy::Geometric2());
+
+    REQUIRE(array.size() == capacity);
+    REQUIRE(array.growth_policy().kind() == assignment::GrowthPolicy::Kind::kGeometric2);
+
+    WHEN("adding an element") {
+      array.Add(-1);
+
+      THEN("array capacity should be doubled") {
+        CHECK(array.capacity() == capacity * 2);
+      }
+
+      AND_THEN("previous elements should be present") {
+        CHECK_THAT(array.toVector(capacity), Equals(elems));
+      }
+
+      AND_THEN("back should be equal to the added element") {
+        CHECK(array.Get(capacity) == -1);
+      }
+    }
+
+    AND_WHEN("inserting an element at the front") {
+      REQUIRE(array.Insert(0, -1));
+
+      THEN("array capacity should be doubled") {
+        CHECK(array.capacity() == capacity * 2);
+      }
+
+      AND_THEN("elements should be shifted") {
+        auto expected = elems;
+        expected.insert(expected.begin(), -1);
+        CHECK_THAT(array.toVector(capacity + 1), Equals(expected));
+      }
+    }
+  }
+
+  AND_GIVEN("empty array with a custom growth policy") {
+    auto array = DynamicArray(1, assignment::GrowthPolicy::Custom([](int capacity) { return capacity + 3; }));
+
+    WHEN("adding elements") {
+      const auto elems = utils::rand_array(10, 0, 100);
+
+      for (int elem : elems) {
+        array.Add(elem);
+      }
+
+      THEN("capacity should follow the custom function") {
+        CHECK(array.capacity() == 10);
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(array.toVector(10), Equals(elems));
+      }
+    }
+  }
+
+  AND_GIVEN("any growth policy") {
+    const auto policy = GENERATE(assignment::GrowthPolicy::Additive(),
+                                 assignment::GrowthPolicy::Geometric15(),
+                                 assignment::GrowthPolicy::Geometric2(),
+                                 assignment::GrowthPolicy::Custom([](int) { return 0; }));
+
+    WHEN("computing the next capacity") {
+      const int capacity = GENERATE(1, 2, 10, 1000);
+
+      THEN("next capacity should be greater than the current one") {
+        CHECK(policy.NextCapacity(capacity, capacity + 1) > capacity);
+      }
+
+      AND_THEN("next capacity should not be less than the required one") {
+        CHECK(policy.NextCapacity(capacity, capacity * 4) >= capacity * 4);
+      }
+
+      AND_THEN("next capacity should not overflow") {
+        CHECK(policy.NextCapacity(INT_MAX - 1, INT_MAX) == INT_MAX);
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::InsertRange") {
+
+  GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 6));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+
+    REQUIRE(array.size() == size);
+
+    WHEN("inserting a range at index in [0, size]") {
+      const int insert_index = GENERATE_COPY(range(0, size + 1));
+      const int count = GENERATE(0, 1, 7);
+      const auto values = utils::rand_array(count, 100, 200);
+
+      REQUIRE(array.InsertRange(insert_index, values.data(), count));
+
+      THEN("array should contain the range at the specified index") {
+        auto expected = elems;
+        expected.insert(expected.begin() + insert_index, values.cbegin(), values.cend());
+
+        CHECK(array.size() == size + count);
+        CHECK_THAT(array.toVector(size + count), Equals(expected));
+      }
+    }
+
+    AND_WHEN("inserting a range given by iterators") {
+      const int insert_index = GENERATE_COPY(range(0, size + 1));
+      const auto values = utils::rand_array(7, 100, 200);
+      const auto list = std::list<int>(values.cbegin(), values.cend());
+
+      REQUIRE(array.InsertRange(insert_index, list.cbegin(), list.cend()));
+
+      THEN("array should contain the range at the specified index") {
+        auto expected = elems;
+        expected.insert(expected.begin() + insert_index, values.cbegin(), values.cend());
+        CHECK_THAT(array.toVector(size + 7), Equals(expected));
+      }
+    }
+
+    AND_WHEN("inserting a range at index outside [0, size] or with negative count") {
+      const int values[] = {1, 2, 3};
+
+      REQUIRE_FALSE(array.InsertRange(-1, values, 3));
+      REQUIRE_FALSE(array.InsertRange(size + 1, values, 3));
+      REQUIRE_FALSE(array.InsertRange(0, values, -1));
+      REQUIRE_FALSE(array.InsertRange(0, nullptr, 1));
+
+      THEN("array should not be changed") {
+        CHECK(array.size() == size);
+        CHECK(array.capacity() == capacity);
+        CHECK_THAT(array.toVector(size), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::AddRange") {
+
+  GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 6));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+
+    WHEN("adding a range exceeding the capacity") {
+      const auto values = utils::rand_array(capacity * 3, 100, 200);
+
+      REQUIRE(array.AddRange(values.cbegin(), values.cend()));
+
+      THEN("array should contain the previous elements followed by the range") {
+        auto expected = elems;
+        expected.insert(expected.end(), values.cbegin(), values.cend());
+
+        CHECK(array.size() == size + capacity * 3);
+        CHECK(array.capacity() >= array.size());
+        CHECK_THAT(array.toVector(array.size()), Equals(expected));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::RemoveRange") {
+
+  GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 8));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+
+    WHEN("removing a range inside [0, size)") {
+      const int remove_index = GENERATE_COPY(range(0, size + 1));
+      const int count = GENERATE_COPY(range(0, size - remove_index + 1));
+
+      REQUIRE(array.RemoveRange(remove_index, count));
+
+      THEN("the range should be removed") {
+        auto expected = elems;
+        expected.erase(expected.begin() + remove_index, expected.begin() + remove_index + count);
+
+        CHECK(array.size() == size - count);
+        CHECK(array.capacity() == capacity);
+        CHECK_THAT(array.toVector(size - count), Equals(expected));
+      }
+    }
+
+    AND_WHEN("removing a range outside [0, size)") {
+      REQUIRE_FALSE(array.RemoveRange(-1, 1));
+      REQUIRE_FALSE(array.RemoveRange(0, size + 1));
+      REQUIRE_FALSE(array.RemoveRange(size, 1));
+      REQUIRE_FALSE(array.RemoveRange(0, -1));
+
+      THEN("array should not be changed") {
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(size), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::Assign") {
+
+  GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 6));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+
+    WHEN("assigning a range") {
+      const int count = GENERATE(0, 1, 3, 12);
+      const auto values = utils::rand_array(count, 100, 200);
+
+      REQUIRE(array.Assign(values.data(), count));
+
+      THEN("array should contain only the range") {
+        CHECK(array.size() == count);
+        CHECK_THAT(array.toVector(count), Equals(values));
+      }
+    }
+
+    AND_WHEN("assigning copies of a value") {
+      const int count = GENERATE(0, 1, 3, 12);
+
+      REQUIRE(array.Assign(count, 42));
+
+      THEN("array should contain only the copies") {
+        CHECK(array.size() == count);
+        CHECK_THAT(array.toVector(count), Equals(std::vector<int>(count, 42)));
+      }
+    }
+
+    AND_WHEN("filling a range of elements") {
+      const int fill_index = GENERATE_COPY(range(0, size + 1));
+      const int count = size - fill_index;
+
+      REQUIRE(array.Fill(fill_index, count, -1));
+      REQUIRE_FALSE(array.Fill(fill_index, count + 1, -1));
+
+      THEN("only the range should be filled") {
+        auto expected = elems;
+        std::fill(expected.begin() + fill_index, expected.end(), -1);
+
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(size), Equals(expected));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::ShrinkPolicy") {
+
+  GIVEN("large array with a hysteresis shrink policy") {
+    const auto elems = utils::rand_array(1000, 0, 100);
+
+    auto array = DynamicArray(assignment::ShrinkPolicy::kDefaultMinCapacity, assignment::GrowthPolicy::Geometric2());
+    for (int elem : elems) {
+      array.Add(elem);
+    }
+    array.set_shrink_policy(assignment::ShrinkPolicy::Hysteresis());
+
+    const int capacity = array.capacity();
+
+    REQUIRE(capacity == 1280);
+    REQUIRE(array.reclaimed_bytes() == 0);
+
+    WHEN("removing elements until size < capacity / 4") {
+      const int remove_count = 1000 - capacity / 4 + 1;
+      array.RemoveRange(0, remove_count);
+
+      THEN("capacity should be halved") {
+        CHECK(array.capacity() == capacity / 2);
+      }
+
+      AND_THEN("reclaimed bytes should be reported") {
+        CHECK(array.reclaimed_bytes() == static_cast<std::size_t>(capacity / 2) * sizeof(int));
+      }
+
+      AND_THEN("remaining elements should be preserved") {
+        const auto expected = std::vector<int>(elems.cbegin() + remove_count, elems.cend());
+        CHECK_THAT(array.toVector(array.size()), Equals(expected));
+      }
+    }
+
+    AND_WHEN("alternating add/remove around the shrink boundary") {
+      while (array.size() >= capacity / 4) {
+        array.Remove(array.size() - 1);
+      }
+      const int shrunk_capacity = array.capacity();
+      const auto reclaimed = array.reclaimed_bytes();
+
+      for (int i = 0; i < 100; i++) {
+        array.Add(i);
+        array.Remove(array.size() - 1);
+      }
+
+      THEN("capacity should not be changed") {
+        CHECK(array.capacity() == shrunk_capacity);
+        CHECK(array.reclaimed_bytes() == reclaimed);
+      }
+    }
+
+    AND_WHEN("clearing the array") {
+      array.Clear();
+
+      THEN("capacity should drop to the minimal capacity") {
+        CHECK(array.capacity() == assignment::ShrinkPolicy::kDefaultMinCapacity);
+        CHECK(array.reclaimed_bytes() == static_cast<std::size_t>(capacity - array.capacity()) * sizeof(int));
+      }
+    }
+  }
+
+  AND_GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 11));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = DynamicArray(elems, capacity);
+
+    WHEN("shrinking the array to fit") {
+      const bool shrunk = array.ShrinkToFit();
+
+      THEN("capacity should be equal to size (at least 1)") {
+        CHECK(shrunk == (std::max(size, 1) < capacity));
+        CHECK(array.capacity() == std::max(size, 1));
+        CHECK(array.reclaimed_bytes() == static_cast<std::size_t>(capacity - array.capacity()) * sizeof(int));
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(array.toVector(size), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing elements without a shrink policy") {
+      array.Clear();
+
+      THEN("capacity should not be changed") {
+        CHECK(array.capacity() == capacity);
+        CHECK(array.reclaimed_bytes() == 0);
+      }
+    }
+  }
+
+  AND_GIVEN("invalid hysteresis parameters") {
+    THEN("policy should not be created") {
+      CHECK_THROWS(assignment::ShrinkPolicy::Hysteresis(2, 2));
+      CHECK_THROWS(assignment::ShrinkPolicy::Hysteresis(4, 1));
+      CHECK_THROWS(assignment::ShrinkPolicy::Hysteresis(4, 2, 0));
+    }
+  }
+}
+
+SCENARIO("DynamicArray::MemoryResource") {
+
+  WHEN("creating array with a null memory resource") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(DynamicArray(10, nullptr));
+    }
+  }
+
+  AND_WHEN("creating array without a memory resource") {
+    const auto array = DynamicArray();
+
+    THEN("default memory resource should be used") {
+      CHECK(array.resource() == std::pmr::get_default_resource());
+    }
+  }
+
+  AND_GIVEN("array allocated from an arena") {
+    auto arena = assignment::MonotonicArena();
+    const auto elems = utils::rand_array(100, 0, 100);
+
+    auto array = DynamicArray(1, assignment::GrowthPolicy::Geometric2(), &arena);
+    REQUIRE(array.resource() == &arena);
+
+    WHEN("adding elements past the capacity") {
+      for (int elem : elems) {
+        array.Add(elem);
+      }
+
+      THEN("memory should be allocated from the arena") {
+        // 1 -> 2 -> 4 -> ... -> 128
+        CHECK(arena.bytes_allocated() == (1 + 2 + 4 + 8 + 16 + 32 + 64 + 128) * sizeof(int));
+      }
+
+      AND_THEN("elements should be preserved") {
+        CHECK_THAT(array.toVector(array.size()), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::ParallelScan") {
+
+  GIVEN("array with zero or more elements and a thread pool") {
+    auto pool = assignment::ThreadPool(3);
+
+    const int size = GENERATE(0, 10, 3 * assignment::parallel::kChunkSize + 5);
+    const auto elems = utils::rand_array(size, 0, 1000);
+
+    auto array = DynamicArray(1, assignment::GrowthPolicy::Geometric2());
+    array.AddRange(elems.data(), size);
+    array.set_thread_pool(&pool, 0);
+
+    REQUIRE(array.thread_pool() == &pool);
+
+    WHEN("searching for any value") {
+      const int value = GENERATE(-1, 0, 500, 1000);
+
+      THEN("results should match the sequential scan") {
+        const auto found = std::find(elems.cbegin(), elems.cend(), value);
+
+        if (found == elems.cend()) {
+          CHECK_FALSE(array.IndexOf(value).has_value());
+          CHECK_FALSE(array.Contains(value));
+        } else {
+          CHECK(array.IndexOf(value) == found - elems.cbegin());
+          CHECK(array.Contains(value));
+        }
+        CHECK(array.Count(value) == std::count(elems.cbegin(), elems.cend(), value));
+      }
+    }
+
+    AND_WHEN("disabling the parallel scan") {
+      array.set_thread_pool(nullptr);
+
+      THEN("count should still be correct") {
+        CHECK(array.thread_pool() == nullptr);
+        CHECK(array.Count(-1) == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray copy and move") {
+
+  GIVEN("array with zero or more elements") {
+    const int capacity = GENERATE(range(1, 8));
+    const int size = GENERATE_COPY(range(0, capacity + 1));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = DynamicArray(elems, capacity);
+
+    WHEN("copying the array") {
+      auto copy = array;
+      copy.Add(-1);
+      array.Fill(0, size, -2);
+
+      THEN("copy should be independent") {
+        CHECK_THAT(copy.toVector(size), Equals(elems));
+        CHECK(copy.Get(size) == -1);
+        CHECK(array.size() == size);
+      }
+    }
+
+    AND_WHEN("copy-assigning the array") {
+      auto copy = DynamicArray();
+      copy = array;
+      copy = copy;
+
+      THEN("elements and capacity should be copied") {
+        CHECK_THAT(copy.toVector(), Equals(array.toVector()));
+        CHECK(copy.capacity() == capacity);
+      }
+    }
+
+    AND_WHEN("moving the array") {
+      auto moved = std::move(array);
+
+      THEN("elements should be moved") {
+        CHECK_THAT(moved.toVector(size), Equals(elems));
+        CHECK(moved.capacity() == capacity);
+      }
+
+      AND_WHEN("reusing the moved-from array") {
+        array.Add(1);
+
+        THEN("it should behave as an empty array") {
+          CHECK(array.size() == 1);
+          CHECK(array.Get(0) == 1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::Snapshot") {
+
+  GIVEN("array with one or more elements") {
+    const int size = GENERATE(range(1, 10));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = DynamicArray(elems, size);
+    REQUIRE_FALSE(array.IsShared());
+
+    WHEN("taking a snapshot") {
+      auto snapshot = array.Snapshot();
+
+      THEN("buffer should be shared") {
+        CHECK(array.IsShared());
+        CHECK(snapshot.IsShared());
+        CHECK_THAT(snapshot.toVector(size), Equals(elems));
+      }
+
+      AND_WHEN("mutating the original in any way") {
+        const int operation = GENERATE(range(0, 7));
+
+        switch (operation) {
+          case 0:
+            array.Add(-1);
+            break;
+          case 1:
+            array.Insert(0, -1);
+            break;
+          case 2:
+            array.Set(0, -1);
+            break;
+          case 3:
+            array.Remove(0);
+            break;
+          case 4:
+            array.Fill(0, size, -1);
+            break;
+          case 5:
+            array.Assign(array.size(), -1);
+            break;
+          default:
+            array.Clear();
+            array.Add(-1);
+        }
+
+        THEN("snapshot should not be changed") {
+          CHECK_THAT(snapshot.toVector(size), Equals(elems));
+        }
+
+        AND_THEN("buffer should not be shared anymore") {
+          CHECK_FALSE(array.IsShared());
+          CHECK_FALSE(snapshot.IsShared());
+        }
+      }
+
+      AND_WHEN("mutating the snapshot") {
+        snapshot.Set(0, -1);
+
+        THEN("original should not be changed") {
+          CHECK_THAT(array.toVector(size), Equals(elems));
+          CHECK(snapshot.Get(0) == -1);
+        }
+      }
+
+      AND_WHEN("destroying the snapshot") {
+        { const auto dropped = std::move(snapshot); }
+
+        THEN("buffer should be owned exclusively") {
+          CHECK_FALSE(array.IsShared());
+        }
+
+        AND_WHEN("mutating the original") {
+          array.Set(0, -1);
+
+          THEN("element should be changed in place") {
+            CHECK(array.Get(0) == -1);
+          }
+        }
+      }
+    }
+
+    AND_WHEN("taking several snapshots and mutating each of them") {
+      auto first = array.Snapshot();
+      auto second = first.Snapshot();
+
+      first.Set(0, -1);
+      second.Set(0, -2);
+
+      THEN("each array should see its own elements") {
+        CHECK(array.Get(0) == elems[0]);
+        CHECK(first.Get(0) == -1);
+        CHECK(second.Get(0) == -2);
+      }
+    }
+
+    AND_WHEN("taking a snapshot of an arena-backed array") {
+      auto arena = assignment::MonotonicArena();
+      auto arena_array = DynamicArray(size, &arena);
+      arena_array.AddRange(elems.data(), size);
+
+      const auto snapshot = arena_array.Snapshot();
+      arena_array.Set(0, -1);
+
+      THEN("snapshot should use the same memory resource") {
+        CHECK(snapshot.resource() == &arena);
+        CHECK(snapshot.Get(0) == elems[0]);
+      }
+    }
+  }
+
+  AND_GIVEN("large array mutated while a snapshot is read in another thread") {
+    auto array = DynamicArray(1, assignment::GrowthPolicy::Geometric2());
+    array.Assign(100'000, 1);
+
+    WHEN("reading the snapshot concurrently") {
+      auto snapshot = array.Snapshot();
+
+      long long sum = 0;
+      auto reader = std::thread([&sum, snapshot = std::move(snapshot)] {
+        for (int i = 0; i < snapshot.size(); i++) {
+          sum += snapshot.Get(i).value_or(0);
+        }
+      });
+
+      for (int i = 0; i < 1000; i++) {
+        array.Set(i, 2);
+        array.Add(3);
+      }
+      reader.join();
+
+      THEN("snapshot should see the original elements") {
+        CHECK(sum == 100'000);
+        CHECK(array.Get(0) == 2);
+      }
+    }
+  }
+
+  AND_GIVEN("const array snapshotted from several threads at once") {
+    auto array = DynamicArray(1, assignment::GrowthPolicy::Geometric2());
+    array.Assign(1000, 7);
+    const auto& view = array;
+
+    WHEN("each thread takes its own snapshots") {
+      std::atomic<bool> start{false};
+      std::vector<std::vector<DynamicArray>> snapshots(4);
+      std::vector<std::thread> threads;
+      for (auto& taken : snapshots) {
+        threads.emplace_back([&view, &start, &taken] {
+          while (!start.load(std::memory_order_acquire)) {
+          }
+          for (int i = 0; i < 100; i++) {
+            taken.push_back(view.Snapshot());
+          }
+        });
+      }
+      start.store(true, std::memory_order_release);
+      for (auto& thread : threads) {
+        thread.join();
+      }
+
+      THEN("all snapshots should share the buffer of the array") {
+        CHECK(array.IsShared());
+        for (const auto& taken : snapshots) {
+          for (const auto& snapshot : taken) {
+            REQUIRE(snapshot.size() == 1000);
+            REQUIRE(snapshot.Get(999) == 7);
+          }
+        }
+      }
+
+      AND_THEN("array should own its buffer alone after the snapshots are destroyed") {
+        snapshots.clear();
+        CHECK_FALSE(array.IsShared());
+        array.Set(0, 1);
+        CHECK(array.Get(0) == 1);
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray iterators") {
+
+  GIVEN("array with zero or more elements") {
+    const int size = GENERATE(range(0, 11));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = DynamicArray(elems, size + 5);
+
+    WHEN("iterating over the array") {
+      const auto& const_array = array;
+      const std::vector<int> values(const_array.begin(), const_array.end());
+
+      THEN("only elements in [0, size) should be visited") {
+        CHECK_THAT(values, Equals(elems));
+        CHECK(const_array.end() - const_array.begin() == size);
+        CHECK(const_array.cend() == const_array.end());
+      }
+    }
+
+    AND_WHEN("sorting the array through its span") {
+      auto span = array.span();
+      std::sort(span.begin(), span.end());
+
+      THEN("array elements should be sorted in place") {
+        auto expected = elems;
+        std::sort(expected.begin(), expected.end());
+        CHECK_THAT(array.toVector(size), Equals(expected));
+        CHECK(span.size() == size);
+      }
+    }
+  }
+
+  AND_GIVEN("array sharing its buffer with a snapshot") {
+    auto array = DynamicArray(std::vector<int>{1, 2, 3}, 3);
+    const auto snapshot = array.Snapshot();
+
+    WHEN("changing elements through mutable iterators") {
+      for (int& value : array) {
+        value *= 10;
+      }
+
+      THEN("snapshot should not be changed") {
+        CHECK_THAT(array.toVector(3), Equals(std::vector<int>{10, 20, 30}));
+        CHECK_THAT(snapshot.toVector(3), Equals(std::vector<int>{1, 2, 3}));
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::GetMany/SetMany") {
+
+  GIVEN("array with one or more elements") {
+    const int size = GENERATE(1, 10, 1000);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = DynamicArray(elems, size);
+
+    AND_GIVEN("random indices in [0, size)") {
+      const int count = GENERATE(0, 1, 8, 100);
+      const auto indices = utils::rand_array(count, 0, size - 1);
+
+      WHEN("getting elements by indices") {
+        std::vector<int> out(static_cast<std::size_t>(count));
+        REQUIRE(array.GetMany(indices.data(), count, out.data()));
+
+        THEN("values should match Get") {
+          for (int i = 0; i < count; i++) {
+            CHECK(out[static_cast<std::size_t>(i)] == array.Get(indices[static_cast<std::size_t>(i)]));
+          }
+        }
+      }
+
+      AND_WHEN("setting elements by indices") {
+        const auto values = utils::rand_array(count, -100, -1);
+        REQUIRE(array.SetMany(indices.data(), values.data(), count));
+
+        auto expected = elems;
+        for (int i = 0; i < count; i++) {
+          expected[static_cast<std::size_t>(indices[static_cast<std::size_t>(i)])] = values[static_cast<std::size_t>(i)];
+        }
+
+        THEN("the last value for each index should be stored") {
+          CHECK_THAT(array.toVector(size), Equals(expected));
+        }
+      }
+    }
+
+    AND_GIVEN("indices with one outside [0, size)") {
+      const int bad = GENERATE_COPY(-1, size, INT_MAX);
+      const std::vector<int> indices = {0, bad, size - 1};
+
+      WHEN("getting or setting elements by indices") {
+        std::vector<int> out(3, 42);
+        const std::vector<int> values = {-1, -2, -3};
+
+        THEN("nothing should be read or changed") {
+          CHECK_FALSE(array.GetMany(indices.data(), 3, out.data()));
+          CHECK(out == std::vector<int>(3, 42));
+          CHECK_FALSE(array.SetMany(indices.data(), values.data(), 3));
+          CHECK_THAT(array.toVector(size), Equals(elems));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,215 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // find
+#include <random>     // mt19937, uniform_int_distribution
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/gap_buffer.hpp"  // GapBuffer
+
+using assignment::GapBuffer;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  GapBuffer MakeBuffer(const std::vector<int>& elems, int capacity = 1) {
+    auto buffer = GapBuffer(capacity);
+    for (int elem : elems) {
+      buffer.Add(elem);
+    }
+    return buffer;
+  }
+
+}  // namespace
+
+SCENARIO("GapBuffer::GapBuffer") {
+
+  WHEN("creating buffer using default constructor") {
+    const auto buffer = GapBuffer();
+
+    THEN("buffer should be empty") {
+      CHECK(buffer.IsEmpty());
+      CHECK(buffer.capacity() == GapBuffer::kInitCapacity);
+      CHECK(buffer.cursor() == 0);
+    }
+  }
+
+  AND_WHEN("creating buffer by specifying capacity <= 0") {
+    const int capacity = GENERATE(range(-5, 1));
+
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(GapBuffer(capacity));
+    }
+  }
+}
+
+SCENARIO("GapBuffer::Insert/Remove") {
+
+  GIVEN("buffer with zero or more elements") {
+    const int size = GENERATE(range(0, 10));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto buffer = MakeBuffer(elems);
+
+    THEN("elements should be appended in order") {
+      CHECK(buffer.size() == size);
+      CHECK_THAT(buffer.toVector(), Equals(elems));
+    }
+
+    WHEN("inserting an element at index in [0, size] after moving the cursor anywhere") {
+      const int cursor = GENERATE_COPY(range(0, size + 1));
+      const int index = GENERATE_COPY(range(0, size + 1));
+
+      REQUIRE(buffer.MoveCursor(cursor));
+      REQUIRE(buffer.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted and the cursor placed after it") {
+        CHECK_THAT(buffer.toVector(), Equals(expected));
+        CHECK(buffer.cursor() == index + 1);
+      }
+    }
+
+    AND_WHEN("removing an element at index in [0, size) after moving the cursor anywhere") {
+      if (size > 0) {
+        const int cursor = GENERATE_COPY(range(0, size + 1));
+        const int index = GENERATE_COPY(range(0, size));
+
+        REQUIRE(buffer.MoveCursor(cursor));
+        const auto removed = buffer.Remove(index);
+
+        auto expected = elems;
+        expected.erase(expected.begin() + index);
+
+        THEN("element should be removed") {
+          CHECK(removed == elems[static_cast<std::size_t>(index)]);
+          CHECK_THAT(buffer.toVector(), Equals(expected));
+          CHECK(buffer.cursor() == index);
+        }
+      }
+    }
+
+    AND_WHEN("accessing index outside the buffer") {
+      THEN("operations should fail") {
+        CHECK_FALSE(buffer.Insert(-1, 0));
+        CHECK_FALSE(buffer.Insert(size + 1, 0));
+        CHECK_FALSE(buffer.Remove(size).has_value());
+        CHECK_FALSE(buffer.Set(size, 0));
+        CHECK_FALSE(buffer.Get(size).has_value());
+        CHECK_FALSE(buffer.MoveCursor(size + 1));
+        CHECK(buffer.size() == size);
+      }
+    }
+  }
+}
+
+SCENARIO("GapBuffer::Get/Set/IndexOf") {
+
+  GIVEN("buffer with the gap in the middle") {
+    const int size = GENERATE(range(1, 40));
+    const auto elems = utils::rand_array(size, 0, 10);
+
+    auto buffer = MakeBuffer(elems, 4);
+    REQUIRE(buffer.MoveCursor(size / 2));
+
+    THEN("elements should be accessible on both sides of the gap") {
+      for (int i = 0; i < size; i++) {
+        CHECK(buffer.Get(i) == elems[static_cast<std::size_t>(i)]);
+      }
+    }
+
+    AND_THEN("first occurrence should be found on both sides of the gap") {
+      for (int value = -1; value <= 10; value++) {
+        const auto found = std::find(elems.cbegin(), elems.cend(), value);
+
+        if (found == elems.cend()) {
+          CHECK_FALSE(buffer.IndexOf(value).has_value());
+          CHECK_FALSE(buffer.Contains(value));
+        } else {
+          CHECK(buffer.IndexOf(value) == found - elems.cbegin());
+          CHECK(buffer.Contains(value));
+        }
+      }
+    }
+
+    WHEN("setting the last element") {
+      REQUIRE(buffer.Set(size - 1, -1));
+
+      THEN("value should be changed") {
+        CHECK(buffer.Get(size - 1) == -1);
+      }
+    }
+
+    AND_WHEN("clearing the buffer") {
+      const int capacity = buffer.capacity();
+      buffer.Clear();
+
+      THEN("buffer should be empty, capacity should be preserved") {
+        CHECK(buffer.IsEmpty());
+        CHECK(buffer.capacity() == capacity);
+      }
+    }
+  }
+}
+
+SCENARIO("GapBuffer cursor-edit trace") {
+
+  GIVEN("buffer and a reference vector") {
+    auto buffer = GapBuffer(1);
+    auto expected = std::vector<int>();
+
+    auto engine = std::mt19937(7);
+
+    WHEN("replaying random local edits around a moving cursor") {
+      int cursor = 0;
+      for (int step = 0; step < 2000; step++) {
+        const int size = static_cast<int>(expected.size());
+        cursor = std::uniform_int_distribution<>(std::max(0, cursor - 3), std::min(size, cursor + 3))(engine);
+
+        if ((size > 0)&&(cursor < size)&&(engine() % 3 == 0)) {
+          REQUIRE(buffer.Remove(cursor) == expected[static_cast<std::size_t>(cursor)]);
+          expected.erase(expected.begin() + cursor);
+        } else {
+          REQUIRE(buffer.Insert(cursor, step));
+          expected.insert(expected.begin() + cursor, step);
+        }
+      }
+
+      THEN("buffer should match the reference") {
+        CHECK_THAT(buffer.toVector(), Equals(expected));
+      }
+    }
+  }
+}
+
+SCENARIO("GapBuffer copy and move") {
+
+  GIVEN("buffer with the gap in the middle") {
+    const auto elems = utils::rand_array(20, 0, 100);
+
+    auto buffer = MakeBuffer(elems);
+    buffer.MoveCursor(7);
+
+    WHEN("copying the buffer") {
+      auto copy = buffer;
+      copy.Set(0, -1);
+
+      THEN("copy should be independent") {
+        CHECK_THAT(buffer.toVector(), Equals(elems));
+        CHECK(copy.Get(0) == -1);
+        CHECK(copy.cursor() == 7);
+      }
+    }
+
+    AND_WHEN("moving the buffer") {
+      const auto moved = std::move(buffer);
+
+      THEN("elements should be moved") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+      }
+    }
+  }
+}
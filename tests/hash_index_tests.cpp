@@ -0,0 +1,269 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>      // find, min
+#include <climits>        // INT_MIN, INT_MAX
+#include <iterator>       // distance
+#include <random>         // mt19937, uniform_int_distribution
+#include <thread>         // thread
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/hash_index.hpp"     // HashIndex
+
+using assignment::DynamicArray;
+using assignment::HashIndex;
+
+namespace {
+
+  // позиция первого вхождения значения в массиве (просмотром)
+  int LinearFind(const DynamicArray& array, int value) {
+    const auto first = std::find(array.begin(), array.end(), value);
+    return first == array.end() ? -1 : static_cast<int>(std::distance(array.begin(), first));
+  }
+
+  // результаты поиска по индексу совпадают с просмотром для значений [low, high]
+  void RequireConsistent(const DynamicArray& array, int low, int high) {
+    for (int value = low; value <= high; value++) {
+      const int expected = LinearFind(array, value);
+      const auto found = array.IndexOf(value);
+      REQUIRE(found.value_or(-1) == expected);
+      REQUIRE(array.Contains(value) == (expected >= 0));
+    }
+  }
+
+}  // namespace
+
+SCENARIO("HashIndex") {
+
+  GIVEN("index and a model of it") {
+    auto index = HashIndex();
+    auto model = std::unordered_map<int, int>();
+
+    // узкий диапазон значений - много совпадений и длинные цепочки пробирования
+    const int range = GENERATE(8, 1000, INT_MAX);
+    auto engine = std::mt19937(static_cast<std::uint32_t>(range));
+    auto dist = std::uniform_int_distribution<>(range == INT_MAX ? INT_MIN : -range, range);
+
+    WHEN("performing random additions, assignments, erasures and shifts") {
+      for (int step = 0; step < 20000; step++) {
+        const int key = dist(engine);
+        const int position = static_cast<int>(engine() % 1000);
+        switch (engine() % 8) {
+          case 0:
+          case 1:
+          case 2:
+            index.Add(key, position);
+            if ((model.count(key) == 0)||(position < model[key])) {
+              model[key] = position;
+            }
+            break;
+          case 3:
+            index.Assign(key, position);
+            model[key] = position;
+            break;
+          case 4:
+          case 5:
+            REQUIRE(index.Erase(key) == (model.erase(key) == 1));
+            break;
+          case 6:
+            if (step % 64 == 0) {
+              index.Shift(position, 3);
+              for (auto& [_, first] : model) {
+                first += first >= position ? 3 : 0;
+              }
+            }
+            break;
+          default:
+            REQUIRE(index.Find(key) == (model.count(key) == 0 ? HashIndex::kEmpty : model[key]));
+        }
+        REQUIRE(index.size() == static_cast<int>(model.size()));
+      }
+
+      THEN("index should hold the same first positions as the model") {
+        for (const auto& [key, first] : model) {
+          REQUIRE(index.Find(key) == first);
+        }
+      }
+
+      AND_THEN("table should be at most half full") {
+        CHECK(index.memory_usage() >= 2 * model.size() * 2 * sizeof(int));
+      }
+
+      AND_THEN("copy should be independent of the original") {
+        auto copy = HashIndex(index);
+        copy.Clear();
+        CHECK(copy.size() == 0);
+        CHECK(index.size() == static_cast<int>(model.size()));
+      }
+    }
+  }
+
+  GIVEN("sequence of values") {
+    const auto values = utils::rand_array(5000, -50, 50);
+
+    WHEN("building the index") {
+      auto index = HashIndex();
+      index.Invalidate();
+      index.Build(values.data(), static_cast<int>(values.size()));
+
+      THEN("index should map each value to its first position") {
+        CHECK_FALSE(index.stale());
+        for (int value = -60; value <= 60; value++) {
+          const auto first = std::find(values.begin(), values.end(), value);
+          const int expected = first == values.end() ? -1 : static_cast<int>(std::distance(values.begin(), first));
+          REQUIRE(index.Find(value) == expected);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("DynamicArray::EnableHashIndex") {
+
+  GIVEN("array with hash index") {
+    const auto elems = utils::rand_array(GENERATE(0, 1, 100, 1000), -20, 20);
+
+    auto array = DynamicArray(1);
+    array.AddRange(elems.data(), static_cast<int>(elems.size()));
+    array.EnableHashIndex();
+
+    THEN("lookups should match a linear scan") {
+      CHECK(array.has_hash_index());
+      RequireConsistent(array, -25, 25);
+    }
+
+    WHEN("performing random modifications") {
+      auto engine = std::mt19937(static_cast<std::uint32_t>(elems.size()));
+      auto value = std::uniform_int_distribution<>(-25, 25);
+
+      for (int step = 0; step < 2000; step++) {
+        const int size = array.size();
+        const int position = size == 0 ? 0 : static_cast<int>(engine() % static_cast<unsigned>(size));
+        switch (engine() % 12) {
+          case 0:
+          case 1:
+            array.Add(value(engine));
+            break;
+          case 2:
+          case 3:
+            array.Insert(position, value(engine));
+            break;
+          case 4:
+          case 5:
+            array.Set(position, value(engine));
+            break;
+          case 6:
+          case 7:
+            array.Remove(position);
+            break;
+          case 8: {
+            const int values[] = {value(engine), value(engine), value(engine)};
+            array.InsertRange(position, values, 3);
+            break;
+          }
+          case 9:
+            array.RemoveRange(position, std::min(3, size - position));
+            break;
+          case 10:
+            array.Fill(position, std::min(2, size - position), value(engine));
+            break;
+          default:
+            if (size > 0) {
+              array.span()[position] = value(engine);
+            }
+        }
+        const auto& view = array;
+        RequireConsistent(view, -25, 25);
+      }
+
+      THEN("index should only take memory proportional to the distinct values") {
+        CHECK(array.hash_index_memory_usage() > 0);
+        CHECK(array.hash_index_memory_usage() <= 64 * 2 * sizeof(int) * 2);
+      }
+    }
+
+    AND_WHEN("clearing and assigning new contents") {
+      array.Clear();
+      const auto& view = array;
+      CHECK_FALSE(view.Contains(elems.empty() ? 0 : elems[0]));
+
+      array.Assign(7, 5);
+      RequireConsistent(view, -25, 25);
+      CHECK(view.IndexOf(5) == 0);
+
+      const int indices[] = {3, 6};
+      const int values[] = {-1, -2};
+      array.SetMany(indices, values, 2);
+
+      THEN("lookups should match a linear scan") {
+        RequireConsistent(view, -25, 25);
+        CHECK(view.IndexOf(-2) == 6);
+      }
+    }
+
+    AND_WHEN("copying, moving and snapshotting the array") {
+      auto copy = array;
+      copy.Add(100);
+      auto moved = std::move(copy);
+      const auto snapshot = array.Snapshot();
+
+      THEN("copies should keep their own index") {
+        CHECK(moved.has_hash_index());
+        CHECK(moved.IndexOf(100) == static_cast<int>(elems.size()));
+        CHECK_FALSE(array.Contains(100));
+      }
+
+      AND_THEN("snapshot should search without an index") {
+        CHECK_FALSE(snapshot.has_hash_index());
+        RequireConsistent(snapshot, -25, 25);
+      }
+    }
+
+    AND_WHEN("searching from several threads after modifying elements through the view") {
+      if (array.size() > 0) {
+        array.span()[array.size() - 1] = 100;
+      }
+      const auto& view = array;
+
+      // каждый поток ищет все значения [-25, 100] в одном и том же константном массиве
+      std::vector<std::vector<int>> found(4);
+      std::vector<std::thread> threads;
+      for (auto& results : found) {
+        threads.emplace_back([&view, &results]() {
+          for (int value = -25; value <= 100; value++) {
+            results.push_back(view.IndexOf(value).value_or(-1));
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+
+      THEN("every thread should get the results of a linear scan") {
+        for (const auto& results : found) {
+          for (int value = -25; value <= 100; value++) {
+            REQUIRE(results[static_cast<std::size_t>(value + 25)] == LinearFind(view, value));
+          }
+        }
+      }
+
+      AND_THEN("index should be rebuilt by the next modification") {
+        array.Add(101);
+        RequireConsistent(view, -25, 101);
+      }
+    }
+
+    AND_WHEN("disabling the index") {
+      array.DisableHashIndex();
+
+      THEN("lookups should fall back to a linear scan") {
+        CHECK_FALSE(array.has_hash_index());
+        CHECK(array.hash_index_memory_usage() == 0);
+        RequireConsistent(array, -25, 25);
+      }
+    }
+  }
+}
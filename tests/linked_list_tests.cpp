@@ -1,6 +1,8 @@
 #include <catch2/catch.hpp>
 
-#include <algorithm>  // find
+#include <algorithm>  // count, find, reverse, transform
+#include <iterator>   // distance
+#include <numeric>    // accumulate
 
 #include "utils.hpp"  // rand_array
 
@@ -281,6 +283,20 @@ SCENARIO("LinkedList::IndexOf") {
         CHECK(list.IndexOf(find_elem) == find_index);
       }
     }
+
+    AND_WHEN("finding index of a missing element") {
+      THEN("nothing should be found") {
+        CHECK_FALSE(list.IndexOf(-1).has_value());
+      }
+    }
+  }
+
+  GIVEN("empty list") {
+    const auto list = LinkedList();
+
+    THEN("nothing should be found") {
+      CHECK_FALSE(list.IndexOf(0).has_value());
+    }
   }
 }
 
@@ -302,6 +318,20 @@ SCENARIO("LinkedList::Contains") {
         CHECK(list.Contains(elem));
       }
     }
+
+    AND_WHEN("checking if it contains a missing element") {
+      THEN("contains should return false") {
+        CHECK_FALSE(list.Contains(-1));
+      }
+    }
+  }
+
+  GIVEN("empty list") {
+    const auto list = LinkedList();
+
+    THEN("contains should return false") {
+      CHECK_FALSE(list.Contains(0));
+    }
   }
 }
 
@@ -546,4 +576,306 @@ SCENARIO("LinkedList::Clear") {
       }
     }
   }
-}
\ No newline at end of file
+}
+
+SCENARIO("LinkedList iterators") {
+
+  GIVEN("list with zero or more elements") {
+    const int size = GENERATE(range(0, 11));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto list = LinkedList(elems);
+
+    WHEN("iterating over the list") {
+      const std::vector<int> values(list.cbegin(), list.cend());
+
+      THEN("elements should be visited from front to back") {
+        CHECK_THAT(values, Equals(elems));
+        CHECK(std::distance(list.begin(), list.end()) == size);
+      }
+    }
+
+    AND_WHEN("changing elements through iterators") {
+      for (int& value : list) {
+        value = -value;
+      }
+
+      THEN("list elements should be changed in place") {
+        auto expected = elems;
+        std::transform(expected.begin(), expected.end(), expected.begin(), [](int v) { return -v; });
+        CHECK_THAT(list.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("using standard algorithms") {
+      const auto& const_list = list;
+
+      THEN("results should match the vector of elements") {
+        CHECK(std::count(const_list.begin(), const_list.end(), 50) == std::count(elems.begin(), elems.end(), 50));
+        CHECK(std::accumulate(const_list.begin(), const_list.end(), 0) == std::accumulate(elems.begin(), elems.end(), 0));
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedList::GetMany/SetMany") {
+
+  GIVEN("list with one or more elements") {
+    const int size = GENERATE(1, 10, 100);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto list = LinkedList(elems);
+
+    AND_GIVEN("unordered indices in [0, size) with repetitions") {
+      const int count = GENERATE(0, 1, 5, 50);
+      const auto indices = utils::rand_array(count, 0, size - 1);
+
+      WHEN("getting elements by indices") {
+        std::vector<int> out(static_cast<std::size_t>(count));
+        REQUIRE(list.GetMany(indices.data(), count, out.data()));
+
+        THEN("values should be returned in the order of indices") {
+          for (int i = 0; i < count; i++) {
+            CHECK(out[static_cast<std::size_t>(i)] == elems[static_cast<std::size_t>(indices[static_cast<std::size_t>(i)])]);
+          }
+        }
+      }
+
+      AND_WHEN("setting elements by indices") {
+        const auto values = utils::rand_array(count, -100, -1);
+        REQUIRE(list.SetMany(indices.data(), values.data(), count));
+
+        auto expected = elems;
+        for (int i = 0; i < count; i++) {
+          expected[static_cast<std::size_t>(indices[static_cast<std::size_t>(i)])] = values[static_cast<std::size_t>(i)];
+        }
+
+        THEN("the last value for each index should be stored") {
+          CHECK_THAT(list.toVector(), Equals(expected));
+        }
+      }
+    }
+
+    AND_GIVEN("indices with one outside [0, size)") {
+      const int bad = GENERATE_COPY(-1, size);
+      const std::vector<int> indices = {bad, 0};
+
+      WHEN("getting or setting elements by indices") {
+        std::vector<int> out(2, 42);
+        const std::vector<int> values = {-1, -2};
+
+        THEN("nothing should be read or changed") {
+          CHECK_FALSE(list.GetMany(indices.data(), 2, out.data()));
+          CHECK(out == std::vector<int>(2, 42));
+          CHECK_FALSE(list.SetMany(indices.data(), values.data(), 2));
+          CHECK_THAT(list.toVector(), Equals(elems));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedList finger") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(1, 2, 100);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto list = LinkedList(elems);
+
+    WHEN("reading elements in order, backwards and with jumps") {
+      std::vector<int> forward;
+      for (int i = 0; i < size; i++) {
+        forward.push_back(*list.Get(i));
+      }
+      std::vector<int> backward;
+      for (int i = size - 1; i >= 0; i--) {
+        backward.push_back(*list.Get(i));
+      }
+      std::reverse(backward.begin(), backward.end());
+
+      THEN("values should match the elements") {
+        CHECK_THAT(forward, Equals(elems));
+        CHECK_THAT(backward, Equals(elems));
+        CHECK(list.FindNode(size / 2) == list.FindNode(size / 2));
+        CHECK(list.Get(size / 3) == elems[static_cast<std::size_t>(size / 3)]);
+      }
+    }
+
+    AND_WHEN("interleaving positional reads with insertions and removals") {
+      auto expected = elems;
+      for (int i = 0; i < 300; i++) {
+        const int index = (i * 37) % list.size();
+        REQUIRE(list.Get(index) == expected[static_cast<std::size_t>(index)]);
+        switch (i % 4) {
+          case 0:
+            list.Insert(index / 2, -i);
+            expected.insert(expected.begin() + index / 2, -i);
+            break;
+          case 1:
+            if (list.size() > 1) {
+              REQUIRE(list.Remove(index) == expected[static_cast<std::size_t>(index)]);
+              expected.erase(expected.begin() + index);
+            }
+            break;
+          case 2:
+            list.Insert(0, i);
+            expected.insert(expected.begin(), i);
+            break;
+          default:
+            if (list.size() > 1) {
+              REQUIRE(list.Remove(0) == expected.front());
+              expected.erase(expected.begin());
+            }
+        }
+        REQUIRE(list.Set(index % list.size(), i));
+        expected[static_cast<std::size_t>(index % list.size())] = i;
+      }
+
+      THEN("list should stay consistent with the expected elements") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+        for (int i = 0; i < list.size(); i++) {
+          REQUIRE(list.Get(i) == expected[static_cast<std::size_t>(i)]);
+        }
+      }
+    }
+
+    AND_WHEN("reading an element and clearing the list") {
+      list.Get(size - 1);
+      list.Get(size / 2);
+      list.Clear();
+      list.Add(7);
+      list.Add(8);
+
+      THEN("finger should not point to released nodes") {
+        CHECK(list.Get(0) == 7);
+        CHECK(list.Get(1) == 8);
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedList::Cursor") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(1, 2, 100);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto list = LinkedList(elems);
+
+    WHEN("walking the list with a cursor") {
+      std::vector<int> visited;
+      auto cursor = list.cursor();
+      do {
+        visited.push_back(*cursor.value());
+      } while (cursor.Next());
+
+      THEN("all elements should be visited and cursor should reach the end") {
+        CHECK_THAT(visited, Equals(elems));
+        CHECK(cursor.IsEnd());
+        CHECK(cursor.index() == size);
+        CHECK_FALSE(cursor.value().has_value());
+        CHECK_FALSE(cursor.Next());
+        CHECK_FALSE(cursor.InsertAfter(0));
+        CHECK_FALSE(cursor.RemoveAfter().has_value());
+      }
+    }
+
+    AND_WHEN("inserting after every element") {
+      for (auto cursor = list.cursor(); !cursor.IsEnd(); cursor.Next()) {
+        REQUIRE(cursor.InsertAfter(-*cursor.value()));
+        cursor.Next();
+      }
+
+      std::vector<int> expected;
+      for (int elem : elems) {
+        expected.push_back(elem);
+        expected.push_back(-elem);
+      }
+
+      THEN("inserted elements should follow their originals") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK(list.size() == 2 * size);
+        CHECK(list.back() == -elems.back());
+        CHECK(list.Get(2 * size - 2) == elems.back());
+      }
+    }
+
+    AND_WHEN("removing every second element") {
+      list.Get(size - 1);
+      for (auto cursor = list.cursor(); !cursor.IsEnd(); cursor.Next()) {
+        cursor.RemoveAfter();
+      }
+
+      std::vector<int> expected;
+      for (int i = 0; i < size; i += 2) {
+        expected.push_back(elems[static_cast<std::size_t>(i)]);
+      }
+
+      THEN("remaining elements should be accessible by index") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK(list.back() == expected.back());
+        for (int i = 0; i < list.size(); i++) {
+          REQUIRE(list.Get(i) == expected[static_cast<std::size_t>(i)]);
+        }
+      }
+    }
+
+    AND_WHEN("setting values through a cursor created at an index") {
+      auto cursor = list.cursor(size / 2);
+      cursor.Set(-1);
+
+      THEN("value should be changed at the cursor index") {
+        CHECK(cursor.index() == size / 2);
+        CHECK(list.Get(size / 2) == -1);
+        CHECK(list.cursor(size).IsEnd());
+        CHECK(list.cursor(-1).IsEnd());
+      }
+    }
+  }
+
+  AND_GIVEN("list of elements and cursors created before other changes") {
+    auto list = LinkedList(std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    const auto check_get = [&list]() {
+      const auto values = list.toVector();
+      for (int i = 0; i < list.size(); i++) {
+        REQUIRE(list.Get(i) == values[static_cast<std::size_t>(i)]);
+      }
+    };
+
+    WHEN("inserting at the front and then after the cursor") {
+      auto cursor = list.cursor(5);
+      list.Insert(0, -1);
+      // палец на узле курсора, индекс курсора устарел
+      list.Get(6);
+      cursor.InsertAfter(555);
+
+      THEN("elements should be accessible by index") {
+        CHECK_THAT(list.toVector(), Equals(std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 555, 6, 7, 8, 9}));
+        CHECK(list.Get(7) == 555);
+        check_get();
+      }
+    }
+
+    AND_WHEN("changing the list with two cursors") {
+      auto first = list.cursor(2);
+      auto second = list.cursor(6);
+      first.InsertAfter(100);
+      // палец на узле второго курсора, индекс второго курсора устарел
+      list.Get(7);
+      second.InsertAfter(200);
+      const auto inserted = list.Get(8);
+      first.RemoveAfter();
+      list.Get(7);
+      second.RemoveAfter();
+
+      THEN("elements should be accessible by index") {
+        CHECK(inserted == 200);
+        CHECK_THAT(list.toVector(), Equals(std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+        CHECK(list.Get(8) == 8);
+        check_get();
+      }
+    }
+  }
+}
@@ -174,3 +174,32 @@ SCENARIO("LinkedQueue::Clear") {
     }
   }
 }
+
+SCENARIO("LinkedQueue iterators") {
+
+  GIVEN("queue with zero or more elements") {
+    const int size = GENERATE(range(0, 11));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto queue = LinkedQueue(elems);
+
+    WHEN("iterating over the queue") {
+      const std::vector<int> values(queue.begin(), queue.end());
+
+      THEN("elements should be visited from front to back") {
+        CHECK(values == elems);
+      }
+    }
+
+    AND_WHEN("dequeuing an element") {
+      if (size > 0) {
+        queue.Dequeue();
+
+        THEN("iteration should start from the new front") {
+          const std::vector<int> values(queue.begin(), queue.end());
+          CHECK(values == std::vector<int>(elems.begin() + 1, elems.end()));
+        }
+      }
+    }
+  }
+}
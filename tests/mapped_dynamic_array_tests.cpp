@@ -0,0 +1,202 @@
+#include <catch2/catch.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>   // find
+#include <filesystem>  // file_size, resize_file
+#include <fstream>     // ofstream
+#include <string>      // string, to_string
+
+#include "utils.hpp"  // rand_array, TempFile
+
+#include "assignment/mapped_dynamic_array.hpp"  // MappedDynamicArray
+
+using assignment::MappedDynamicArray;
+using utils::TempFile;
+
+using Catch::Matchers::Equals;
+
+SCENARIO("MappedDynamicArray::MappedDynamicArray") {
+
+  GIVEN("path to a missing file") {
+    const TempFile file;
+
+    WHEN("creating array") {
+      const int capacity = GENERATE(range(1, 6));
+      const auto array = MappedDynamicArray(file.path, capacity);
+
+      THEN("array should be empty with the specified capacity") {
+        CHECK(array.IsEmpty());
+        CHECK(array.capacity() == capacity);
+      }
+
+      AND_THEN("file should hold the header and the cells") {
+        CHECK(std::filesystem::file_size(file.path) ==
+              static_cast<std::uintmax_t>(MappedDynamicArray::kDataOffset) + capacity * sizeof(int));
+      }
+    }
+
+    AND_WHEN("creating array by specifying capacity <= 0") {
+      const int capacity = GENERATE(range(-5, 1));
+
+      THEN("constructor should throw an exception") {
+        CHECK_THROWS(MappedDynamicArray(file.path, capacity));
+      }
+    }
+  }
+
+  AND_GIVEN("file of another format") {
+    const TempFile file;
+    std::ofstream(file.path) << std::string(MappedDynamicArray::kDataOffset + 16, 'x');
+
+    WHEN("opening the file") {
+      THEN("constructor should throw an exception") {
+        CHECK_THROWS_AS(MappedDynamicArray(file.path), std::runtime_error);
+      }
+    }
+  }
+
+  AND_GIVEN("file that is shorter than the header") {
+    const TempFile file;
+    std::ofstream(file.path) << "short";
+
+    WHEN("opening the file") {
+      THEN("constructor should throw an exception") {
+        CHECK_THROWS_AS(MappedDynamicArray(file.path), std::runtime_error);
+      }
+    }
+  }
+
+  AND_GIVEN("path in a missing directory") {
+    WHEN("creating array") {
+      THEN("constructor should throw a system error") {
+        CHECK_THROWS_AS(MappedDynamicArray("/nonexistent-directory/array.bin"), std::system_error);
+      }
+    }
+  }
+}
+
+SCENARIO("MappedDynamicArray reopening") {
+
+  GIVEN("array with zero or more elements stored in a file") {
+    const TempFile file;
+    const int size = GENERATE(0, 1, 10, 1000);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    {
+      auto array = MappedDynamicArray(file.path, 1);
+      for (int elem : elems) {
+        array.Add(elem);
+      }
+      array.Sync();
+    }
+
+    WHEN("reopening the file") {
+      auto array = MappedDynamicArray(file.path);
+
+      THEN("elements should be preserved") {
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+
+      AND_WHEN("modifying and reopening the file again") {
+        array.Insert(0, -1);
+        array.Remove(array.size() - 1);
+        array.Add(-2);
+
+        auto expected = elems;
+        expected.insert(expected.begin(), -1);
+        expected.pop_back();
+        expected.push_back(-2);
+
+        const auto reopened = MappedDynamicArray(file.path);
+
+        THEN("changes should be visible") {
+          CHECK_THAT(reopened.toVector(), Equals(expected));
+        }
+      }
+    }
+
+    AND_WHEN("the file is truncated") {
+      if (size > 1) {
+        std::filesystem::resize_file(file.path, static_cast<std::uintmax_t>(MappedDynamicArray::kDataOffset) + 4);
+
+        THEN("reopening should detect the corrupted header") {
+          CHECK_THROWS_AS(MappedDynamicArray(file.path), std::runtime_error);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("MappedDynamicArray operations") {
+
+  GIVEN("array with zero or more elements") {
+    const TempFile file;
+    const int size = GENERATE(range(0, 12));
+    const auto elems = utils::rand_array(size, 0, 10);
+
+    auto array = MappedDynamicArray(file.path, 2);
+    for (int elem : elems) {
+      array.Add(elem);
+    }
+
+    WHEN("inserting an element at index in [0, size]") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+
+      REQUIRE(array.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted") {
+        CHECK_THAT(array.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("accessing elements at index outside [0, size)") {
+      THEN("operations should fail") {
+        CHECK_FALSE(array.Insert(-1, 0));
+        CHECK_FALSE(array.Insert(size + 1, 0));
+        CHECK_FALSE(array.Set(size, 0));
+        CHECK_FALSE(array.Get(size).has_value());
+        CHECK_FALSE(array.Remove(size).has_value());
+      }
+    }
+
+    AND_WHEN("searching for elements") {
+      THEN("first occurrence should be found") {
+        for (int elem : elems) {
+          const auto expected = std::find(elems.begin(), elems.end(), elem) - elems.begin();
+          CHECK(array.IndexOf(elem) == expected);
+          CHECK(array.Contains(elem));
+        }
+        CHECK_FALSE(array.Contains(-1));
+      }
+    }
+
+    AND_WHEN("resizing the array") {
+      const int capacity = array.capacity();
+
+      REQUIRE(array.Resize(capacity + 100));
+      REQUIRE_FALSE(array.Resize(capacity));
+
+      THEN("elements should be preserved") {
+        CHECK(array.capacity() == capacity + 100);
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("clearing the array") {
+      const int capacity = array.capacity();
+      array.Clear();
+
+      THEN("array should be empty, capacity should be preserved") {
+        CHECK(array.IsEmpty());
+        CHECK(array.capacity() == capacity);
+      }
+    }
+  }
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,236 @@
+#include <catch2/catch.hpp>
+
+#include <new>        // placement new
+#include <set>        // set
+#include <stdexcept>  // invalid_argument
+#include <vector>     // vector
+
+#include "utils.hpp"  // rand_array, CountingResource
+
+#include "assignment/linked_list.hpp"   // LinkedList
+#include "assignment/linked_queue.hpp"  // LinkedQueue
+#include "assignment/node.hpp"          // Node
+#include "assignment/node_pool.hpp"     // NodePool
+
+using assignment::LinkedList;
+using assignment::LinkedQueue;
+using assignment::Node;
+using assignment::NodePool;
+using utils::CountingResource;
+
+using Catch::Matchers::Equals;
+
+SCENARIO("NodePool") {
+
+  GIVEN("pool with a counting memory resource") {
+    CountingResource resource;
+    auto pool = NodePool<Node>(&resource);
+
+    WHEN("creating nodes") {
+      const int count = GENERATE(1, NodePool<Node>::kInitSlabCapacity, 10000);
+      std::set<Node*> nodes;
+      for (int i = 0; i < count; i++) {
+        Node* node = pool.New(i);
+        CHECK(node->value == i);
+        nodes.insert(node);
+      }
+
+      THEN("nodes should be distinct and allocated in slabs") {
+        CHECK(static_cast<int>(nodes.size()) == count);
+        CHECK(pool.live_count() == count);
+        CHECK(pool.slab_count() == resource.allocations);
+        CHECK(resource.allocations < count / NodePool<Node>::kInitSlabCapacity + 8);
+      }
+
+      AND_WHEN("deleting and creating the same number of nodes") {
+        const int allocations = resource.allocations;
+        for (Node* node : nodes) {
+          pool.Delete(node);
+        }
+        CHECK(pool.live_count() == 0);
+
+        std::set<Node*> reused;
+        for (int i = 0; i < count; i++) {
+          reused.insert(pool.New(i));
+        }
+
+        THEN("deleted cells should be reused without new slabs") {
+          CHECK(resource.allocations == allocations);
+          CHECK(reused == nodes);
+        }
+      }
+
+      AND_WHEN("resetting the pool") {
+        pool.Reset();
+
+        THEN("only the largest slab should be kept") {
+          CHECK(pool.slab_count() == 1);
+          CHECK(pool.live_count() == 0);
+          CHECK(resource.allocations - resource.deallocations == 1);
+        }
+      }
+
+      AND_WHEN("releasing the pool") {
+        pool.Release();
+
+        THEN("all slabs should be returned to the resource") {
+          CHECK(pool.slab_count() == 0);
+          CHECK(resource.allocations == resource.deallocations);
+        }
+      }
+    }
+
+    AND_WHEN("allocating a block of nodes") {
+      pool.New(-1);
+      Node* block = pool.NewBlock(100);
+      for (int i = 0; i < 100; i++) {
+        new (block + i) Node(i);
+      }
+      pool.Delete(block + 50);
+      Node* reused = pool.New(42);
+
+      THEN("block should be a separate slab and its cells should be reusable") {
+        CHECK(pool.slab_count() == 2);
+        CHECK(pool.live_count() == 101);
+        CHECK(reused == block + 50);
+        CHECK(block[99].value == 99);
+      }
+    }
+  }
+
+  WHEN("creating pool with null resource") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS_AS(NodePool<Node>(nullptr), std::invalid_argument);
+    }
+  }
+}
+
+SCENARIO("LinkedQueue node pool") {
+
+  GIVEN("queue with a counting memory resource") {
+    CountingResource resource;
+    auto queue = LinkedQueue(&resource);
+    const int backlog = GENERATE(1, 100, 5000);
+
+    for (int i = 0; i < backlog; i++) {
+      queue.Enqueue(i);
+    }
+
+    WHEN("performing steady-state enqueue/dequeue") {
+      const int allocations = resource.allocations;
+      for (int i = 0; i < 100000; i++) {
+        queue.Enqueue(backlog + i);
+        REQUIRE(queue.Dequeue());
+      }
+
+      THEN("no memory should be allocated") {
+        CHECK(resource.allocations == allocations);
+        CHECK(queue.size() == backlog);
+        CHECK(queue.front() == 100000);
+        CHECK(queue.back() == backlog + 99999);
+        CHECK(queue.pool().live_count() == backlog);
+      }
+    }
+
+    AND_WHEN("draining and clearing the queue") {
+      while (queue.Dequeue()) {
+      }
+      queue.Enqueue(7);
+      queue.Clear();
+
+      THEN("nodes should be returned to the pool") {
+        CHECK(queue.IsEmpty());
+        CHECK_FALSE(queue.back().has_value());
+        CHECK(queue.pool().live_count() == 0);
+        CHECK(queue.pool().slab_count() == 1);
+      }
+
+      AND_THEN("queue should be reusable") {
+        queue.Enqueue(1);
+        queue.Enqueue(2);
+        CHECK_THAT(queue.toVector(), Equals(std::vector<int>{1, 2}));
+      }
+    }
+
+    AND_WHEN("destroying the queue") {
+      {
+        auto other = LinkedQueue(&resource);
+        other.Enqueue(1);
+      }
+      queue = LinkedQueue();
+
+      THEN("all slabs should be returned to the resource") {
+        CHECK(resource.allocations == resource.deallocations);
+      }
+    }
+  }
+}
+
+SCENARIO("LinkedList node pool") {
+
+  GIVEN("list with a counting memory resource") {
+    CountingResource resource;
+    auto list = LinkedList(&resource);
+    const auto elems = utils::rand_array(GENERATE(1, 10, 1000), -100, 100);
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+
+    WHEN("removing and inserting elements in turns") {
+      const int allocations = resource.allocations;
+      for (int i = 0; i < 1000; i++) {
+        const int index = i % list.size();
+        const auto removed = list.Remove(index);
+        REQUIRE(removed.has_value());
+        REQUIRE(list.Insert(index, *removed));
+      }
+
+      THEN("no memory should be allocated and elements should stay") {
+        CHECK(resource.allocations == allocations);
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing the last elements") {
+      while (list.size() > 1) {
+        list.Remove(list.size() - 1);
+      }
+      list.Remove(0);
+      list.Add(5);
+
+      THEN("front and back should point to the new element") {
+        CHECK(list.front() == 5);
+        CHECK(list.back() == 5);
+        CHECK(list.pool().live_count() == 1);
+      }
+    }
+
+    AND_WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("one slab should be kept") {
+        CHECK(list.IsEmpty());
+        CHECK(list.pool().slab_count() == 1);
+        CHECK(resource.allocations - resource.deallocations == 1);
+      }
+    }
+
+    AND_WHEN("copying the list") {
+      auto copy = list;
+      copy.Set(0, 1000);
+      copy.Add(-1);
+
+      auto assigned = LinkedList();
+      assigned.Add(42);
+      assigned = list;
+
+      THEN("copies should be independent and use the same resource") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+        CHECK(copy.size() == list.size() + 1);
+        CHECK(copy.front() == 1000);
+        CHECK(copy.pool().resource() == &resource);
+        CHECK_THAT(assigned.toVector(), Equals(elems));
+      }
+    }
+  }
+}
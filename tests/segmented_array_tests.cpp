@@ -0,0 +1,221 @@
+#include <catch2/catch.hpp>
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/segmented_array.hpp"  // SegmentedArray
+
+using assignment::SegmentedArray;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  constexpr int kChunk = SegmentedArray::kChunkSize;
+
+  SegmentedArray MakeArray(const std::vector<int>& elems) {
+    auto array = SegmentedArray();
+    for (int elem : elems) {
+      array.Add(elem);
+    }
+    return array;
+  }
+
+}  // namespace
+
+SCENARIO("SegmentedArray::SegmentedArray") {
+
+  WHEN("creating array using default constructor") {
+    const auto array = SegmentedArray();
+
+    THEN("array should be empty and own no chunks") {
+      CHECK(array.IsEmpty());
+      CHECK(array.capacity() == 0);
+      CHECK_FALSE(array.Get(0).has_value());
+    }
+  }
+}
+
+SCENARIO("SegmentedArray::Add") {
+
+  GIVEN("empty array") {
+    const int size = GENERATE(1, kChunk - 1, kChunk, kChunk + 1, 5 * kChunk + 7);
+    const auto elems = utils::rand_array(size, -100, 100);
+
+    auto array = SegmentedArray();
+
+    WHEN("adding elements across chunk boundaries") {
+      array.Add(elems[0]);
+      const int* first = array.At(0);
+
+      for (std::size_t i = 1; i < elems.size(); i++) {
+        array.Add(elems[i]);
+      }
+
+      THEN("elements should be appended in order") {
+        CHECK(array.size() == size);
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+
+      AND_THEN("capacity should be a whole number of chunks") {
+        CHECK(array.capacity() % kChunk == 0);
+        CHECK(array.capacity() - array.size() < kChunk);
+      }
+
+      AND_THEN("existing elements should not move") {
+        CHECK(array.At(0) == first);
+        CHECK(*first == elems[0]);
+      }
+    }
+  }
+}
+
+SCENARIO("SegmentedArray::Insert/Remove") {
+
+  GIVEN("array spanning several chunks") {
+    const int size = GENERATE(0, 3, kChunk, 2 * kChunk + 5);
+    const auto elems = utils::rand_array(size, 0, 1000);
+
+    auto array = MakeArray(elems);
+
+    WHEN("inserting an element at chunk edges and in between") {
+      const int index = GENERATE_COPY(filter([=](int i) { return i <= size; },
+                                             values({0, 1, kChunk - 1, kChunk, kChunk + 1, 2 * kChunk, size})));
+
+      REQUIRE(array.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted and the rest shifted right") {
+        CHECK_THAT(array.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      CHECK_FALSE(array.Insert(-1, 0));
+      CHECK_FALSE(array.Insert(size + 1, 0));
+
+      THEN("array should not be changed") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing an element at chunk edges and in between") {
+      if (size > 0) {
+        const int index = GENERATE_COPY(filter([=](int i) { return i < size; },
+                                               values({0, 1, kChunk - 1, kChunk, kChunk + 1, 2 * kChunk, size - 1})));
+
+        const auto removed = array.Remove(index);
+
+        auto expected = elems;
+        expected.erase(expected.begin() + index);
+
+        THEN("removed element should be returned and the rest shifted left") {
+          CHECK(removed == elems[static_cast<std::size_t>(index)]);
+          CHECK_THAT(array.toVector(), Equals(expected));
+        }
+      }
+    }
+
+    AND_WHEN("removing an element at index outside [0, size)") {
+      CHECK_FALSE(array.Remove(-1).has_value());
+      CHECK_FALSE(array.Remove(size).has_value());
+
+      THEN("array should not be changed") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("SegmentedArray::Get/Set/IndexOf") {
+
+  GIVEN("array of unique elements spanning several chunks") {
+    const int size = 3 * kChunk + 11;
+    const auto elems = utils::rand_array(size, 0, 10 * size, true);
+
+    auto array = MakeArray(elems);
+
+    WHEN("reading and searching each element") {
+      THEN("each element should be found at its index") {
+        for (int i = 0; i < size; i++) {
+          REQUIRE(array.Get(i) == elems[static_cast<std::size_t>(i)]);
+          REQUIRE(array.IndexOf(elems[static_cast<std::size_t>(i)]) == i);
+        }
+        CHECK_FALSE(array.Contains(-1));
+        CHECK_FALSE(array.Get(size).has_value());
+      }
+    }
+
+    AND_WHEN("setting elements") {
+      REQUIRE(array.Set(size - 1, -1));
+      REQUIRE_FALSE(array.Set(size, -1));
+
+      THEN("element should be changed in place") {
+        CHECK(*array.At(size - 1) == -1);
+        CHECK(array.IndexOf(-1) == size - 1);
+      }
+    }
+  }
+}
+
+SCENARIO("SegmentedArray::Clear") {
+
+  GIVEN("array spanning several chunks") {
+    auto array = MakeArray(utils::rand_array(2 * kChunk + 1, 0, 100));
+    const int capacity = array.capacity();
+
+    WHEN("clearing the array") {
+      array.Clear();
+
+      THEN("array should be empty and keep its chunks") {
+        CHECK(array.IsEmpty());
+        CHECK(array.capacity() == capacity);
+      }
+
+      AND_THEN("array should be reusable") {
+        array.Add(42);
+        CHECK(array.toVector() == std::vector<int>{42});
+      }
+    }
+  }
+}
+
+SCENARIO("SegmentedArray copy and move") {
+
+  GIVEN("array spanning several chunks") {
+    const auto elems = utils::rand_array(kChunk + 3, 0, 100);
+    auto array = MakeArray(elems);
+
+    WHEN("copying the array") {
+      auto copy = array;
+      array.Set(0, -1);
+
+      THEN("copy should be independent") {
+        CHECK_THAT(copy.toVector(), Equals(elems));
+        CHECK(array.Get(0) == -1);
+      }
+    }
+
+    AND_WHEN("moving the array") {
+      const int* first = array.At(0);
+      const auto moved = std::move(array);
+
+      THEN("chunks should be transferred") {
+        CHECK(moved.At(0) == first);
+        CHECK_THAT(moved.toVector(), Equals(elems));
+        CHECK(array.IsEmpty());
+      }
+    }
+
+    AND_WHEN("assigning arrays to each other") {
+      auto other = MakeArray({1, 2, 3});
+      other = array;
+      array = std::move(other);
+
+      THEN("elements should be preserved") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+  }
+}
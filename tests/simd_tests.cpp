@@ -0,0 +1,203 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // count, find
+#include <cstdint>    // uint32_t
+#include <iterator>   // distance
+#include <limits>     // numeric_limits
+#include <random>     // mt19937
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/simd.hpp"  // Count, CountPacked, FindFirst, Gather, Pack, Unpack, UnpackAt, Isa
+
+using assignment::simd::FindFirst;
+using assignment::simd::Isa;
+
+SCENARIO("simd::FindFirst") {
+
+  GIVEN("any supported instruction set") {
+    const auto isa = GENERATE(Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512);
+
+    if (!assignment::simd::IsSupported(isa)) {
+      return;
+    }
+
+    CAPTURE(assignment::simd::ToString(isa));
+
+    AND_GIVEN("sequence of unique elements") {
+      const int size = GENERATE(0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1000);
+
+      const auto elems = utils::rand_array(size, 0, 10'000, true);
+
+      WHEN("finding each element") {
+        THEN("index of the element should be found") {
+          for (int index = 0; index < size; index++) {
+            CHECK(FindFirst(isa, elems.data(), size, elems[index]) == index);
+          }
+        }
+      }
+
+      AND_WHEN("finding a missing element") {
+        THEN("nothing should be found") {
+          CHECK(FindFirst(isa, elems.data(), size, -1) == -1);
+        }
+      }
+
+      AND_WHEN("finding an element right after the end of the sequence") {
+        auto padded = elems;
+        padded.insert(padded.end(), 32, -1);
+
+        THEN("nothing should be found") {
+          CHECK(FindFirst(isa, padded.data(), size, -1) == -1);
+        }
+      }
+    }
+
+    AND_GIVEN("sequence with repeated elements") {
+      const int size = GENERATE(10, 100, 1000);
+
+      const auto elems = utils::rand_array(size, 0, 20);
+
+      WHEN("finding any value") {
+        const int value = GENERATE(range(0, 21));
+
+        THEN("index of the first occurrence should be found") {
+          const auto found = std::find(elems.cbegin(), elems.cend(), value);
+          const int expected = found == elems.cend() ? -1 : static_cast<int>(std::distance(elems.cbegin(), found));
+          CHECK(FindFirst(isa, elems.data(), size, value) == expected);
+        }
+      }
+    }
+  }
+
+  AND_GIVEN("active instruction set") {
+    THEN("it should be supported") {
+      CHECK(assignment::simd::IsSupported(assignment::simd::ActiveIsa()));
+    }
+  }
+}
+
+SCENARIO("simd::Count") {
+
+  GIVEN("any supported instruction set") {
+    const auto isa = GENERATE(Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512);
+
+    if (!assignment::simd::IsSupported(isa)) {
+      return;
+    }
+
+    CAPTURE(assignment::simd::ToString(isa));
+
+    AND_GIVEN("sequence with repeated elements") {
+      const int size = GENERATE(0, 1, 7, 8, 15, 16, 17, 33, 100, 1000);
+
+      const auto elems = utils::rand_array(size, 0, 5);
+
+      WHEN("counting any value") {
+        const int value = GENERATE(range(-1, 6));
+
+        THEN("number of occurrences should be counted") {
+          const auto expected = std::count(elems.cbegin(), elems.cend(), value);
+          CHECK(assignment::simd::Count(isa, elems.data(), size, value) == expected);
+          CHECK(assignment::simd::Count(elems.data(), size, value) == expected);
+        }
+      }
+
+      AND_WHEN("counting a value right after the end of the sequence") {
+        auto padded = elems;
+        padded.insert(padded.end(), 32, -1);
+
+        THEN("nothing should be counted") {
+          CHECK(assignment::simd::Count(isa, padded.data(), size, -1) == 0);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("simd::Gather") {
+
+  GIVEN("any supported instruction set") {
+    const auto isa = GENERATE(Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512);
+
+    if (!assignment::simd::IsSupported(isa)) {
+      return;
+    }
+
+    CAPTURE(assignment::simd::ToString(isa));
+
+    AND_GIVEN("sequence and random indices into it") {
+      const auto elems = utils::rand_array(1000, -1000, 1000);
+      const int count = GENERATE(0, 1, 7, 8, 9, 16, 23, 24, 25, 100, 1000);
+      const auto indices = utils::rand_array(count, 0, 999);
+
+      WHEN("gathering elements by indices") {
+        std::vector<int> out(static_cast<std::size_t>(count) + 1, 42);
+        assignment::simd::Gather(isa, elems.data(), indices.data(), count, out.data());
+
+        THEN("each element should be selected by its index") {
+          for (int i = 0; i < count; i++) {
+            REQUIRE(out[static_cast<std::size_t>(i)] == elems[static_cast<std::size_t>(indices[static_cast<std::size_t>(i)])]);
+          }
+          CHECK(out.back() == 42);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("simd::Pack/Unpack") {
+
+  GIVEN("any supported instruction set") {
+    const auto isa = GENERATE(Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512);
+
+    if (!assignment::simd::IsSupported(isa)) {
+      return;
+    }
+
+    CAPTURE(assignment::simd::ToString(isa));
+
+    AND_GIVEN("block of values fitting into the bit width") {
+      const int bits = GENERATE(range(0, 33));
+      const int reference = GENERATE(std::numeric_limits<int>::min(), -7, 0, 1000);
+      CAPTURE(bits, reference);
+
+      const std::uint32_t mask = bits == 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+      std::mt19937 engine(static_cast<std::uint32_t>(bits));
+
+      std::vector<int> values(assignment::simd::kPackedBlockSize);
+      for (auto& value : values) {
+        value = static_cast<int>(static_cast<std::uint32_t>(reference) + (engine() & mask));
+      }
+
+      WHEN("packing and unpacking the block") {
+        std::vector<std::uint32_t> packed(static_cast<std::size_t>(4 * bits) + 1, 0xDEADBEEF);
+        assignment::simd::Pack(values.data(), bits, reference, packed.data());
+
+        std::vector<int> out(values.size() + 1, 42);
+        assignment::simd::Unpack(isa, packed.data(), bits, reference, out.data());
+
+        THEN("values should be restored") {
+          for (std::size_t i = 0; i < values.size(); i++) {
+            REQUIRE(out[i] == values[i]);
+            REQUIRE(assignment::simd::UnpackAt(packed.data(), bits, reference, static_cast<int>(i)) == values[i]);
+          }
+        }
+
+        AND_THEN("packed block should take exactly 4 * bits words") {
+          CHECK(packed.back() == 0xDEADBEEF);
+          CHECK(out.back() == 42);
+        }
+
+        AND_THEN("counting values in the packed block should match the plain count") {
+          const int present = values[values.size() / 2];
+          const int missing = static_cast<int>(static_cast<std::uint32_t>(reference) + mask + 1u);
+          for (int value : {present, values.front(), reference, missing}) {
+            const auto expected = std::count(values.begin(), values.end(), value);
+            CHECK(assignment::simd::CountPacked(isa, packed.data(), bits, reference, value) == expected);
+          }
+        }
+      }
+    }
+  }
+}
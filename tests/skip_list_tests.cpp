@@ -0,0 +1,253 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // find
+#include <random>     // mt19937, uniform_int_distribution
+#include <stdexcept>  // invalid_argument
+#include <vector>     // vector
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/skip_list.hpp"  // SkipList
+
+using assignment::SkipList;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  SkipList MakeList(const std::vector<int>& elems) {
+    auto list = SkipList();
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+    return list;
+  }
+
+}  // namespace
+
+SCENARIO("SkipList::Add/Get") {
+
+  GIVEN("empty list") {
+    const int size = GENERATE(0, 1, 2, 100, 10000);
+    const auto elems = utils::rand_array(size, -100, 100);
+
+    WHEN("adding elements") {
+      const auto list = MakeList(elems);
+
+      THEN("elements should be appended in order and accessible by index") {
+        CHECK(list.size() == size);
+        CHECK(list.IsEmpty() == (size == 0));
+        CHECK_THAT(list.toVector(), Equals(elems));
+        for (int i = 0; i < size; i++) {
+          REQUIRE(list.Get(i) == elems[static_cast<std::size_t>(i)]);
+        }
+        CHECK_FALSE(list.Get(-1).has_value());
+        CHECK_FALSE(list.Get(size).has_value());
+      }
+
+      AND_THEN("front and back should be the first and the last elements") {
+        if (size > 0) {
+          CHECK(list.front() == elems.front());
+          CHECK(list.back() == elems.back());
+        } else {
+          CHECK_FALSE(list.front().has_value());
+          CHECK_FALSE(list.back().has_value());
+        }
+      }
+
+      AND_THEN("levels should grow logarithmically") {
+        CHECK(list.level() >= 1);
+        CHECK(list.level() <= SkipList::kMaxLevel);
+        if (size >= 10000) {
+          CHECK(list.level() >= 4);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("SkipList::Insert/Remove") {
+
+  GIVEN("list of elements") {
+    const int size = GENERATE(0, 1, 50, 1000);
+    const auto elems = utils::rand_array(size, 0, 1000);
+
+    auto list = MakeList(elems);
+
+    WHEN("inserting an element") {
+      const int index = GENERATE_COPY(filter([=](int i) { return i <= size; }, values({0, 1, size / 2, size})));
+
+      REQUIRE(list.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted at index") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK(list.Get(index) == -1);
+        CHECK(list.back() == expected.back());
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      CHECK_FALSE(list.Insert(-1, 0));
+      CHECK_FALSE(list.Insert(size + 1, 0));
+
+      THEN("list should not be changed") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing an element") {
+      if (size > 0) {
+        const int index = GENERATE_COPY(filter([=](int i) { return i < size; }, values({0, 1, size / 2, size - 1})));
+
+        const auto removed = list.Remove(index);
+
+        auto expected = elems;
+        expected.erase(expected.begin() + index);
+
+        THEN("removed element should be returned and the rest kept in order") {
+          CHECK(removed == elems[static_cast<std::size_t>(index)]);
+          CHECK_THAT(list.toVector(), Equals(expected));
+          if (!expected.empty()) {
+            CHECK(list.back() == expected.back());
+          }
+        }
+      }
+    }
+
+    AND_WHEN("removing an element at index outside [0, size)") {
+      CHECK_FALSE(list.Remove(-1).has_value());
+      CHECK_FALSE(list.Remove(size).has_value());
+
+      THEN("list should not be changed") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing all elements from the back and adding new ones") {
+      while (!list.IsEmpty()) {
+        list.Remove(list.size() - 1);
+      }
+      list.Add(1);
+      list.Add(2);
+
+      THEN("list should hold only the new elements") {
+        CHECK_THAT(list.toVector(), Equals(std::vector<int>{1, 2}));
+        CHECK(list.front() == 1);
+        CHECK(list.back() == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("SkipList random modifications") {
+
+  GIVEN("list and a model of it") {
+    const int seed = GENERATE(1, 2, 3);
+    auto engine = std::mt19937(static_cast<std::uint32_t>(seed));
+    auto value = std::uniform_int_distribution<>(-50, 50);
+
+    auto list = SkipList();
+    auto model = std::vector<int>();
+
+    WHEN("performing random additions, insertions, removals and updates") {
+      for (int step = 0; step < 20000; step++) {
+        const int size = static_cast<int>(model.size());
+        // фазы роста и сокращения по 5000 шагов: уровни добавляются и освобождаются
+        const bool growing = (step / 5000) % 2 == 0;
+        const int position = static_cast<int>(engine() % static_cast<unsigned>(size + 1));
+        const unsigned operation = engine() % 8;
+        if (operation < 4) {
+          if ((size == 0)||(operation < (growing ? 3u : 1u))) {
+            const int inserted = value(engine);
+            REQUIRE(list.Insert(position, inserted));
+            model.insert(model.begin() + position, inserted);
+          } else {
+            const int index = position % size;
+            REQUIRE(list.Remove(index) == model[static_cast<std::size_t>(index)]);
+            model.erase(model.begin() + index);
+          }
+        } else if (operation == 4) {
+          if (growing) {
+            const int added = value(engine);
+            list.Add(added);
+            model.push_back(added);
+          }
+        } else if ((operation == 5)&&(size > 0)) {
+          const int updated = value(engine);
+          REQUIRE(list.Set(position % size, updated));
+          model[static_cast<std::size_t>(position % size)] = updated;
+        } else if (size > 0) {
+          const int index = position % size;
+          REQUIRE(list.Get(index) == model[static_cast<std::size_t>(index)]);
+          REQUIRE(list.back() == model.back());
+        }
+        REQUIRE(list.size() == static_cast<int>(model.size()));
+      }
+
+      THEN("list should hold the same elements as the model") {
+        CHECK_THAT(list.toVector(), Equals(model));
+        for (int i = 0; i < static_cast<int>(model.size()); i++) {
+          REQUIRE(list.Get(i) == model[static_cast<std::size_t>(i)]);
+        }
+        for (int searched = -50; searched <= 50; searched++) {
+          const auto found = std::find(model.begin(), model.end(), searched);
+          REQUIRE(list.IndexOf(searched).value_or(-1) ==
+                  (found == model.end() ? -1 : static_cast<int>(found - model.begin())));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("SkipList copy, move and clear") {
+
+  GIVEN("list of elements") {
+    const auto elems = utils::rand_array(500, 0, 100);
+    auto list = MakeList(elems);
+
+    WHEN("copying the list") {
+      auto copy = list;
+      list.Set(0, 1000);
+      copy.Insert(250, -1);
+
+      THEN("copy should be independent") {
+        CHECK(list.Get(0) == 1000);
+        CHECK(copy.Get(0) == elems[0]);
+        CHECK(copy.Get(250) == -1);
+        CHECK(copy.size() == 501);
+      }
+    }
+
+    AND_WHEN("moving the list") {
+      auto moved = std::move(list);
+      moved.Add(-1);
+
+      THEN("moved-to list should own the elements, moved-from list should be empty") {
+        CHECK(moved.size() == 501);
+        CHECK(moved.back() == -1);
+        CHECK(list.IsEmpty());
+      }
+    }
+
+    AND_WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("list should be empty and reusable") {
+        CHECK(list.IsEmpty());
+        CHECK(list.level() == 1);
+        CHECK_FALSE(list.back().has_value());
+        list.Insert(0, 42);
+        CHECK(list.toVector() == std::vector<int>{42});
+      }
+    }
+  }
+
+  WHEN("creating list with null resource") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS_AS(SkipList(nullptr), std::invalid_argument);
+    }
+  }
+}
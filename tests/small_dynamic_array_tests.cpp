@@ -0,0 +1,186 @@
+#include <catch2/catch.hpp>
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/small_dynamic_array.hpp"  // SmallDynamicArray
+
+using assignment::SmallDynamicArray;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  constexpr int kInline = 8;
+
+  using Array = SmallDynamicArray<kInline>;
+
+  Array MakeArray(const std::vector<int>& elems) {
+    auto array = Array();
+    for (int elem : elems) {
+      array.Add(elem);
+    }
+    return array;
+  }
+
+}  // namespace
+
+SCENARIO("SmallDynamicArray::SmallDynamicArray") {
+
+  WHEN("creating array using default constructor") {
+    const auto array = Array();
+
+    THEN("array should be empty") {
+      CHECK(array.IsEmpty());
+    }
+
+    AND_THEN("array should use the inline buffer") {
+      CHECK(array.IsInline());
+      CHECK(array.capacity() == kInline);
+    }
+  }
+}
+
+SCENARIO("SmallDynamicArray::Add") {
+
+  GIVEN("array with zero or more elements") {
+    const int size = GENERATE(range(0, 2 * kInline + 2));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = MakeArray(elems);
+
+    THEN("elements should be preserved") {
+      CHECK(array.size() == size);
+      CHECK_THAT(array.toVector(), Equals(elems));
+    }
+
+    AND_THEN("array should spill to the heap only past the inline capacity") {
+      CHECK(array.IsInline() == (size <= kInline));
+    }
+  }
+}
+
+SCENARIO("SmallDynamicArray::Insert/Remove/Set/Get") {
+
+  GIVEN("array with zero or more elements") {
+    const int size = GENERATE(range(0, 2 * kInline + 2));
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    auto array = MakeArray(elems);
+
+    WHEN("inserting an element at index in [0, size]") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+
+      REQUIRE(array.Insert(index, -1));
+
+      THEN("element should be inserted at the specified index") {
+        auto expected = elems;
+        expected.insert(expected.begin() + index, -1);
+        CHECK_THAT(array.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      REQUIRE_FALSE(array.Insert(-1, -1));
+      REQUIRE_FALSE(array.Insert(size + 1, -1));
+
+      THEN("array should not be changed") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing an element at index in [0, size)") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+
+      if (index < size) {
+        const auto removed = array.Remove(index);
+
+        THEN("removed element should have correct value") {
+          auto expected = elems;
+          CHECK(removed == expected[static_cast<std::size_t>(index)]);
+
+          expected.erase(expected.begin() + index);
+          CHECK_THAT(array.toVector(), Equals(expected));
+        }
+      } else {
+        THEN("nothing should be removed outside [0, size)") {
+          CHECK_FALSE(array.Remove(index).has_value());
+          CHECK_FALSE(array.Remove(-1).has_value());
+        }
+      }
+    }
+
+    AND_WHEN("setting and getting elements") {
+      for (int i = 0; i < size; i++) {
+        REQUIRE(array.Set(i, i * 10));
+      }
+
+      THEN("elements should be changed") {
+        for (int i = 0; i < size; i++) {
+          CHECK(array.Get(i) == i * 10);
+          CHECK(array.IndexOf(i * 10) == i);
+          CHECK(array.Contains(i * 10));
+        }
+        CHECK_FALSE(array.Set(size, 0));
+        CHECK_FALSE(array.Get(size).has_value());
+        CHECK_FALSE(array.Contains(-1));
+      }
+    }
+
+    AND_WHEN("clearing the array") {
+      const int capacity = array.capacity();
+      array.Clear();
+
+      THEN("array should be empty, capacity should not be changed") {
+        CHECK(array.IsEmpty());
+        CHECK(array.capacity() == capacity);
+      }
+    }
+  }
+}
+
+SCENARIO("SmallDynamicArray copy and move") {
+
+  GIVEN("array with zero or more elements") {
+    const int size = GENERATE(0, kInline, 3 * kInline);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto array = MakeArray(elems);
+
+    WHEN("copying the array") {
+      auto copy = array;
+      copy.Add(-1);
+
+      THEN("copy should be independent") {
+        CHECK_THAT(array.toVector(), Equals(elems));
+        CHECK(copy.size() == size + 1);
+      }
+    }
+
+    AND_WHEN("moving the array") {
+      auto moved = std::move(array);
+
+      THEN("moved array should own the elements") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+        CHECK(array.IsEmpty());
+        CHECK(array.IsInline());
+      }
+
+      AND_THEN("moved-from array should be usable") {
+        array.Add(1);
+        CHECK(array.Get(0) == 1);
+      }
+    }
+
+    AND_WHEN("assigning arrays") {
+      auto other = MakeArray(utils::rand_array(2 * kInline, 0, 100));
+      other = array;
+
+      auto moved = MakeArray({1, 2, 3});
+      moved = std::move(other);
+
+      THEN("assigned arrays should contain the elements") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+      }
+    }
+  }
+}
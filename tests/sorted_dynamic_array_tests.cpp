@@ -0,0 +1,183 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // find, is_sorted, lower_bound, sort, upper_bound
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/sorted_dynamic_array.hpp"  // SortedDynamicArray
+
+using assignment::SortedDynamicArray;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  std::vector<int> Sorted(std::vector<int> values) {
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+}  // namespace
+
+SCENARIO("SortedDynamicArray::SortedDynamicArray") {
+
+  WHEN("creating array using default constructor") {
+    const auto array = SortedDynamicArray();
+
+    THEN("array should be empty") {
+      CHECK(array.IsEmpty());
+      CHECK(array.capacity() == SortedDynamicArray::kInitCapacity);
+    }
+  }
+
+  AND_WHEN("creating array by specifying capacity <= 0") {
+    const int capacity = GENERATE(range(-5, 1));
+
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(SortedDynamicArray(capacity));
+    }
+  }
+}
+
+SCENARIO("SortedDynamicArray::InsertSorted") {
+
+  GIVEN("empty array") {
+    const int size = GENERATE(range(0, 40));
+    const auto elems = utils::rand_array(size, 0, 10);
+
+    auto array = SortedDynamicArray(1);
+
+    WHEN("inserting elements one by one") {
+      for (int elem : elems) {
+        const int index = array.InsertSorted(elem);
+        REQUIRE(array.Get(index) == elem);
+      }
+
+      THEN("elements should be sorted") {
+        CHECK_THAT(array.toVector(), Equals(Sorted(elems)));
+      }
+    }
+
+    AND_WHEN("inserting elements in bulk") {
+      const auto more = utils::rand_array(size, 0, 10);
+
+      REQUIRE(array.InsertSorted(elems.data(), size));
+      REQUIRE(array.InsertSorted(more.data(), size));
+
+      auto expected = elems;
+      expected.insert(expected.end(), more.begin(), more.end());
+
+      THEN("elements should be merged in order") {
+        CHECK_THAT(array.toVector(), Equals(Sorted(expected)));
+      }
+    }
+
+    AND_WHEN("inserting the array's own elements in bulk") {
+      REQUIRE(array.InsertSorted(elems.data(), size));
+      REQUIRE(array.InsertSorted(array.data(), array.size()));
+
+      auto expected = elems;
+      expected.insert(expected.end(), elems.begin(), elems.end());
+
+      THEN("every element should be duplicated in order") {
+        CHECK_THAT(array.toVector(), Equals(Sorted(expected)));
+      }
+    }
+
+    AND_WHEN("inserting an invalid sequence") {
+      THEN("array should not be changed") {
+        CHECK_FALSE(array.InsertSorted(nullptr, 1));
+        CHECK_FALSE(array.InsertSorted(elems.data(), -1));
+        CHECK(array.IsEmpty());
+      }
+    }
+  }
+}
+
+SCENARIO("SortedDynamicArray::LowerBound/UpperBound") {
+
+  GIVEN("array with zero or more elements (with duplicates)") {
+    const int size = GENERATE(range(0, 34));
+    const auto elems = Sorted(utils::rand_array(size, 0, 20));
+
+    const auto array = SortedDynamicArray(elems);
+
+    WHEN("searching for values in and around the range of elements") {
+      const int value = GENERATE(range(-1, 22));
+
+      THEN("bounds should match the standard library") {
+        const auto lower = std::lower_bound(elems.begin(), elems.end(), value) - elems.begin();
+        const auto upper = std::upper_bound(elems.begin(), elems.end(), value) - elems.begin();
+
+        CHECK(array.LowerBound(value) == lower);
+        CHECK(array.UpperBound(value) == upper);
+      }
+
+      AND_THEN("index of the first occurrence should be found") {
+        const auto it = std::find(elems.begin(), elems.end(), value);
+
+        if (it == elems.end()) {
+          CHECK_FALSE(array.IndexOf(value).has_value());
+          CHECK_FALSE(array.Contains(value));
+        } else {
+          CHECK(array.IndexOf(value) == it - elems.begin());
+          CHECK(array.Contains(value));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("SortedDynamicArray::Remove") {
+
+  GIVEN("array with one or more elements") {
+    const int size = GENERATE(range(1, 12));
+    const auto elems = Sorted(utils::rand_array(size, 0, 5));
+
+    auto array = SortedDynamicArray(elems);
+
+    WHEN("removing an element at index in [0, size)") {
+      const int index = GENERATE_COPY(range(0, size));
+
+      auto expected = elems;
+      expected.erase(expected.begin() + index);
+
+      THEN("removed element should have correct value") {
+        CHECK(array.Remove(index) == elems[static_cast<std::size_t>(index)]);
+        CHECK_THAT(array.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("removing an element at index outside [0, size)") {
+      THEN("nothing should be removed") {
+        CHECK_FALSE(array.Remove(-1).has_value());
+        CHECK_FALSE(array.Remove(size).has_value());
+        CHECK(array.size() == size);
+      }
+    }
+
+    AND_WHEN("removing an element by value") {
+      const int value = elems.back();
+
+      REQUIRE(array.RemoveValue(value));
+      REQUIRE_FALSE(array.RemoveValue(-1));
+
+      THEN("one occurrence should be removed and order preserved") {
+        const auto values = array.toVector();
+
+        CHECK(array.size() == size - 1);
+        CHECK(std::is_sorted(values.begin(), values.end()));
+      }
+    }
+
+    AND_WHEN("clearing the array") {
+      const int capacity = array.capacity();
+      array.Clear();
+
+      THEN("array should be empty, capacity should be preserved") {
+        CHECK(array.IsEmpty());
+        CHECK(array.capacity() == capacity);
+      }
+    }
+  }
+}
@@ -0,0 +1,233 @@
+#include <catch2/catch.hpp>
+
+#include <random>  // mt19937, uniform_int_distribution
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/array_stack.hpp"          // ArrayStack
+#include "assignment/dynamic_array.hpp"        // DynamicArray
+#include "assignment/linked_queue.hpp"         // LinkedQueue
+#include "assignment/static_array_stack.hpp"   // StaticArrayStack
+#include "assignment/static_dynamic_array.hpp"  // StaticDynamicArray
+#include "assignment/static_linked_list.hpp"   // StaticLinkedList
+#include "assignment/static_linked_queue.hpp"  // StaticLinkedQueue
+#include "assignment/virtual_adapters.hpp"     // ListAdapter, StackAdapter, QueueAdapter
+
+using assignment::DynamicArray;
+using assignment::ListAdapter;
+using assignment::QueueAdapter;
+using assignment::StackAdapter;
+using assignment::StaticArrayStack;
+using assignment::StaticDynamicArray;
+using assignment::StaticLinkedList;
+using assignment::StaticLinkedQueue;
+
+using Catch::Matchers::Equals;
+
+TEMPLATE_TEST_CASE("Static lists", "[static]", StaticDynamicArray, StaticLinkedList) {
+
+  GIVEN("list with zero or more elements") {
+    const int size = GENERATE(range(0, 8));
+    const auto elems = utils::rand_array(size, 0, 100, true);
+
+    TestType list;
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+
+    THEN("elements should be accessible by index and value") {
+      CHECK(list.size() == size);
+      CHECK(list.IsEmpty() == (size == 0));
+      for (int i = 0; i < size; i++) {
+        CHECK(list.Get(i) == elems[static_cast<std::size_t>(i)]);
+        CHECK(list.IndexOf(elems[static_cast<std::size_t>(i)]) == i);
+      }
+      CHECK_FALSE(list.Get(size).has_value());
+      CHECK_FALSE(list.Contains(-1));
+    }
+
+    WHEN("inserting an element at index in [0, size]") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+      REQUIRE(list.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted at the specified index") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("removing an element at index in [0, size)") {
+      if (size > 0) {
+        const int index = GENERATE_COPY(range(0, size));
+        const auto removed = list.Remove(index);
+
+        auto expected = elems;
+        expected.erase(expected.begin() + index);
+
+        THEN("element should be removed and returned") {
+          CHECK(removed == elems[static_cast<std::size_t>(index)]);
+          CHECK_THAT(list.toVector(), Equals(expected));
+        }
+
+        AND_THEN("list should accept new elements at the back") {
+          list.Add(-2);
+          expected.push_back(-2);
+          CHECK_THAT(list.toVector(), Equals(expected));
+        }
+      }
+    }
+
+    AND_WHEN("setting elements and clearing the list") {
+      CHECK_FALSE(list.Set(size, -1));
+      if (size > 0) {
+        CHECK(list.Set(size - 1, -1));
+        CHECK(list.Get(size - 1) == -1);
+      }
+      list.Clear();
+
+      THEN("list should be empty") {
+        CHECK(list.IsEmpty());
+        CHECK(list.toVector().empty());
+      }
+    }
+
+    AND_WHEN("moving the list") {
+      TestType moved = std::move(list);
+
+      THEN("elements should be transferred") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+        CHECK(list.IsEmpty());
+      }
+
+      AND_THEN("moved-from list should be reusable") {
+        list.Add(1);
+        CHECK(list.toVector() == std::vector<int>{1});
+      }
+    }
+  }
+}
+
+SCENARIO("StaticArrayStack") {
+
+  GIVEN("stack with zero or more elements") {
+    const int size = GENERATE(range(0, 25));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto stack = StaticArrayStack(1);
+    for (int elem : elems) {
+      stack.Push(elem);
+    }
+
+    WHEN("popping all elements") {
+      std::vector<int> popped;
+      while (stack.Peek().has_value()) {
+        popped.push_back(*stack.Peek());
+        REQUIRE(stack.Pop());
+      }
+
+      THEN("elements should be popped in reverse order") {
+        CHECK(std::vector<int>(popped.rbegin(), popped.rend()) == elems);
+        CHECK(stack.IsEmpty());
+        CHECK_FALSE(stack.Pop());
+      }
+    }
+  }
+
+  AND_GIVEN("non-positive capacity") {
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(StaticArrayStack(0));
+      CHECK_THROWS(StaticDynamicArray(-1));
+    }
+  }
+}
+
+SCENARIO("StaticLinkedQueue") {
+
+  GIVEN("queue with zero or more elements") {
+    const int size = GENERATE(range(0, 10));
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto queue = StaticLinkedQueue();
+    for (int elem : elems) {
+      queue.Enqueue(elem);
+    }
+
+    WHEN("dequeuing all elements") {
+      std::vector<int> dequeued;
+      while (queue.front().has_value()) {
+        dequeued.push_back(*queue.front());
+        REQUIRE(queue.Dequeue());
+      }
+
+      THEN("elements should be dequeued in order") {
+        CHECK(dequeued == elems);
+        CHECK(queue.IsEmpty());
+        CHECK_FALSE(queue.back().has_value());
+      }
+    }
+  }
+}
+
+SCENARIO("Virtual adapters match out-of-line containers") {
+
+  GIVEN("adapted and original containers receiving the same operations") {
+    std::mt19937 engine(GENERATE(1u, 2u));
+
+    auto array_adapter = ListAdapter<StaticDynamicArray>(1);
+    auto list_adapter = ListAdapter<StaticLinkedList>();
+    auto array = DynamicArray();
+    assignment::List& adapted_array = array_adapter;
+    assignment::List& adapted_list = list_adapter;
+
+    auto stack_adapter = StackAdapter<StaticArrayStack>();
+    auto stack = assignment::ArrayStack();
+    assignment::Stack& adapted_stack = stack_adapter;
+
+    auto queue_adapter = QueueAdapter<StaticLinkedQueue>();
+    auto queue = assignment::LinkedQueue();
+    assignment::Queue& adapted_queue = queue_adapter;
+
+    WHEN("applying random operations through the virtual interfaces") {
+      for (int step = 0; step < 500; step++) {
+        const int value = std::uniform_int_distribution<int>(0, 50)(engine);
+        const int index = std::uniform_int_distribution<int>(-1, array.size() + 1)(engine);
+
+        switch (std::uniform_int_distribution<int>(0, 3)(engine)) {
+          case 0:
+            REQUIRE(adapted_array.Insert(index, value) == array.Insert(index, value));
+            REQUIRE(adapted_list.Insert(index, value) == adapted_array.Get(index).has_value());
+            adapted_stack.Push(value);
+            stack.Push(value);
+            adapted_queue.Enqueue(value);
+            queue.Enqueue(value);
+            break;
+          case 1:
+            REQUIRE(adapted_array.Remove(index) == array.Remove(index));
+            adapted_list.Remove(index);
+            REQUIRE(adapted_stack.Pop() == stack.Pop());
+            break;
+          case 2:
+            REQUIRE(adapted_array.Set(index, value) == array.Set(index, value));
+            adapted_list.Set(index, value);
+            REQUIRE(adapted_stack.Peek() == stack.Peek());
+            break;
+          default:
+            REQUIRE(adapted_array.IndexOf(value) == array.IndexOf(value));
+            REQUIRE(adapted_list.Contains(value) == array.Contains(value));
+            REQUIRE(adapted_queue.Dequeue() == queue.Dequeue());
+            break;
+        }
+      }
+
+      THEN("contents should be equal") {
+        CHECK_THAT(array_adapter.impl().toVector(), Equals(array.toVector(array.size())));
+        CHECK_THAT(list_adapter.impl().toVector(), Equals(array.toVector(array.size())));
+        CHECK(adapted_stack.size() == stack.size());
+        CHECK(adapted_stack.Peek() == stack.Peek());
+        CHECK_THAT(queue_adapter.impl().toVector(), Equals(queue.toVector()));
+      }
+    }
+  }
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // count, find
+#include <atomic>     // atomic
+#include <vector>     // vector
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/parallel_scan.hpp"  // FindFirst, Count, kChunkSize
+#include "assignment/thread_pool.hpp"    // ThreadPool
+
+using assignment::ThreadPool;
+
+SCENARIO("ThreadPool::ParallelFor") {
+
+  WHEN("creating pool by specifying thread count <= 0") {
+    const int threads = GENERATE(range(-2, 1));
+
+    THEN("constructor should throw an exception") {
+      CHECK_THROWS(ThreadPool(threads));
+    }
+  }
+
+  AND_GIVEN("pool with one or more threads") {
+    const int threads = GENERATE(1, 2, 4);
+    auto pool = ThreadPool(threads);
+
+    REQUIRE(pool.size() == threads);
+
+    WHEN("running any number of tasks several times") {
+      const int count = GENERATE(0, 1, 3, 100);
+
+      auto hits = std::vector<std::atomic<int>>(static_cast<std::size_t>(count));
+      for (int run = 0; run < 3; run++) {
+        pool.ParallelFor(count, [&hits](int task) {
+          hits[static_cast<std::size_t>(task)].fetch_add(1);
+        });
+      }
+
+      THEN("each task should be executed exactly once per run") {
+        for (const auto& hit : hits) {
+          CHECK(hit.load() == 3);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("parallel::FindFirst/Count") {
+
+  GIVEN("pool of several threads and sequence spanning several chunks") {
+    const int threads = GENERATE(1, 3);
+    auto pool = ThreadPool(threads);
+
+    const int size = GENERATE(0, 17, 3 * assignment::parallel::kChunkSize + 17);
+    const auto elems = utils::rand_array(size, 0, 50'000);
+
+    WHEN("searching for values present in different chunks") {
+      THEN("lowest index and number of occurrences should be found") {
+        for (int i = 0; i < size; i += size / 7 + 1) {
+          const int value = elems[static_cast<std::size_t>(i)];
+          const auto expected = std::find(elems.cbegin(), elems.cend(), value) - elems.cbegin();
+
+          CHECK(assignment::parallel::FindFirst(pool, elems.data(), size, value) == expected);
+          CHECK(assignment::parallel::Count(pool, elems.data(), size, value) ==
+                std::count(elems.cbegin(), elems.cend(), value));
+        }
+      }
+    }
+
+    AND_WHEN("searching for a missing value") {
+      THEN("nothing should be found") {
+        CHECK(assignment::parallel::FindFirst(pool, elems.data(), size, -1) == -1);
+        CHECK(assignment::parallel::Count(pool, elems.data(), size, -1) == 0);
+      }
+    }
+
+    AND_WHEN("value occurs in every chunk") {
+      auto repeated = elems;
+      for (int i = 0; i < size; i += assignment::parallel::kChunkSize / 2) {
+        repeated[static_cast<std::size_t>(i)] = -2;
+      }
+
+      THEN("first occurrence should be found") {
+        if (size > 0) {
+          CHECK(assignment::parallel::FindFirst(pool, repeated.data(), size, -2) == 0);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,285 @@
+#include <catch2/catch.hpp>
+
+#include <random>  // mt19937, uniform_int_distribution
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/dynamic_array.hpp"  // DynamicArray
+#include "assignment/tiered_vector.hpp"  // TieredVector
+
+using assignment::DynamicArray;
+using assignment::TieredVector;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  constexpr int kBlock = 1 << TieredVector::kMinBlockShift;
+
+  TieredVector MakeVector(const std::vector<int>& elems) {
+    auto vector = TieredVector();
+    for (int elem : elems) {
+      vector.Add(elem);
+    }
+    return vector;
+  }
+
+}  // namespace
+
+SCENARIO("TieredVector::TieredVector") {
+
+  WHEN("creating vector using default constructor") {
+    const auto vector = TieredVector();
+
+    THEN("vector should be empty") {
+      CHECK(vector.IsEmpty());
+      CHECK(vector.size() == 0);
+      CHECK(vector.block_size() == kBlock);
+    }
+  }
+}
+
+SCENARIO("TieredVector::Get") {
+
+  GIVEN("empty vector") {
+    const auto vector = TieredVector();
+
+    WHEN("getting an element at any index") {
+      const int index = GENERATE(range(-5, 5));
+
+      THEN("nothing should be returned") {
+        CHECK_FALSE(vector.Get(index).has_value());
+      }
+    }
+  }
+
+  AND_GIVEN("vector with one or more elements") {
+    const int size = GENERATE(1, kBlock - 1, kBlock, 3 * kBlock + 1);
+    const auto elems = utils::rand_array(size, -100, 100);
+
+    const auto vector = MakeVector(elems);
+
+    WHEN("getting an element at index in [0, size)") {
+      THEN("element at the specified index should be returned") {
+        for (int i = 0; i < size; i++) {
+          REQUIRE(vector.Get(i) == elems[static_cast<std::size_t>(i)]);
+        }
+      }
+    }
+
+    AND_WHEN("getting an element at index outside [0, size)") {
+      THEN("nothing should be returned") {
+        CHECK_FALSE(vector.Get(-1).has_value());
+        CHECK_FALSE(vector.Get(size).has_value());
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector::Set") {
+
+  GIVEN("vector with one or more elements") {
+    const int size = GENERATE(1, kBlock + 1);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto vector = MakeVector(elems);
+
+    WHEN("setting an element at index in [0, size)") {
+      const int index = GENERATE_COPY(range(0, size));
+      REQUIRE(vector.Set(index, -1));
+
+      auto expected = elems;
+      expected[static_cast<std::size_t>(index)] = -1;
+
+      THEN("set should change an element at the specified index") {
+        CHECK(vector.size() == size);
+        CHECK_THAT(vector.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("setting an element at index outside [0, size)") {
+      REQUIRE_FALSE(vector.Set(-1, -1));
+      REQUIRE_FALSE(vector.Set(size, -1));
+
+      THEN("vector elements should not be changed") {
+        CHECK_THAT(vector.toVector(), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector::IndexOf/Contains") {
+
+  GIVEN("vector of unique elements with wrapped blocks") {
+    const int size = 4 * kBlock + 3;
+    const auto elems = utils::rand_array(size, 0, 10 * size, true);
+
+    // вставки в начало сдвигают начала кольцевых буферов во всех блоках
+    auto vector = TieredVector();
+    for (auto it = elems.rbegin(); it != elems.rend(); ++it) {
+      vector.Insert(0, *it);
+    }
+
+    WHEN("finding index of an existing element") {
+      THEN("correct index should be found") {
+        for (int i = 0; i < size; i++) {
+          REQUIRE(vector.IndexOf(elems[static_cast<std::size_t>(i)]) == i);
+        }
+      }
+    }
+
+    AND_WHEN("finding a missing element") {
+      THEN("nothing should be found") {
+        CHECK_FALSE(vector.IndexOf(-1).has_value());
+        CHECK_FALSE(vector.Contains(-1));
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector::Insert") {
+
+  GIVEN("vector with zero or more elements") {
+    const int size = GENERATE(0, 1, kBlock - 1, kBlock, 2 * kBlock + 5);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto vector = MakeVector(elems);
+
+    WHEN("inserting an element at index in [0, size]") {
+      const int index = GENERATE_COPY(range(0, size + 1));
+      REQUIRE(vector.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("inserted element should be at the specified index and previous elements present") {
+        CHECK(vector.size() == size + 1);
+        CHECK_THAT(vector.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      REQUIRE_FALSE(vector.Insert(-1, -1));
+      REQUIRE_FALSE(vector.Insert(size + 1, -1));
+
+      THEN("vector elements should not be changed") {
+        CHECK_THAT(vector.toVector(), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector::Remove") {
+
+  GIVEN("vector with one or more elements") {
+    const int size = GENERATE(1, kBlock, 2 * kBlock + 5);
+    const auto elems = utils::rand_array(size, 0, 100);
+
+    auto vector = MakeVector(elems);
+
+    WHEN("removing an element at index in [0, size)") {
+      const int index = GENERATE_COPY(range(0, size));
+      const auto removed = vector.Remove(index);
+
+      auto expected = elems;
+      expected.erase(expected.begin() + index);
+
+      THEN("removed element should be returned and the rest preserved") {
+        CHECK(removed == elems[static_cast<std::size_t>(index)]);
+        CHECK_THAT(vector.toVector(), Equals(expected));
+      }
+    }
+
+    AND_WHEN("removing an element at index outside [0, size)") {
+      THEN("nothing should be removed") {
+        CHECK_FALSE(vector.Remove(-1).has_value());
+        CHECK_FALSE(vector.Remove(size).has_value());
+        CHECK_THAT(vector.toVector(), Equals(elems));
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector::Clear") {
+
+  GIVEN("vector spanning several resized blocks") {
+    auto vector = MakeVector(utils::rand_array(16 * kBlock * kBlock, 0, 100));
+    REQUIRE(vector.block_size() > kBlock);
+
+    WHEN("clearing the vector") {
+      vector.Clear();
+
+      THEN("vector should be empty and reusable") {
+        CHECK(vector.IsEmpty());
+        CHECK(vector.block_size() == kBlock);
+        vector.Add(42);
+        CHECK(vector.toVector() == std::vector<int>{42});
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector matches DynamicArray") {
+
+  GIVEN("vector and array receiving the same random edits") {
+    const unsigned seed = GENERATE(1u, 2u, 3u);
+    std::mt19937 engine(seed);
+
+    auto vector = TieredVector();
+    auto array = DynamicArray();
+
+    WHEN("growing past several block resizes and shrinking back") {
+      const int steps = 40'000;
+      for (int step = 0; step < steps; step++) {
+        const bool grow = step < steps / 2;
+        const int op = std::uniform_int_distribution<int>(0, 9)(engine);
+        const int size = array.size();
+        const int value = std::uniform_int_distribution<int>(0, 1000)(engine);
+
+        if (op < (grow ? 6 : 3) || size == 0) {
+          const int index = std::uniform_int_distribution<int>(0, size)(engine);
+          REQUIRE(vector.Insert(index, value) == array.Insert(index, value));
+        } else if (op < 9) {
+          const int index = std::uniform_int_distribution<int>(0, size - 1)(engine);
+          REQUIRE(vector.Remove(index) == array.Remove(index));
+        } else {
+          const int index = std::uniform_int_distribution<int>(0, size - 1)(engine);
+          REQUIRE(vector.Set(index, value) == array.Set(index, value));
+        }
+      }
+
+      THEN("contents should be equal") {
+        CHECK(vector.size() == array.size());
+        CHECK_THAT(vector.toVector(), Equals(array.toVector(array.size())));
+        CHECK(vector.IndexOf(500) == array.IndexOf(500));
+      }
+    }
+  }
+}
+
+SCENARIO("TieredVector copy and move") {
+
+  GIVEN("vector with elements") {
+    const auto elems = utils::rand_array(3 * kBlock, 0, 100);
+    auto vector = MakeVector(elems);
+
+    WHEN("copying the vector") {
+      auto copy = vector;
+      vector.Set(0, -1);
+
+      THEN("copy should be independent") {
+        CHECK_THAT(copy.toVector(), Equals(elems));
+        CHECK(vector.Get(0) == -1);
+      }
+    }
+
+    AND_WHEN("moving the vector") {
+      auto moved = std::move(vector);
+
+      THEN("elements should be transferred") {
+        CHECK_THAT(moved.toVector(), Equals(elems));
+        CHECK(vector.IsEmpty());
+      }
+    }
+  }
+}
@@ -0,0 +1,241 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>  // find
+#include <random>     // mt19937, uniform_int_distribution
+#include <vector>     // vector
+
+#include "utils.hpp"  // rand_array
+
+#include "assignment/unrolled_linked_list.hpp"  // UnrolledLinkedList
+
+using assignment::UnrolledLinkedList;
+
+using Catch::Matchers::Equals;
+
+namespace {
+
+  constexpr int kNode = UnrolledLinkedList::kNodeCapacity;
+
+  UnrolledLinkedList MakeList(const std::vector<int>& elems) {
+    auto list = UnrolledLinkedList();
+    for (int elem : elems) {
+      list.Add(elem);
+    }
+    return list;
+  }
+
+  // все узлы, кроме последнего, заполнены не меньше чем наполовину
+  bool IsBalanced(const UnrolledLinkedList& list) {
+    const int full_chunks = list.chunk_count() - 1;
+    return (list.chunk_count() == 0)||(list.size() >= full_chunks * UnrolledLinkedList::kMinNodeSize + 1);
+  }
+
+}  // namespace
+
+SCENARIO("UnrolledLinkedList::Add") {
+
+  GIVEN("empty list") {
+    const int size = GENERATE(0, 1, kNode - 1, kNode, kNode + 1, 10 * kNode + 7);
+    const auto elems = utils::rand_array(size, -100, 100);
+
+    WHEN("adding elements") {
+      const auto list = MakeList(elems);
+
+      THEN("elements should be appended in order into fully packed nodes") {
+        CHECK(list.size() == size);
+        CHECK(list.IsEmpty() == (size == 0));
+        CHECK_THAT(list.toVector(), Equals(elems));
+        CHECK(list.chunk_count() == (size + kNode - 1) / kNode);
+      }
+
+      AND_THEN("front and back should be the first and the last elements") {
+        if (size > 0) {
+          CHECK(list.front() == elems.front());
+          CHECK(list.back() == elems.back());
+        } else {
+          CHECK_FALSE(list.front().has_value());
+          CHECK_FALSE(list.back().has_value());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("UnrolledLinkedList::Insert/Remove") {
+
+  GIVEN("list spanning several nodes") {
+    const int size = GENERATE(0, 3, kNode, 3 * kNode + 5);
+    const auto elems = utils::rand_array(size, 0, 1000);
+
+    auto list = MakeList(elems);
+
+    WHEN("inserting an element at node edges and in between") {
+      const int index = GENERATE_COPY(filter([=](int i) { return i <= size; },
+                                             values({0, 1, kNode / 2, kNode - 1, kNode, kNode + 1, size})));
+
+      REQUIRE(list.Insert(index, -1));
+
+      auto expected = elems;
+      expected.insert(expected.begin() + index, -1);
+
+      THEN("element should be inserted and a full node split") {
+        CHECK_THAT(list.toVector(), Equals(expected));
+        CHECK(list.Get(index) == -1);
+        CHECK(IsBalanced(list));
+      }
+    }
+
+    AND_WHEN("inserting an element at index outside [0, size]") {
+      CHECK_FALSE(list.Insert(-1, 0));
+      CHECK_FALSE(list.Insert(size + 1, 0));
+
+      THEN("list should not be changed") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing an element at node edges and in between") {
+      if (size > 0) {
+        const int index = GENERATE_COPY(filter([=](int i) { return i < size; },
+                                               values({0, 1, kNode - 1, kNode, kNode + 1, size - 1})));
+
+        const auto removed = list.Remove(index);
+
+        auto expected = elems;
+        expected.erase(expected.begin() + index);
+
+        THEN("removed element should be returned and the rest kept in order") {
+          CHECK(removed == elems[static_cast<std::size_t>(index)]);
+          CHECK_THAT(list.toVector(), Equals(expected));
+        }
+      }
+    }
+
+    AND_WHEN("removing an element at index outside [0, size)") {
+      CHECK_FALSE(list.Remove(-1).has_value());
+      CHECK_FALSE(list.Remove(size).has_value());
+
+      THEN("list should not be changed") {
+        CHECK_THAT(list.toVector(), Equals(elems));
+      }
+    }
+
+    AND_WHEN("removing all elements") {
+      while (!list.IsEmpty()) {
+        list.Remove(list.size() / 2);
+      }
+
+      THEN("all nodes should be released to the pool") {
+        CHECK(list.chunk_count() == 0);
+        CHECK(list.pool().live_count() == 0);
+        CHECK_FALSE(list.back().has_value());
+      }
+    }
+  }
+}
+
+SCENARIO("UnrolledLinkedList random modifications") {
+
+  GIVEN("list and a model of it") {
+    const int seed = GENERATE(1, 2, 3);
+    auto engine = std::mt19937(static_cast<std::uint32_t>(seed));
+    auto value = std::uniform_int_distribution<>(-50, 50);
+
+    auto list = UnrolledLinkedList();
+    auto model = std::vector<int>();
+
+    WHEN("performing random insertions, removals and updates") {
+      for (int step = 0; step < 20000; step++) {
+        const int size = static_cast<int>(model.size());
+        // вставки чаще удалений до 1000 элементов, затем наоборот: узлы делятся и объединяются
+        // фазы роста и сокращения по 5000 шагов: узлы делятся, объединяются и обмениваются значениями
+        const bool growing = (step / 5000) % 2 == 0;
+        const int position = static_cast<int>(engine() % static_cast<unsigned>(size + 1));
+        const unsigned operation = engine() % 6;
+        if (operation < 4) {
+          if ((size == 0)||(operation < (growing ? 3u : 1u))) {
+            const int inserted = value(engine);
+            REQUIRE(list.Insert(position, inserted));
+            model.insert(model.begin() + position, inserted);
+          } else {
+            const int index = position % size;
+            REQUIRE(list.Remove(index) == model[static_cast<std::size_t>(index)]);
+            model.erase(model.begin() + index);
+          }
+        } else if ((operation == 4)&&(size > 0)) {
+          const int updated = value(engine);
+          REQUIRE(list.Set(position % size, updated));
+          model[static_cast<std::size_t>(position % size)] = updated;
+        } else {
+          const int searched = value(engine);
+          const auto found = std::find(model.begin(), model.end(), searched);
+          REQUIRE(list.IndexOf(searched).value_or(-1) ==
+                  (found == model.end() ? -1 : static_cast<int>(found - model.begin())));
+        }
+        REQUIRE(list.size() == static_cast<int>(model.size()));
+        REQUIRE(IsBalanced(list));
+      }
+
+      THEN("list should hold the same elements as the model") {
+        CHECK_THAT(list.toVector(), Equals(model));
+        for (int i = 0; i < static_cast<int>(model.size()); i++) {
+          REQUIRE(list.Get(i) == model[static_cast<std::size_t>(i)]);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("UnrolledLinkedList::Clear") {
+
+  GIVEN("list spanning several nodes") {
+    auto list = MakeList(utils::rand_array(5 * kNode, 0, 100));
+
+    WHEN("clearing the list") {
+      list.Clear();
+
+      THEN("list should be empty and keep one slab of the pool") {
+        CHECK(list.IsEmpty());
+        CHECK(list.chunk_count() == 0);
+        CHECK(list.pool().slab_count() == 1);
+      }
+
+      AND_THEN("list should be reusable") {
+        list.Add(42);
+        CHECK(list.toVector() == std::vector<int>{42});
+      }
+    }
+  }
+}
+
+SCENARIO("UnrolledLinkedList copy and move") {
+
+  GIVEN("list with half-full nodes") {
+    const auto elems = utils::rand_array(4 * kNode, 0, 100);
+    auto list = MakeList(elems);
+    for (int i = 0; i < 3 * kNode; i++) {
+      list.Insert(i * 2 % list.size(), -i);
+    }
+    const auto contents = list.toVector();
+
+    WHEN("copying the list") {
+      auto copy = list;
+      list.Set(0, 1000);
+
+      THEN("copy should be independent and packed") {
+        CHECK_THAT(copy.toVector(), Equals(contents));
+        CHECK(list.Get(0) == 1000);
+        CHECK(copy.chunk_count() == (copy.size() + kNode - 1) / kNode);
+      }
+    }
+
+    AND_WHEN("moving the list") {
+      auto moved = std::move(list);
+
+      THEN("moved-to list should own the elements, moved-from list should be empty") {
+        CHECK_THAT(moved.toVector(), Equals(contents));
+        CHECK(list.IsEmpty());
+      }
+    }
+  }
+}
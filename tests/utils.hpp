@@ -2,11 +2,88 @@
 
 #include <vector>
 #include <unordered_set>
-#include <algorithm>  // generate, shuffle
-#include <random>     // mt19937, uniform_int_distribution
+#include <algorithm>        // generate, shuffle
+#include <random>           // mt19937, uniform_int_distribution, random_device
+#include <memory_resource>  // memory_resource, new_delete_resource
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>   // open
+#include <unistd.h>  // close, lseek, pread, pwrite
+
+#include <filesystem>    // temp_directory_path, remove
+#include <string>        // string, to_string
+#include <system_error>  // error_code
+#endif
 
 namespace utils {
 
+  // ресурс, считающий обращения к вышестоящему ресурсу
+  struct CountingResource : std::pmr::memory_resource {
+    int allocations{0};
+    int deallocations{0};
+
+   protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+      allocations++;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+      deallocations++;
+      std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+  };
+
+#if defined(__unix__) || defined(__APPLE__)
+
+  // временный файл, удаляемый при выходе из области видимости (до вызова Open файл не создается)
+  struct TempFile {
+    std::string path;  // уникальный путь во временном каталоге
+    int fd{-1};        // дескриптор файла, открытого через Open (-1 - не открыт)
+
+    TempFile()
+        : path{(std::filesystem::temp_directory_path() /
+                ("assignment_" + std::to_string(std::random_device{}()) + ".bin"))
+                   .string()} {}
+
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    ~TempFile() {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+      std::error_code ignored;
+      std::filesystem::remove(path, ignored);
+    }
+
+    // создание файла и открытие для чтения и записи
+    int Open() {
+      fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+      return fd;
+    }
+
+    void Rewind() const {
+      ::lseek(fd, 0, SEEK_SET);
+    }
+
+    // инвертирование битов байта по смещению от начала файла
+    bool Corrupt(off_t offset) const {
+      unsigned char byte = 0;
+      if (::pread(fd, &byte, 1, offset) != 1) {
+        return false;
+      }
+      byte = static_cast<unsigned char>(~byte);
+      return ::pwrite(fd, &byte, 1, offset) == 1;
+    }
+  };
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
   inline std::vector<int> rand_array(int length, int start, int end, bool unique = false) {
     if (length == 0) {
       return {};